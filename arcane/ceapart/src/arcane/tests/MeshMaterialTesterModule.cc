@@ -17,6 +17,7 @@
 #include "arcane/utils/OStringStream.h"
 #include "arcane/utils/ValueChecker.h"
 #include "arcane/utils/SimdOperation.h"
+#include "arcane/utils/ValueConvert.h"
 
 #include "arcane/IUnitTest.h"
 #include "arcane/ITimeLoopMng.h"
@@ -51,9 +52,18 @@
 #include "arcane/materials/EnvCellVector.h"
 #include "arcane/materials/MatConcurrency.h"
 #include "arcane/materials/MeshMaterialIndirectModifier.h"
+#include "arcane/materials/MeshMaterialBackup.h"
 #include "arcane/materials/MeshMaterialVariableSynchronizerList.h"
 #include "arcane/materials/ComponentSimd.h"
 #include "arcane/materials/MeshMaterialInfo.h"
+#include "arcane/materials/CellCentricMaterialIndex.h"
+#include "arcane/materials/CellCentricMaterialVariable.h"
+#include "arcane/materials/internal/MeshMaterialModifierImpl.h"
+#include "arcane/materials/internal/MeshMaterialVariableIndexer.h"
+#include "arcane/core/materials/internal/IMeshMaterialMngInternal.h"
+
+#include "arcane/accelerator/core/Runner.h"
+#include "arcane/accelerator/core/RunQueue.h"
 
 #include "arcane/tests/ArcaneTestGlobal.h"
 #include "arcane/tests/IMaterialEquationOfState.h"
@@ -125,6 +135,8 @@ class MeshMaterialTesterModule
   MaterialVariableCellInt32 m_mat_int32;
   //! Variable pour tester la bonne prise en compte de setUsed(false)
   MaterialVariableCellReal m_mat_not_used_real;
+  //! Variable pour tester l'allocation à la demande des valeurs partielles
+  MaterialVariableCellReal m_mat_on_demand;
   VariableScalarInt64 m_nb_starting_cell; //<! Nombre de mailles au démarrage
   IMeshMaterial* m_mat1;
   IMeshMaterial* m_mat2;
@@ -135,6 +147,12 @@ class MeshMaterialTesterModule
   // Si non nul, indique qu'il faut vérifier les valeurs spectral
   // car on a fait un repartitionnement
   Integer m_check_spectral_values_iteration;
+  //! Indique s'il faut vérifier que les modifications utilisent le multi-thread
+  bool m_check_modifier_multi_thread = false;
+  //! Indique s'il faut vérifier la défragmentation des valeurs partielles
+  bool m_check_defragment = false;
+  //! Indique s'il faut vérifier l'allocation à la demande des valeurs partielles
+  bool m_check_allocate_on_demand = false;
  private:
 
   void _computeDensity();
@@ -167,6 +185,7 @@ class MeshMaterialTesterModule
   _setOrCheckSpectralValues2(VarType1& var_real,VarType2& var_int32,
                              VarType3& var_scalar_int32,Int64 iteration,bool is_check);
   void _checkFillPartialValues();
+  void _checkAllocatePartialValuesOnDemand(IMeshMaterial* mat);
   void _doSimd();
   template<typename VarType> void _checkFillPartialValuesHelper(VarType& mat_var);
   template<typename VarType>
@@ -182,6 +201,13 @@ class MeshMaterialTesterModule
   void _applyEos(bool is_init);
   void _testDumpProperties();
   void _checkNullComponentItem();
+  void _checkModifierMultiThread();
+  void _checkDefragment();
+  void _initAllocateOnDemand(bool is_continue);
+  void _setAllocateOnDemandValues();
+  void _checkAllocateOnDemandValues(const String& step);
+  void _checkAllocateOnDemand();
+  Real _onDemandValue(Cell cell) const { return 1.0 + static_cast<Real>(cell.uniqueId().asInt64()); }
 };
 
 /*---------------------------------------------------------------------------*/
@@ -201,6 +227,7 @@ MeshMaterialTesterModule(const ModuleBuildInfo& mbi)
 , m_present_material(VariableBuildInfo(this,"PresentMaterial"))
 , m_mat_int32(VariableBuildInfo(this,"PresentMaterial"))
 , m_mat_not_used_real(VariableBuildInfo(this,"NotUsedRealVariable"))
+, m_mat_on_demand(VariableBuildInfo(this,"MatOnDemand"))
 , m_nb_starting_cell(VariableBuildInfo(this,"NbStartingCell"))
 , m_mat1(nullptr)
 , m_mat2(nullptr)
@@ -208,6 +235,12 @@ MeshMaterialTesterModule(const ModuleBuildInfo& mbi)
 , m_mesh_partitioner(nullptr)
 , m_check_spectral_values_iteration(0)
 {
+  if (auto v = Convert::Type<Int32>::tryParseFromEnvironment("ARCANE_TEST_CHECK_MATERIAL_MODIFIER_MULTI_THREAD", true))
+    m_check_modifier_multi_thread = (v.value() != 0);
+  if (auto v = Convert::Type<Int32>::tryParseFromEnvironment("ARCANE_TEST_CHECK_MATERIAL_DEFRAGMENT", true))
+    m_check_defragment = (v.value() != 0);
+  if (auto v = Convert::Type<Int32>::tryParseFromEnvironment("ARCANE_TEST_CHECK_MATERIAL_ALLOCATE_ON_DEMAND", true))
+    m_check_allocate_on_demand = (v.value() != 0);
 }
 
 /*---------------------------------------------------------------------------*/
@@ -721,6 +754,7 @@ startInit()
   _applyEos(true);
   _testDumpProperties();
   _checkNullComponentItem();
+  _initAllocateOnDemand(false);
 }
 
 /*---------------------------------------------------------------------------*/
@@ -828,6 +862,7 @@ continueInit()
   _setDependencies();
   _dumpNoDumpRealValues();
   _initUnitTest();
+  _initAllocateOnDemand(true);
 }
 
 /*---------------------------------------------------------------------------*/
@@ -1687,6 +1722,8 @@ compute()
   if (m_mat2)
     _checkFillArrayFromTo(m_mat2,mat_pressure);
 
+  _checkAllocatePartialValuesOnDemand(m_mat1);
+
   ENUMERATE_ENV(ienv,m_material_mng){
     IMeshEnvironment* env = *ienv;
     ENUMERATE_ENVCELL(ienvcell,env){
@@ -1707,6 +1744,9 @@ compute()
     }
   }
   _computeDensity();
+  _checkModifierMultiThread();
+  _checkDefragment();
+  _checkAllocateOnDemand();
   _checkArrayVariableSynchronize();
 
   for( Integer i=0, n=m_material_mng->materials().size(); i<n; ++i ){
@@ -1795,6 +1835,316 @@ compute()
   }
 }
 
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+/*!
+ * \brief Vérifie que les modifications incrémentales ont utilisé le
+ * mode multi-thread de MeshMaterialModifier.
+ */
+void MeshMaterialTesterModule::
+_checkModifierMultiThread()
+{
+  if (!m_check_modifier_multi_thread)
+    return;
+  Int32 nb_mt = m_material_mng->_internalApi()->modifier()->nbOptimizeMultiThread();
+  info() << "Check modifier multi-thread nb_optimize_multi_thread=" << nb_mt;
+  if (nb_mt == 0)
+    ARCANE_FATAL("No material modification has been done with the multi-thread mode");
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+/*!
+ * \brief Vérifie la défragmentation des valeurs partielles.
+ *
+ * Vérifie d'abord que la défragmentation automatique effectuée lors des
+ * modifications a laissé chaque indexeur avec un taux de fragmentation
+ * inférieur au seuil. Défragmente ensuite explicitement toutes les valeurs
+ * partielles et vérifie que chaque indexeur n'a plus de trou, est trié
+ * suivant le localId() des mailles et que les valeurs sont conservées.
+ *
+ * Vérifie aussi qu'un CellCentricMaterialIndex calculé avant la
+ * défragmentation est bien mis à jour et donne les bonnes valeurs.
+ */
+void MeshMaterialTesterModule::
+_checkDefragment()
+{
+  if (!m_check_defragment)
+    return;
+
+  IMeshMaterialMngInternal* mm_internal = m_material_mng->_internalApi();
+  Real threshold = mm_internal->modifier()->defragmentThreshold();
+  if (threshold > 0.0) {
+    for (MeshMaterialVariableIndexer* var_indexer : mm_internal->variablesIndexer()) {
+      Real ratio = var_indexer->fragmentationInfo().ratio();
+      if (ratio > threshold)
+        ARCANE_FATAL("Indexer '{0}' has not been defragmented ratio={1} threshold={2}",
+                     var_indexer->name(), ratio, threshold);
+    }
+  }
+
+  // Sauve les valeurs de chaque constituant, indexées par le localId() de la maille.
+  Int32 max_local_id = defaultMesh()->cellFamily()->maxLocalId();
+  ConstArrayView<IMeshComponent*> components = m_material_mng->components();
+  Int32 nb_component = components.size();
+  UniqueArray<UniqueArray<Real>> density_values(nb_component);
+  UniqueArray<UniqueArray<Int32>> env_int32_values(nb_component);
+  UniqueArray<Int32> nb_cells(nb_component);
+  for (Int32 i = 0; i < nb_component; ++i) {
+    IMeshComponent* component = components[i];
+    density_values[i].resize(max_local_id, -1.0);
+    env_int32_values[i].resize(max_local_id, -1);
+    nb_cells[i] = component->cells().size();
+    ENUMERATE_COMPONENTCELL (icc, component) {
+      ComponentCell cc = *icc;
+      Int32 lid = cc.globalCell().localId();
+      density_values[i][lid] = m_mat_density[cc];
+      if (component->isEnvironment())
+        env_int32_values[i][lid] = m_env_int32[cc];
+    }
+  }
+
+  // Index 'centré maille' calculé avant la défragmentation. Il doit être
+  // recalculé si des valeurs partielles ont été déplacées.
+  CellCentricMaterialIndex cc_index(m_material_mng);
+  cc_index.update();
+  bool is_fragmented = false;
+  for (MeshMaterialVariableIndexer* var_indexer : mm_internal->variablesIndexer()) {
+    MeshMaterialVariableIndexer::FragmentationInfo fi = var_indexer->fragmentationInfo();
+    if (fi.nb_item != 0 && fi.ratio() > 0.0)
+      is_fragmented = true;
+  }
+
+  m_material_mng->defragmentPartialValues();
+
+  if (cc_index.update() != is_fragmented)
+    ARCANE_FATAL("Bad update of the cell-centric index after defragmentation is_fragmented={0}",
+                 is_fragmented);
+
+  for (MeshMaterialVariableIndexer* var_indexer : mm_internal->variablesIndexer()) {
+    MeshMaterialVariableIndexer::FragmentationInfo fi = var_indexer->fragmentationInfo();
+    info(4) << "CheckDefragment indexer=" << var_indexer->name() << " nb_item=" << fi.nb_item
+            << " nb_hole=" << fi.nb_hole << " nb_unordered=" << fi.nb_unordered;
+    if (fi.nb_hole != 0 || fi.nb_unordered != 0)
+      ARCANE_FATAL("Indexer '{0}' is fragmented after defragmentation nb_hole={1} nb_unordered={2}",
+                   var_indexer->name(), fi.nb_hole, fi.nb_unordered);
+    ConstArrayView<Int32> local_ids = var_indexer->localIds();
+    for (Int32 z = 1, n = local_ids.size(); z < n; ++z)
+      if (local_ids[z] <= local_ids[z - 1])
+        ARCANE_FATAL("Indexer '{0}' is not sorted by localId index={1}", var_indexer->name(), z);
+  }
+
+  Int32 nb_error = 0;
+  for (Int32 i = 0; i < nb_component; ++i) {
+    IMeshComponent* component = components[i];
+    if (component->cells().size() != nb_cells[i])
+      ARCANE_FATAL("Bad number of cells for '{0}' after defragmentation v={1} expected={2}",
+                   component->name(), component->cells().size(), nb_cells[i]);
+    ENUMERATE_COMPONENTCELL (icc, component) {
+      ComponentCell cc = *icc;
+      Int32 lid = cc.globalCell().localId();
+      bool is_bad = (m_mat_density[cc] != density_values[i][lid]);
+      if (component->isEnvironment() && m_env_int32[cc] != env_int32_values[i][lid])
+        is_bad = true;
+      if (is_bad) {
+        if (nb_error < 10)
+          info() << "Bad value after defragmentation component=" << component->name()
+                 << " cell_lid=" << lid << " density=" << m_mat_density[cc]
+                 << " expected=" << density_values[i][lid];
+        ++nb_error;
+      }
+    }
+  }
+  if (nb_error != 0)
+    ARCANE_FATAL("Bad values after defragmentation nb_error={0}", nb_error);
+
+  // Vérifie les valeurs des matériaux lues via le rangement 'centré maille'.
+  ConstArrayView<IMeshMaterial*> materials = m_material_mng->materials();
+  UniqueArray<Int32> mat_component_index(materials.size(), -1);
+  for (Int32 i = 0; i < nb_component; ++i)
+    for (IMeshMaterial* mat : materials)
+      if (components[i] == mat)
+        mat_component_index[mat->id()] = i;
+
+  Accelerator::Runner runner(Accelerator::eExecutionPolicy::Sequential);
+  Accelerator::RunQueue queue(makeQueue(runner));
+  CellCentricMaterialVariableScalar<Real> cc_density(&cc_index, m_mat_density);
+  cc_density.setUseCompanionBuffer(true);
+  cc_density.gather(queue);
+  SmallSpan<const Int32> cells_offset = cc_index.cellsOffset();
+  SmallSpan<const Int16> materials_id = cc_index.materialsId();
+  SmallSpan<const Real> cc_values = cc_density.values();
+  ENUMERATE_CELL (icell, allCells()) {
+    Int32 lid = icell.itemLocalId();
+    for (Int32 k = cells_offset[lid]; k < cells_offset[lid + 1]; ++k) {
+      Real expected = density_values[mat_component_index[materials_id[k]]][lid];
+      if (cc_values[k] != expected) {
+        if (nb_error < 10)
+          info() << "Bad cell-centric value after defragmentation cell_lid=" << lid
+                 << " mat_id=" << materials_id[k] << " v=" << cc_values[k]
+                 << " expected=" << expected;
+        ++nb_error;
+      }
+    }
+  }
+  if (nb_error != 0)
+    ARCANE_FATAL("Bad cell-centric values after defragmentation nb_error={0}", nb_error);
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+/*!
+ * \brief Active l'allocation à la demande pour la variable 'MatOnDemand'.
+ *
+ * Seules les valeurs partielles de \a m_mat1 sont allouées. En reprise,
+ * vérifie que seules ces valeurs ont été relues.
+ */
+void MeshMaterialTesterModule::
+_initAllocateOnDemand(bool is_continue)
+{
+  if (!m_check_allocate_on_demand)
+    return;
+  info() << "Init allocation on demand of partial values is_continue=" << is_continue;
+  IMeshMaterialVariable* mat_var = m_mat_on_demand.materialVariable();
+  mat_var->setAllocatePartialValuesOnDemand(true);
+  if (is_continue){
+    _checkAllocateOnDemandValues("continue");
+    return;
+  }
+  mat_var->allocatePartialValues(m_mat1);
+  _setAllocateOnDemandValues();
+  _checkAllocateOnDemandValues("init");
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+void MeshMaterialTesterModule::
+_setAllocateOnDemandValues()
+{
+  ENUMERATE_CELL(icell,allCells()){
+    m_mat_on_demand[icell] = _onDemandValue(*icell);
+  }
+  ENUMERATE_MATCELL(imatcell,m_mat1){
+    MatCell mc = *imatcell;
+    m_mat_on_demand[mc] = _onDemandValue(mc.globalCell());
+  }
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+/*!
+ * \brief Vérifie que seules les valeurs partielles de \a m_mat1 sont
+ * allouées et que leurs valeurs sont correctes.
+ */
+void MeshMaterialTesterModule::
+_checkAllocateOnDemandValues(const String& step)
+{
+  IMeshMaterialVariable* mat_var = m_mat_on_demand.materialVariable();
+  ENUMERATE_COMPONENT(ic,m_material_mng->components()){
+    IMeshComponent* component = *ic;
+    bool is_allocated = mat_var->hasPartialValues(component);
+    if (is_allocated != (component==m_mat1))
+      ARCANE_FATAL("Bad allocation state for partial values step={0} component={1} is_allocated={2}",
+                   step,component->name(),is_allocated);
+  }
+
+  // Les mailles ajoutées à m_mat1 sont initialisées avec la valeur globale
+  // ou avec zéro.
+  bool is_zero_init = m_material_mng->isDataInitialisationWithZero();
+  Integer nb_error = 0;
+  ENUMERATE_MATCELL(imatcell,m_mat1){
+    MatCell mc = *imatcell;
+    Real value = m_mat_on_demand[mc];
+    Real expected_value = _onDemandValue(mc.globalCell());
+    if (value==expected_value || (is_zero_init && value==0.0))
+      continue;
+    ++nb_error;
+    if (nb_error<10)
+      info() << "Bad value for allocation on demand step=" << step
+             << " cell=" << ItemPrinter(mc.globalCell())
+             << " value=" << value << " expected=" << expected_value;
+  }
+  if (nb_error!=0)
+    ARCANE_FATAL("Bad values for allocation on demand step={0} nb_error={1}",step,nb_error);
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+/*!
+ * \brief Vérifie l'allocation à la demande des valeurs partielles.
+ *
+ * Vérifie que les modifications des matériaux (qui ajoutent ou suppriment
+ * des mailles dans des composants non alloués), l'équilibrage de charge,
+ * la synchronisation et la sauvegarde via MeshMaterialBackup conservent
+ * l'état d'allocation et les valeurs.
+ */
+void MeshMaterialTesterModule::
+_checkAllocateOnDemand()
+{
+  if (!m_check_allocate_on_demand)
+    return;
+  info() << "Check allocation on demand of partial values";
+
+  _checkAllocateOnDemandValues("update");
+  _setAllocateOnDemandValues();
+
+  // Modifie les valeurs des mailles fantômes et vérifie que la
+  // synchronisation les remet à jour.
+  ENUMERATE_MATCELL(imatcell,m_mat1){
+    MatCell mc = *imatcell;
+    if (!mc.globalCell().isOwn())
+      m_mat_on_demand[mc] = -1.0;
+  }
+  m_mat_on_demand.synchronize();
+  _checkAllocateOnDemandValues("synchronize");
+
+  // Vérifie la sauvegarde et la restauration des valeurs.
+  {
+    MeshMaterialBackup backup(m_material_mng,false);
+    backup.saveValues();
+    ENUMERATE_MATCELL(imatcell,m_mat1){
+      m_mat_on_demand[imatcell] = -2.0;
+    }
+    backup.restoreValues();
+  }
+  _checkAllocateOnDemandValues("backup");
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+void MeshMaterialTesterModule::
+_checkAllocatePartialValuesOnDemand(IMeshMaterial* mat)
+{
+  ValueChecker vc(A_FUNCINFO);
+  info() << "Check allocation on demand of partial values mat=" << mat->name();
+
+  MaterialVariableCellReal var(MaterialVariableBuildInfo(m_material_mng,"TestVarOnDemand"));
+  IMeshMaterialVariable* mat_var = var.materialVariable();
+  mat_var->setAllocatePartialValuesOnDemand(true);
+  vc.areEqual(mat_var->hasPartialValues(mat),false,"Partial values allocated (1)");
+
+  // L'appel à fillFromArray() doit allouer les valeurs partielles.
+  RealUniqueArray values(mat->cells().size());
+  for( Integer i=0, n=values.size(); i<n; ++i )
+    values[i] = 2.0 + static_cast<Real>(i);
+  var.fillFromArray(mat,values);
+  vc.areEqual(mat_var->hasPartialValues(mat),true,"Partial values not allocated");
+  Integer index = 0;
+  ENUMERATE_MATCELL(imatcell,mat){
+    vc.areEqual(values[index],var[imatcell],"Bad value for allocation on demand");
+    ++index;
+  }
+
+  mat_var->releasePartialValues(mat);
+  vc.areEqual(mat_var->hasPartialValues(mat),false,"Partial values allocated (2)");
+
+  // En désactivant le mode, toutes les valeurs partielles sont allouées.
+  mat_var->setAllocatePartialValuesOnDemand(false);
+  vc.areEqual(mat_var->hasPartialValues(mat),true,"Partial values not allocated (2)");
+}
+
 /*---------------------------------------------------------------------------*/
 /*---------------------------------------------------------------------------*/
 
@@ -0,0 +1,32 @@
+﻿#
+# Find the 'zstd' includes and library
+#
+# This module defines
+# ZSTD_INCLUDE_DIR, where to find headers,
+# ZSTD_LIBRARIES, the libraries to link against to use zstd.
+# ZSTD_FOUND, If false, do not try to use zstd.
+
+arccon_return_if_package_found(Zstd)
+
+# Il n'y a pas de find_package correspondant à 'Zstd' dans 'CMake'
+find_library(ZSTD_LIBRARY zstd)
+find_path(ZSTD_INCLUDE_DIR zstd.h)
+
+message(STATUS "ZSTD_INCLUDE_DIR = ${ZSTD_INCLUDE_DIR}")
+message(STATUS "ZSTD_LIBRARY     = ${ZSTD_LIBRARY}")
+
+set(ZSTD_FOUND FALSE)
+if(ZSTD_INCLUDE_DIR AND ZSTD_LIBRARY)
+  set(ZSTD_FOUND TRUE)
+  set(ZSTD_LIBRARIES ${ZSTD_LIBRARY} )
+  set(ZSTD_INCLUDE_DIRS ${ZSTD_INCLUDE_DIR})
+endif()
+
+arccon_register_package_library(Zstd ZSTD)
+
+# ----------------------------------------------------------------------------
+# Local Variables:
+# tab-width: 2
+# indent-tabs-mode: nil
+# coding: utf-8-with-signature
+# End:
@@ -162,8 +162,10 @@ class ARCANE_ACCELERATOR_EXPORT DeviceStorageBase
 /*!
  * \internal
  * \brief Gère l'allocation interne sur le device pour un type donné.
+ *
+ * L'instance contient \a N valeurs de type \a DataType.
  */
-template <typename DataType>
+template <typename DataType, Int32 N = 1>
 class DeviceStorage
 : public DeviceStorageBase
 {
@@ -177,7 +179,7 @@ class DeviceStorage
   size_t size() const { return m_storage.size(); }
   DataType* allocate()
   {
-    m_storage.allocate(sizeof(DataType));
+    m_storage.allocate(sizeof(DataType) * N);
     return address();
   }
   void deallocate() { m_storage.deallocate(); }
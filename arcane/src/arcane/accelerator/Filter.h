@@ -23,6 +23,7 @@
 
 #include "arcane/accelerator/AcceleratorGlobal.h"
 #include "arcane/accelerator/CommonUtils.h"
+#include "arcane/accelerator/MultiThreadAlgo.h"
 #include "arcane/accelerator/RunCommandLaunchInfo.h"
 #include "arcane/accelerator/RunCommandLoop.h"
 #include "arcane/accelerator/ScanImpl.h"
@@ -293,9 +294,17 @@ class GenericFilteringFlag
       SyclGenericFilteringImpl::apply(s, nb_item, iter2, out, filter_lambda);
     } break;
 #endif
-    case eExecutionPolicy::Thread:
-      // Pas encore implémenté en multi-thread
-      [[fallthrough]];
+    case eExecutionPolicy::Thread: {
+      // Utilise les options de boucle associées à la file.
+      RunCommand command = makeCommand(*queue);
+      impl::RunCommandLaunchInfo launch_info(command, nb_item);
+      launch_info.beginExecute();
+      MultiThreadAlgo algo(launch_info.computeParallelLoopOptions());
+      auto select_lambda = [=](Int32 input_index) -> bool { return flag[input_index] != 0; };
+      auto setter_lambda = [=](Int32 input_index, Int32 output_index) { output[output_index] = input[input_index]; };
+      s.m_host_nb_out_storage[0] = algo.doFilter(nb_item, select_lambda, setter_lambda);
+      launch_info.endExecute();
+    } break;
     case eExecutionPolicy::Sequential: {
       Int32 index = 0;
       for (Int32 i = 0; i < nb_item; ++i) {
@@ -378,9 +387,12 @@ class GenericFilteringIf
       SyclGenericFilteringImpl::apply(s, nb_item, input_iter, output_iter, select_lambda);
     } break;
 #endif
-    case eExecutionPolicy::Thread:
-      // Pas encore implémenté en multi-thread
-      [[fallthrough]];
+    case eExecutionPolicy::Thread: {
+      MultiThreadAlgo algo(launch_info.computeParallelLoopOptions());
+      auto select_index_lambda = [&](Int32 input_index) -> bool { return select_lambda(input_iter[input_index]); };
+      auto setter_lambda = [&](Int32 input_index, Int32 output_index) { output_iter[output_index] = input_iter[input_index]; };
+      s.m_host_nb_out_storage[0] = algo.doFilter(nb_item, select_index_lambda, setter_lambda);
+    } break;
     case eExecutionPolicy::Sequential: {
       Int32 index = 0;
       for (Int32 i = 0; i < nb_item; ++i) {
@@ -20,10 +20,18 @@
 #include "arcane/core/materials/MeshMaterialVariableRef.h"
 #include "arcane/core/materials/MeshEnvironmentVariableRef.h"
 #include "arcane/core/materials/MatItem.h"
+#include "arcane/core/materials/SimdMatVarIndex.h"
+#include "arcane/core/SimdItem.h"
 
 /*---------------------------------------------------------------------------*/
 /*---------------------------------------------------------------------------*/
 
+namespace Arcane::Materials
+{
+template <typename DataType>
+class CellCentricMaterialVariableScalar;
+}
+
 using namespace Arcane;
 using namespace Arcane::Materials;
 
@@ -52,7 +60,9 @@ class MatVariableViewBase
 /*---------------------------------------------------------------------------*/
 /*!
  * \brief Vue en lecture sur une variable scalaire du maillage.
- * TODO: Faut-il rajouter la gestion des SIMD comme dans ItemVariableScalarInViewT ?
+ *
+ * L'accès via un SimdMatVarIndex n'est disponible que sur l'hôte et
+ * effectue un 'gather' des valeurs.
  */
 template<typename ItemType,typename DataType>
 class MatItemVariableScalarInViewT
@@ -85,6 +95,14 @@ class MatItemVariableScalarInViewT
     return this->m_value[0][item.localId()];
   }
 
+  //! Opérateur d'accès vectoriel avec indirection (uniquement sur l'hôte).
+  typename SimdTypeTraits<DataType>::SimdType
+  operator[](const SimdMatVarIndex& mvi) const
+  {
+    using SimdType = typename SimdTypeTraits<DataType>::SimdType;
+    return SimdType(this->m_value[mvi.arrayIndex()].data(), mvi.valueIndex());
+  }
+
   //! Opérateur d'accès pour l'entité \a item
   ARCCORE_HOST_DEVICE const DataType& value(ComponentItemLocalId mvi) const
   {
@@ -118,7 +136,9 @@ class MatItemVariableArrayInViewT
 /*---------------------------------------------------------------------------*/
 /*!
  * \brief Vue en écriture sur une variable scalaire du maillage.
- * TODO: Faut il rajouter la gestion des types SIMD comme dans ItemVariableScalarOutViewT ?
+ *
+ * L'accès via un SimdMatVarIndex n'est disponible que sur l'hôte et
+ * effectue un 'scatter' des valeurs.
  */
 template<typename ItemType,typename Accessor>
 class MatItemVariableScalarOutViewT
@@ -140,6 +160,9 @@ class MatItemVariableScalarOutViewT
   //! Opérateur d'accès pour l'entité \a item
   ARCCORE_HOST_DEVICE Accessor operator[](ComponentItemLocalId lid) const
   {
+    // Détecte notamment l'écriture dans les valeurs partielles d'un composant
+    // non alloué (voir IMeshMaterialVariable::setAllocatePartialValuesOnDemand()).
+    ARCANE_CHECK_AT(lid.localId().valueIndex(),this->m_value[lid.localId().arrayIndex()].size());
     return Accessor(this->m_value[lid.localId().arrayIndex()].data()+lid.localId().valueIndex());
   }
 
@@ -155,9 +178,16 @@ class MatItemVariableScalarOutViewT
     return Accessor(this->m_value[0].data() + item.localId());
   }
 
+  //! Opérateur d'accès vectoriel avec indirection (uniquement sur l'hôte).
+  SimdSetter<DataType> operator[](const SimdMatVarIndex& mvi) const
+  {
+    return SimdSetter<DataType>(this->m_value[mvi.arrayIndex()].data(), mvi.valueIndex());
+  }
+
   //! Opérateur d'accès pour l'entité \a item
   ARCCORE_HOST_DEVICE Accessor value(ComponentItemLocalId lid) const
   {
+    ARCANE_CHECK_AT(lid.localId().valueIndex(),this->m_value[lid.localId().arrayIndex()].size());
     return Accessor(this->m_value[lid.localId().arrayIndex()].data()+lid.localId().valueIndex());
   }
 
@@ -249,6 +279,228 @@ viewIn(RunCommand& cmd,const CellEnvironmentVariableScalarRef<DataType>& var)
   return MatItemVariableScalarInViewT<Cell,DataType>(cmd, var.materialVariable(),var._internalValue());
 }
 
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+/*!
+ * \brief Classe de base des vues 'centrées maille' sur les variables
+ * matériaux (CellCentricMaterialVariableScalar).
+ *
+ * Les valeurs des matériaux de la maille \a cid sont accessibles par
+ * l'opérateur (cid,i) avec \a i compris entre 0 et nbMaterial(cid).
+ *
+ * Si la variable utilise un tampon compagnon (ce qui est le cas par
+ * défaut, voir CellCentricMaterialVariableScalar::setUseCompanionBuffer()),
+ * les valeurs sont lues dans ce tampon où elles sont contigües en mémoire.
+ * Sinon, elles sont accédées directement dans la variable via leur
+ * MatVarIndex.
+ *
+ * L'index associé à la variable est mis à jour lors de la création de la
+ * vue si les matériaux ont été modifiés.
+ */
+class CellCentricMatVariableViewBase
+{
+ public:
+
+  CellCentricMatVariableViewBase(RunCommand&, SmallSpan<const Int32> cells_offset,
+                                 SmallSpan<const Int16> materials_id,
+                                 SmallSpan<const MatVarIndex> matvar_indexes)
+  : m_cells_offset(cells_offset)
+  , m_materials_id(materials_id)
+  , m_matvar_indexes(matvar_indexes)
+  {}
+
+ public:
+
+  //! Nombre de matériaux de la maille \a cid
+  ARCCORE_HOST_DEVICE Int32 nbMaterial(CellLocalId cid) const
+  {
+    return m_cells_offset[cid.localId() + 1] - m_cells_offset[cid.localId()];
+  }
+
+  //! Indice de la première valeur de la maille \a cid
+  ARCCORE_HOST_DEVICE Int32 firstIndex(CellLocalId cid) const
+  {
+    return m_cells_offset[cid.localId()];
+  }
+
+  //! Identifiant du \a i-ème matériau de la maille \a cid
+  ARCCORE_HOST_DEVICE Int32 materialId(CellLocalId cid, Int32 i) const
+  {
+    return m_materials_id[m_cells_offset[cid.localId()] + i];
+  }
+
+ protected:
+
+  ARCCORE_HOST_DEVICE MatVarIndex _matVarIndex(CellLocalId cid, Int32 i) const
+  {
+    return m_matvar_indexes[m_cells_offset[cid.localId()] + i];
+  }
+
+ private:
+
+  SmallSpan<const Int32> m_cells_offset;
+  SmallSpan<const Int16> m_materials_id;
+  SmallSpan<const MatVarIndex> m_matvar_indexes;
+};
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+/*!
+ * \brief Vue en lecture 'centrée maille' sur une variable matériau scalaire.
+ */
+template <typename DataType>
+class CellCentricMatVariableScalarInViewT
+: public CellCentricMatVariableViewBase
+{
+ public:
+
+  CellCentricMatVariableScalarInViewT(RunCommand& cmd, SmallSpan<const Int32> cells_offset,
+                                      SmallSpan<const Int16> materials_id,
+                                      SmallSpan<const MatVarIndex> matvar_indexes,
+                                      SmallSpan<const DataType> values,
+                                      const ArrayView<DataType>* var_values, bool use_companion)
+  : CellCentricMatVariableViewBase(cmd, cells_offset, materials_id, matvar_indexes)
+  , m_values(values)
+  , m_var_values(var_values)
+  , m_use_companion(use_companion)
+  {}
+
+ public:
+
+  //! Valeur du \a i-ème matériau de la maille \a cid
+  ARCCORE_HOST_DEVICE const DataType& operator()(CellLocalId cid, Int32 i) const
+  {
+    if (m_use_companion)
+      return m_values[firstIndex(cid) + i];
+    MatVarIndex mvi = _matVarIndex(cid, i);
+    return m_var_values[mvi.arrayIndex()][mvi.valueIndex()];
+  }
+
+  /*!
+   * \brief Valeurs des matériaux de la maille \a cid.
+   *
+   * N'est valide que si la variable utilise un tampon compagnon.
+   */
+  ARCCORE_HOST_DEVICE SmallSpan<const DataType> values(CellLocalId cid) const
+  {
+    return m_values.subSpan(firstIndex(cid), nbMaterial(cid));
+  }
+
+ private:
+
+  SmallSpan<const DataType> m_values;
+  const ArrayView<DataType>* m_var_values = nullptr;
+  bool m_use_companion = false;
+};
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+/*!
+ * \brief Vue en écriture 'centrée maille' sur une variable matériau scalaire.
+ */
+template <typename Accessor>
+class CellCentricMatVariableScalarOutViewT
+: public CellCentricMatVariableViewBase
+{
+ private:
+
+  using DataType = typename Accessor::ValueType;
+
+ public:
+
+  CellCentricMatVariableScalarOutViewT(RunCommand& cmd, SmallSpan<const Int32> cells_offset,
+                                       SmallSpan<const Int16> materials_id,
+                                       SmallSpan<const MatVarIndex> matvar_indexes,
+                                       SmallSpan<DataType> values,
+                                       ArrayView<DataType>* var_values, bool use_companion)
+  : CellCentricMatVariableViewBase(cmd, cells_offset, materials_id, matvar_indexes)
+  , m_values(values)
+  , m_var_values(var_values)
+  , m_use_companion(use_companion)
+  {}
+
+ public:
+
+  //! Valeur du \a i-ème matériau de la maille \a cid
+  ARCCORE_HOST_DEVICE Accessor operator()(CellLocalId cid, Int32 i) const
+  {
+    if (m_use_companion)
+      return Accessor(m_values.data() + firstIndex(cid) + i);
+    MatVarIndex mvi = _matVarIndex(cid, i);
+    ARCANE_CHECK_AT(mvi.valueIndex(), m_var_values[mvi.arrayIndex()].size());
+    return Accessor(m_var_values[mvi.arrayIndex()].data() + mvi.valueIndex());
+  }
+
+  /*!
+   * \brief Valeurs des matériaux de la maille \a cid.
+   *
+   * N'est valide que si la variable utilise un tampon compagnon.
+   */
+  ARCCORE_HOST_DEVICE SmallSpan<DataType> values(CellLocalId cid) const
+  {
+    return m_values.subSpan(firstIndex(cid), nbMaterial(cid));
+  }
+
+ private:
+
+  SmallSpan<DataType> m_values;
+  ArrayView<DataType>* m_var_values = nullptr;
+  bool m_use_companion = false;
+};
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+/*!
+ * \brief Vue en lecture 'centrée maille' pour les variables matériaux
+ * scalaires.
+ */
+template <typename DataType> auto
+viewIn(RunCommand& cmd, const CellCentricMaterialVariableScalar<DataType>& var)
+{
+  var._internalUpdateForView();
+  auto* index = var.index();
+  return CellCentricMatVariableScalarInViewT<DataType>(cmd, index->cellsOffset(), index->materialsId(),
+                                                       index->matVarIndexes(), var.values(),
+                                                       var.variable()._internalValue(),
+                                                       var.isUseCompanionBuffer());
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+/*!
+ * \brief Vue en écriture 'centrée maille' pour les variables matériaux
+ * scalaires.
+ */
+template <typename DataType> auto
+viewOut(RunCommand& cmd, CellCentricMaterialVariableScalar<DataType>& var)
+{
+  using Accessor = DataViewSetter<DataType>;
+  var._internalUpdateForView();
+  auto* index = var.index();
+  return CellCentricMatVariableScalarOutViewT<Accessor>(cmd, index->cellsOffset(), index->materialsId(),
+                                                        index->matVarIndexes(), var.values(),
+                                                        var.variable()._internalValue(),
+                                                        var.isUseCompanionBuffer());
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+/*!
+ * \brief Vue en lecture/écriture 'centrée maille' pour les variables
+ * matériaux scalaires.
+ */
+template <typename DataType> auto
+viewInOut(RunCommand& cmd, CellCentricMaterialVariableScalar<DataType>& var)
+{
+  using Accessor = DataViewGetterSetter<DataType>;
+  var._internalUpdateForView();
+  auto* index = var.index();
+  return CellCentricMatVariableScalarOutViewT<Accessor>(cmd, index->cellsOffset(), index->materialsId(),
+                                                        index->matVarIndexes(), var.values(),
+                                                        var.variable()._internalValue(),
+                                                        var.isUseCompanionBuffer());
+}
+
 /*---------------------------------------------------------------------------*/
 /*---------------------------------------------------------------------------*/
 
@@ -0,0 +1,433 @@
+﻿// -*- tab-width: 2; indent-tabs-mode: nil; coding: utf-8-with-signature -*-
+//-----------------------------------------------------------------------------
+// Copyright 2000-2024 CEA (www.cea.fr) IFPEN (www.ifpenergiesnouvelles.com)
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: Apache-2.0
+//-----------------------------------------------------------------------------
+/*---------------------------------------------------------------------------*/
+/* MultiThreadAlgo.h                                           (C) 2000-2024 */
+/*                                                                           */
+/* Implémentation des algorithmes accélérateurs en mode multi-thread.        */
+/*---------------------------------------------------------------------------*/
+#ifndef ARCANE_ACCELERATOR_MULTITHREADALGO_H
+#define ARCANE_ACCELERATOR_MULTITHREADALGO_H
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+#include "arcane/utils/ConcurrencyUtils.h"
+#include "arcane/utils/SmallArray.h"
+
+#include "arcane/accelerator/AcceleratorGlobal.h"
+
+#include <algorithm>
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+namespace Arcane::Accelerator::impl
+{
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+/*!
+ * \internal
+ * \brief Algorithmes avancés (filtrage, scan, partitionnement) en mode multi-thread.
+ *
+ * Les algorithmes de cette classe découpent l'intervalle d'itération en
+ * blocs contigus de taille identique (à l'exception du dernier).
+ * Le découpage ne dépend que du nombre d'éléments et du nombre de threads
+ * et pas de l'ordonnancement des tâches. Le résultat est donc reproductible
+ * d'une exécution à l'autre. Il est identique à celui de l'algorithme
+ * séquentiel sauf pour le scan avec un opérateur qui n'est pas exactement
+ * associatif (par exemple une somme de réels).
+ *
+ * Les blocs sont traités via TaskFactory::executeParallelFor().
+ *
+ * Comme pour les implémentations accélérateur, les valeurs en entrée et en
+ * sortie ne doivent pas se chevaucher.
+ */
+class MultiThreadAlgo
+{
+ public:
+
+  //! Taille minimale d'un bloc pour éviter de paralléliser des petites boucles
+  static constexpr Int32 MIN_BLOCK_SIZE = 2048;
+
+  //! Nombre de blocs par thread pour équilibrer la charge
+  static constexpr Int32 NB_BLOCK_PER_THREAD = 4;
+
+  //! Taille (en octet) des valeurs d'un bloc pour le scan
+  static constexpr Int64 SCAN_BLOCK_BYTE_SIZE = 256 * 1024;
+
+ public:
+
+  explicit MultiThreadAlgo(const ParallelLoopOptions& options)
+  : m_options(options)
+  {
+    m_options.mergeUnsetValues(TaskFactory::defaultParallelLoopOptions());
+  }
+
+ public:
+
+  /*!
+   * \brief Filtrage.
+   *
+   * Applique le filtrage sur les \a nb_value éléments. Pour chaque index
+   * \a i pour lequel `select_lambda(i)` est vrai, appelle
+   * `setter_lambda(i,output_index)` avec \a output_index la position
+   * de l'élément dans la liste filtrée. L'ordre des éléments est conservé.
+   *
+   * L'algorithme se fait en deux passes: la première compte le nombre
+   * d'éléments sélectionnés par bloc, puis après un scan exclusif sur
+   * ces nombres, la seconde recopie les éléments à leur position finale.
+   *
+   * Retourne le nombre d'éléments sélectionnés.
+   */
+  template <typename SelectLambda, typename SetterLambda>
+  Int32 doFilter(Int32 nb_value, const SelectLambda& select_lambda, const SetterLambda& setter_lambda)
+  {
+    const Int32 nb_block = _nbBlock(nb_value);
+    const Int32 block_size = _blockSize(nb_value, nb_block);
+
+    // Passe 1: Nombre d'éléments sélectionnés par bloc.
+    SmallArray<Int32> nb_selected_per_block(nb_block + 1);
+    auto count_func = [&](Int32 block_index) {
+      const Int32 begin_index = block_index * block_size;
+      const Int32 end_index = std::min(nb_value, begin_index + block_size);
+      Int32 nb_selected = 0;
+      for (Int32 i = begin_index; i < end_index; ++i)
+        if (select_lambda(i))
+          ++nb_selected;
+      nb_selected_per_block[block_index] = nb_selected;
+    };
+    _applyBlocks(nb_block, count_func);
+
+    // Scan exclusif sur le nombre d'éléments par bloc. Le nombre de blocs
+    // est petit donc on le fait en séquentiel.
+    Int32 nb_output = _exclusiveSum(nb_selected_per_block.span(), nb_block);
+
+    // Passe 2: Recopie les éléments sélectionnés.
+    auto copy_func = [&](Int32 block_index) {
+      const Int32 begin_index = block_index * block_size;
+      const Int32 end_index = std::min(nb_value, begin_index + block_size);
+      Int32 output_index = nb_selected_per_block[block_index];
+      for (Int32 i = begin_index; i < end_index; ++i)
+        if (select_lambda(i)) {
+          setter_lambda(i, output_index);
+          ++output_index;
+        }
+    };
+    _applyBlocks(nb_block, copy_func);
+
+    return nb_output;
+  }
+
+  /*!
+   * \brief Partitionnement en deux listes.
+   *
+   * Les valeurs de \a input_iter pour lesquelles \a select_lambda est vrai
+   * sont recopiées au début de \a output_iter dans l'ordre de l'entrée. Les
+   * autres valeurs sont recopiées à partir de la fin de \a output_iter dans
+   * l'ordre inverse de l'entrée. Le résultat est donc identique à celui de
+   * l'algorithme séquentiel.
+   *
+   * Comme pour le filtrage, une première passe compte le nombre d'éléments
+   * sélectionnés par bloc et un scan exclusif sur ces nombres donne la position
+   * de chaque bloc dans les deux listes.
+   *
+   * Retourne le nombre d'éléments de la première liste.
+   */
+  template <typename InputIterator, typename OutputIterator, typename SelectLambda>
+  Int32 doPartition(Int32 nb_value, InputIterator input_iter, OutputIterator output_iter,
+                    const SelectLambda& select_lambda)
+  {
+    const Int32 nb_block = _nbBlock(nb_value);
+    const Int32 block_size = _blockSize(nb_value, nb_block);
+
+    // Passe 1: Nombre d'éléments de la première liste par bloc.
+    SmallArray<Int32> nb_list1_per_block(nb_block);
+    auto count_func = [&](Int32 block_index) {
+      const Int32 begin_index = block_index * block_size;
+      const Int32 end_index = std::min(nb_value, begin_index + block_size);
+      Int32 nb_list1 = 0;
+      for (Int32 i = begin_index; i < end_index; ++i)
+        if (select_lambda(input_iter[i]))
+          ++nb_list1;
+      nb_list1_per_block[block_index] = nb_list1;
+    };
+    _applyBlocks(nb_block, count_func);
+
+    const Int32 nb_list1 = _exclusiveSum(nb_list1_per_block.span(), nb_block);
+
+    // Passe 2: Recopie les éléments dans les deux listes.
+    auto copy_func = [&](Int32 block_index) {
+      const Int32 begin_index = block_index * block_size;
+      const Int32 end_index = std::min(nb_value, begin_index + block_size);
+      Int32 list1_index = nb_list1_per_block[block_index];
+      // Le nombre d'éléments de la deuxième liste avant ce bloc est
+      // (begin_index - list1_index).
+      Int32 list2_index = nb_value - 1 - (begin_index - list1_index);
+      for (Int32 i = begin_index; i < end_index; ++i) {
+        auto v = input_iter[i];
+        if (select_lambda(v)) {
+          output_iter[list1_index] = v;
+          ++list1_index;
+        }
+        else {
+          output_iter[list2_index] = v;
+          --list2_index;
+        }
+      }
+    };
+    _applyBlocks(nb_block, copy_func);
+
+    return nb_list1;
+  }
+
+  /*!
+   * \brief Partitionnement en trois listes.
+   *
+   * Les valeurs de \a input_iter pour lesquelles \a select1_lambda est vrai
+   * sont recopiées dans \a first_output_iter. Parmi les autres valeurs,
+   * celles pour lesquelles \a select2_lambda est vrai sont recopiées dans
+   * \a second_output_iter et les valeurs restantes dans \a unselected_iter.
+   * Les trois listes conservent l'ordre de l'entrée.
+   *
+   * En retour, \a nb_parts[0] contient le nombre d'éléments de la première
+   * liste et \a nb_parts[1] le nombre d'éléments de la deuxième liste.
+   */
+  template <typename InputIterator, typename FirstOutputIterator,
+            typename SecondOutputIterator, typename UnselectedIterator,
+            typename Select1Lambda, typename Select2Lambda>
+  void doPartition3(Int32 nb_value, InputIterator input_iter,
+                    FirstOutputIterator first_output_iter,
+                    SecondOutputIterator second_output_iter,
+                    UnselectedIterator unselected_iter,
+                    const Select1Lambda& select1_lambda,
+                    const Select2Lambda& select2_lambda,
+                    SmallSpan<Int32> nb_parts)
+  {
+    const Int32 nb_block = _nbBlock(nb_value);
+    const Int32 block_size = _blockSize(nb_value, nb_block);
+
+    // Passe 1: Nombre d'éléments des deux premières listes par bloc.
+    SmallArray<Int32> nb_list1_per_block(nb_block);
+    SmallArray<Int32> nb_list2_per_block(nb_block);
+    auto count_func = [&](Int32 block_index) {
+      const Int32 begin_index = block_index * block_size;
+      const Int32 end_index = std::min(nb_value, begin_index + block_size);
+      Int32 nb_list1 = 0;
+      Int32 nb_list2 = 0;
+      for (Int32 i = begin_index; i < end_index; ++i) {
+        auto v = input_iter[i];
+        if (select1_lambda(v))
+          ++nb_list1;
+        else if (select2_lambda(v))
+          ++nb_list2;
+      }
+      nb_list1_per_block[block_index] = nb_list1;
+      nb_list2_per_block[block_index] = nb_list2;
+    };
+    _applyBlocks(nb_block, count_func);
+
+    nb_parts[0] = _exclusiveSum(nb_list1_per_block.span(), nb_block);
+    nb_parts[1] = _exclusiveSum(nb_list2_per_block.span(), nb_block);
+
+    // Passe 2: Recopie les éléments dans les trois listes.
+    auto copy_func = [&](Int32 block_index) {
+      const Int32 begin_index = block_index * block_size;
+      const Int32 end_index = std::min(nb_value, begin_index + block_size);
+      Int32 list1_index = nb_list1_per_block[block_index];
+      Int32 list2_index = nb_list2_per_block[block_index];
+      Int32 unselected_index = begin_index - list1_index - list2_index;
+      for (Int32 i = begin_index; i < end_index; ++i) {
+        auto v = input_iter[i];
+        if (select1_lambda(v)) {
+          first_output_iter[list1_index] = v;
+          ++list1_index;
+        }
+        else if (select2_lambda(v)) {
+          second_output_iter[list2_index] = v;
+          ++list2_index;
+        }
+        else {
+          unselected_iter[unselected_index] = v;
+          ++unselected_index;
+        }
+      }
+    };
+    _applyBlocks(nb_block, copy_func);
+  }
+
+  /*!
+   * \brief Scan inclusif ou exclusif.
+   *
+   * La sémantique est identique à celle de l'algorithme séquentiel:
+   *
+   * \code
+   * DataType sum = init_value;
+   * for (Int32 i = 0; i < nb_value; ++i) {
+   *   // Si exclusif
+   *   output[i] = sum; sum = op(input[i], sum);
+   *   // Si inclusif
+   *   sum = op(input[i], sum); output[i] = sum;
+   * }
+   * \endcode
+   *
+   * L'opérateur \a op doit être associatif. Si \a op n'est pas
+   * commutatif, l'ordre des arguments est conservé.
+   *
+   * Pour limiter les défauts de cache, l'intervalle est traité par
+   * tranches successives contenant au plus un bloc par thread. La taille
+   * d'un bloc est choisie pour que ses valeurs tiennent dans un cache L2.
+   * Pour chaque tranche, une première passe parallèle calcule la réduction
+   * de chaque bloc. On en déduit séquentiellement la valeur initiale de
+   * chaque bloc puis une seconde passe parallèle calcule le scan
+   * sur chaque bloc. Comme les valeurs d'un bloc viennent d'être lues, elles
+   * sont en général encore dans le cache lors de la seconde passe.
+   */
+  template <bool IsExclusive, typename InputIterator, typename OutputIterator,
+            typename Operator, typename DataType>
+  void doScan(Int32 nb_value, InputIterator input_iter, OutputIterator output_iter,
+              DataType init_value, const Operator& op)
+  {
+    const Int32 nb_thread = _nbThread();
+    Int32 block_size = std::max(MIN_BLOCK_SIZE, static_cast<Int32>(SCAN_BLOCK_BYTE_SIZE / sizeof(DataType)));
+    // Si le nombre de valeurs est petit, répartit l'intervalle sur tous les threads.
+    if (nb_value < (block_size * nb_thread))
+      block_size = std::max(MIN_BLOCK_SIZE, (nb_value + nb_thread - 1) / nb_thread);
+    const Int32 nb_total_block = (nb_value + block_size - 1) / block_size;
+    const Int32 nb_block_per_slice = std::min(nb_thread, nb_total_block);
+
+    // Réduction partielle puis valeur initiale de chaque bloc de la tranche courante.
+    SmallArray<DataType> block_reductions(nb_block_per_slice);
+    DataType slice_init_value = init_value;
+
+    for (Int32 first_block = 0; first_block < nb_total_block; first_block += nb_block_per_slice) {
+      const Int32 nb_block = std::min(nb_block_per_slice, nb_total_block - first_block);
+
+      // Passe 1: Réduction de chaque bloc sauf le dernier qui n'est
+      // pas utile pour calculer les valeurs initiales des blocs.
+      auto reduce_func = [&](Int32 block_index) {
+        const Int32 begin_index = (first_block + block_index) * block_size;
+        const Int32 end_index = std::min(nb_value, begin_index + block_size);
+        DataType sum = input_iter[begin_index];
+        for (Int32 i = begin_index + 1; i < end_index; ++i)
+          sum = op(input_iter[i], sum);
+        block_reductions[block_index] = sum;
+      };
+      _applyBlocks(nb_block - 1, reduce_func);
+
+      // Calcule la valeur initiale de chaque bloc
+      DataType current_value = slice_init_value;
+      for (Int32 i = 0; i < (nb_block - 1); ++i) {
+        DataType v = block_reductions[i];
+        block_reductions[i] = current_value;
+        current_value = op(v, current_value);
+      }
+      block_reductions[nb_block - 1] = current_value;
+
+      // Passe 2: Scan sur chaque bloc.
+      auto scan_func = [&](Int32 block_index) {
+        const Int32 begin_index = (first_block + block_index) * block_size;
+        const Int32 end_index = std::min(nb_value, begin_index + block_size);
+        DataType sum = block_reductions[block_index];
+        for (Int32 i = begin_index; i < end_index; ++i) {
+          DataType v = input_iter[i];
+          if constexpr (IsExclusive) {
+            output_iter[i] = sum;
+            sum = op(v, sum);
+          }
+          else {
+            sum = op(v, sum);
+            output_iter[i] = sum;
+          }
+        }
+        // Le dernier bloc conserve la valeur initiale de la tranche suivante.
+        if (block_index == (nb_block - 1))
+          slice_init_value = sum;
+      };
+      _applyBlocks(nb_block, scan_func);
+    }
+  }
+
+ private:
+
+  ParallelLoopOptions m_options;
+
+ private:
+
+  //! Nombre de threads utilisables pour l'algorithme
+  Int32 _nbThread() const
+  {
+    Int32 nb_thread = TaskFactory::nbAllowedThread();
+    const Int32 max_thread = m_options.maxThread();
+    if (max_thread > 0)
+      nb_thread = std::min(nb_thread, max_thread);
+    return std::max(nb_thread, 1);
+  }
+
+  //! Nombre de blocs pour découper \a nb_value éléments
+  Int32 _nbBlock(Int32 nb_value) const
+  {
+    const Int32 nb_thread = _nbThread();
+    if (nb_thread == 1)
+      return 1;
+    const Int32 max_nb_block = nb_thread * NB_BLOCK_PER_THREAD;
+    const Int32 nb_block = (nb_value + MIN_BLOCK_SIZE - 1) / MIN_BLOCK_SIZE;
+    return std::clamp(nb_block, 1, max_nb_block);
+  }
+
+  static Int32 _blockSize(Int32 nb_value, Int32 nb_block)
+  {
+    return (nb_value + nb_block - 1) / nb_block;
+  }
+
+  //! Applique \a func en parallèle sur chaque bloc de [0,nb_block[
+  template <typename BlockLambda>
+  void _applyBlocks(Int32 nb_block, const BlockLambda& func)
+  {
+    if (nb_block <= 0)
+      return;
+    if (nb_block == 1) {
+      func(0);
+      return;
+    }
+    auto range_func = [&](Int32 begin, Int32 size) {
+      for (Int32 i = begin, n = begin + size; i < n; ++i)
+        func(i);
+    };
+    LambdaRangeFunctorT<decltype(range_func)> functor(range_func);
+    ParallelLoopOptions options(m_options);
+    options.setGrainSize(1);
+    TaskFactory::executeParallelFor(0, nb_block, options, &functor);
+  }
+
+  /*!
+   * \brief Remplace les \a n premières valeurs de \a values par leur
+   * somme exclusive et retourne la somme totale.
+   */
+  static Int32 _exclusiveSum(Span<Int32> values, Int32 n)
+  {
+    Int32 sum = 0;
+    for (Int32 i = 0; i < n; ++i) {
+      Int32 v = values[i];
+      values[i] = sum;
+      sum += v;
+    }
+    return sum;
+  }
+};
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+} // namespace Arcane::Accelerator::impl
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+#endif
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
@@ -1,6 +1,6 @@
 ﻿// -*- tab-width: 2; indent-tabs-mode: nil; coding: utf-8-with-signature -*-
 //-----------------------------------------------------------------------------
-// Copyright 2000-2023 CEA (www.cea.fr) IFPEN (www.ifpenergiesnouvelles.com)
+// Copyright 2000-2024 CEA (www.cea.fr) IFPEN (www.ifpenergiesnouvelles.com)
 // See the top-level COPYRIGHT file for details.
 // SPDX-License-Identifier: Apache-2.0
 //-----------------------------------------------------------------------------
@@ -42,13 +42,24 @@ _nbFirstPart() const
 /*---------------------------------------------------------------------------*/
 /*---------------------------------------------------------------------------*/
 
+SmallSpan<const Int32> GenericPartitionerBase::
+_nbParts() const
+{
+  if (m_queue)
+    m_queue->barrier();
+  return m_host_nb_list1_storage.to1DSmallSpan();
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
 void GenericPartitionerBase::
 _allocate()
 {
   eMemoryRessource r = eMemoryRessource::HostPinned;
   if (m_host_nb_list1_storage.memoryRessource() != r)
     m_host_nb_list1_storage = NumArray<Int32, MDDim1>(r);
-  m_host_nb_list1_storage.resize(1);
+  m_host_nb_list1_storage.resize(2);
 }
 
 /*---------------------------------------------------------------------------*/
@@ -21,6 +21,8 @@
 #include "arcane/accelerator/AcceleratorGlobal.h"
 #include "arcane/accelerator/core/RunQueue.h"
 #include "arcane/accelerator/CommonUtils.h"
+#include "arcane/accelerator/MultiThreadAlgo.h"
+#include "arcane/accelerator/RunCommandLaunchInfo.h"
 
 /*---------------------------------------------------------------------------*/
 /*---------------------------------------------------------------------------*/
@@ -49,13 +51,15 @@ class ARCANE_ACCELERATOR_EXPORT GenericPartitionerBase
  protected:
 
   Int32 _nbFirstPart() const;
+  SmallSpan<const Int32> _nbParts() const;
   void _allocate();
 
  protected:
 
   RunQueue* m_queue = nullptr;
   GenericDeviceStorage m_algo_storage;
-  DeviceStorage<int> m_device_nb_list1_storage;
+  //! Nombre d'éléments des deux premières listes
+  DeviceStorage<int, 2> m_device_nb_list1_storage;
   NumArray<Int32, MDDim1> m_host_nb_list1_storage;
 };
 
@@ -65,10 +69,7 @@ class ARCANE_ACCELERATOR_EXPORT GenericPartitionerBase
  * \internal
  * \brief Classe pour effectuer un partitionnement d'une liste.
  *
- * La liste est partitionnée en deux listes.
- *
- * \a DataType est le type de donnée.
- * \a FlagType est le type du tableau de filtre.
+ * La liste est partitionnée en deux ou trois listes.
  */
 class GenericPartitionerIf
 {
@@ -121,11 +122,16 @@ class GenericPartitionerIf
       s.m_device_nb_list1_storage.copyToAsync(s.m_host_nb_list1_storage, queue);
     } break;
 #endif
-    case eExecutionPolicy::Thread:
-      // Pas encore implémenté en multi-thread
-      [[fallthrough]];
+    case eExecutionPolicy::Thread: {
+      // Utilise les options de boucle associées à la file.
+      RunCommand command = makeCommand(*queue);
+      impl::RunCommandLaunchInfo launch_info(command, nb_item);
+      launch_info.beginExecute();
+      MultiThreadAlgo algo(launch_info.computeParallelLoopOptions());
+      s.m_host_nb_list1_storage[0] = algo.doPartition(nb_item, input_iter, output_iter, select_lambda);
+      launch_info.endExecute();
+    } break;
     case eExecutionPolicy::Sequential: {
-      UniqueArray<bool> filter_index(nb_item);
       auto saved_output_iter = output_iter;
       auto output2_iter = output_iter + nb_item;
       for (Int32 i = 0; i < nb_item; ++i) {
@@ -147,6 +153,99 @@ class GenericPartitionerIf
       ARCANE_FATAL(getBadPolicyMessage(exec_policy));
     }
   }
+
+  template <typename InputIterator, typename FirstOutputIterator,
+            typename SecondOutputIterator, typename UnselectedIterator,
+            typename Select1Lambda, typename Select2Lambda>
+  void apply3(GenericPartitionerBase& s, Int32 nb_item, InputIterator input_iter,
+              FirstOutputIterator first_output_iter,
+              SecondOutputIterator second_output_iter,
+              UnselectedIterator unselected_iter,
+              const Select1Lambda& select1_lambda,
+              const Select2Lambda& select2_lambda)
+  {
+    eExecutionPolicy exec_policy = eExecutionPolicy::Sequential;
+    RunQueue* queue = s.m_queue;
+    if (queue)
+      exec_policy = queue->executionPolicy();
+    switch (exec_policy) {
+#if defined(ARCANE_COMPILING_CUDA)
+    case eExecutionPolicy::CUDA: {
+      size_t temp_storage_size = 0;
+      cudaStream_t stream = impl::CudaUtils::toNativeStream(queue);
+      // Premier appel pour connaitre la taille pour l'allocation
+      int* nb_list1_ptr = nullptr;
+      ARCANE_CHECK_CUDA(::cub::DevicePartition::If(nullptr, temp_storage_size,
+                                                   input_iter, first_output_iter, second_output_iter,
+                                                   unselected_iter, nb_list1_ptr, nb_item,
+                                                   select1_lambda, select2_lambda, stream));
+
+      s.m_algo_storage.allocate(temp_storage_size);
+      nb_list1_ptr = s.m_device_nb_list1_storage.allocate();
+      ARCANE_CHECK_CUDA(::cub::DevicePartition::If(s.m_algo_storage.address(), temp_storage_size,
+                                                   input_iter, first_output_iter, second_output_iter,
+                                                   unselected_iter, nb_list1_ptr, nb_item,
+                                                   select1_lambda, select2_lambda, stream));
+      s.m_device_nb_list1_storage.copyToAsync(s.m_host_nb_list1_storage, queue);
+    } break;
+#endif
+#if defined(ARCANE_COMPILING_HIP)
+    case eExecutionPolicy::HIP: {
+      size_t temp_storage_size = 0;
+      // Premier appel pour connaitre la taille pour l'allocation
+      hipStream_t stream = impl::HipUtils::toNativeStream(queue);
+      int* nb_list1_ptr = nullptr;
+      ARCANE_CHECK_HIP(rocprim::partition_three_way(nullptr, temp_storage_size, input_iter, first_output_iter,
+                                                    second_output_iter, unselected_iter,
+                                                    nb_list1_ptr, nb_item, select1_lambda, select2_lambda, stream));
+
+      s.m_algo_storage.allocate(temp_storage_size);
+      nb_list1_ptr = s.m_device_nb_list1_storage.allocate();
+
+      ARCANE_CHECK_HIP(rocprim::partition_three_way(s.m_algo_storage.address(), temp_storage_size, input_iter, first_output_iter,
+                                                    second_output_iter, unselected_iter,
+                                                    nb_list1_ptr, nb_item, select1_lambda, select2_lambda, stream));
+      s.m_device_nb_list1_storage.copyToAsync(s.m_host_nb_list1_storage, queue);
+    } break;
+#endif
+    case eExecutionPolicy::Thread: {
+      // Utilise les options de boucle associées à la file.
+      RunCommand command = makeCommand(*queue);
+      impl::RunCommandLaunchInfo launch_info(command, nb_item);
+      launch_info.beginExecute();
+      MultiThreadAlgo algo(launch_info.computeParallelLoopOptions());
+      algo.doPartition3(nb_item, input_iter, first_output_iter, second_output_iter, unselected_iter,
+                        select1_lambda, select2_lambda, s.m_host_nb_list1_storage.to1DSmallSpan());
+      launch_info.endExecute();
+    } break;
+    case eExecutionPolicy::Sequential: {
+      Int32 nb_first = 0;
+      Int32 nb_second = 0;
+      for (Int32 i = 0; i < nb_item; ++i) {
+        auto v = *input_iter;
+        if (select1_lambda(v)) {
+          *first_output_iter = v;
+          ++first_output_iter;
+          ++nb_first;
+        }
+        else if (select2_lambda(v)) {
+          *second_output_iter = v;
+          ++second_output_iter;
+          ++nb_second;
+        }
+        else {
+          *unselected_iter = v;
+          ++unselected_iter;
+        }
+        ++input_iter;
+      }
+      s.m_host_nb_list1_storage[0] = nb_first;
+      s.m_host_nb_list1_storage[1] = nb_second;
+    } break;
+    default:
+      ARCANE_FATAL(getBadPolicyMessage(exec_policy));
+    }
+  }
 };
 
 /*---------------------------------------------------------------------------*/
@@ -178,6 +277,17 @@ class GenericPartitioner
 
  public:
 
+  /*!
+   * \brief Effectue un partitionnement d'une liste en deux parties.
+   *
+   * Les valeurs de \a input_iter pour lesquelles \a select_lambda est vrai
+   * sont recopiées au début de \a output_iter dans l'ordre de l'entrée.
+   * Les autres valeurs sont recopiées à partir de la fin de \a output_iter
+   * dans l'ordre inverse de l'entrée.
+   *
+   * Il faut appeler nbFirstPart() pour obtenir le nombre d'éléments
+   * de la première partie.
+   */
   template <typename InputIterator, typename OutputIterator, typename SelectLambda>
   void applyIf(Int32 nb_item, InputIterator input_iter, OutputIterator output_iter,
                const SelectLambda& select_lambda)
@@ -188,6 +298,35 @@ class GenericPartitioner
     gf.apply(*base_ptr, nb_item, input_iter, output_iter, select_lambda);
   }
 
+  /*!
+   * \brief Effectue un partitionnement d'une liste en trois parties.
+   *
+   * Les valeurs de \a input_iter pour lesquelles \a select1_lambda est vrai
+   * sont recopiées dans \a first_output_iter. Parmi les autres valeurs,
+   * celles pour lesquelles \a select2_lambda est vrai sont recopiées dans
+   * \a second_output_iter. Les valeurs restantes sont recopiées dans
+   * \a unselected_iter. Les trois listes conservent l'ordre de l'entrée.
+   *
+   * Il faut appeler nbParts() pour obtenir le nombre d'éléments
+   * des deux premières parties.
+   */
+  template <typename InputIterator, typename FirstOutputIterator,
+            typename SecondOutputIterator, typename UnselectedIterator,
+            typename Select1Lambda, typename Select2Lambda>
+  void applyIf(Int32 nb_item, InputIterator input_iter,
+               FirstOutputIterator first_output_iter,
+               SecondOutputIterator second_output_iter,
+               UnselectedIterator unselected_iter,
+               const Select1Lambda& select1_lambda,
+               const Select2Lambda& select2_lambda)
+  {
+    _setCalled();
+    impl::GenericPartitionerBase* base_ptr = this;
+    impl::GenericPartitionerIf gf;
+    gf.apply3(*base_ptr, nb_item, input_iter, first_output_iter, second_output_iter,
+              unselected_iter, select1_lambda, select2_lambda);
+  }
+
   //! Nombre d'éléments de la première partie de la liste.
   Int32 nbFirstPart()
   {
@@ -195,6 +334,17 @@ class GenericPartitioner
     return _nbFirstPart();
   }
 
+  /*!
+   * \brief Nombre d'éléments de la première et deuxième partie de la liste.
+   *
+   * N'est valide que pour le partitionnement en trois parties.
+   */
+  SmallSpan<const Int32> nbParts()
+  {
+    m_is_already_called = false;
+    return _nbParts();
+  }
+
  private:
 
   bool m_is_already_called = false;
@@ -18,6 +18,8 @@
 
 #include "arcane/core/Concurrency.h"
 #include "arcane/core/materials/ComponentItemVectorView.h"
+#include "arcane/core/materials/ComponentPartItemVectorView.h"
+#include "arcane/core/materials/SimdMatVarIndex.h"
 #include "arcane/core/materials/MaterialsCoreGlobal.h"
 #include "arcane/core/materials/MatItem.h"
 #include "arcane/accelerator/RunQueueInternal.h"
@@ -457,6 +459,120 @@ class MatAndGlobalCellRunCommand
 /*---------------------------------------------------------------------------*/
 /*---------------------------------------------------------------------------*/
 
+/*!
+ * \brief Commande pour itérer de manière vectorielle sur les mailles
+ * d'un composant (milieu ou matériau).
+ *
+ * L'itération se fait sur la partie pure puis sur la partie impure
+ * du composant par blocs de SimdSize valeurs. Chaque itération fournit un
+ * SimdMatVarIndex dont tous les indices font référence au même tableau de
+ * valeurs. Les indices des parties pures et impures sont déjà alignés et
+ * complétés (padding) pour la vectorisation par MeshComponentPartData.
+ *
+ * Cette commande n'est disponible que pour les politiques d'exécution
+ * sur l'hôte (eExecutionPolicy::Sequential et eExecutionPolicy::Thread).
+ */
+class SimdComponentCellRunCommand
+{
+ public:
+
+  using ComponentPartItemVectorView = Arcane::Materials::ComponentPartItemVectorView;
+  using IMeshComponent = Arcane::Materials::IMeshComponent;
+  using SimdMatVarIndex = Arcane::Materials::SimdMatVarIndex;
+  using SimdIndexType = SimdMatVarIndex::SimdIndexType;
+
+ public:
+
+  /*!
+   * \brief Conteneur contenant les informations nécessaires pour la commande.
+   *
+   * Le i-ème élément du conteneur correspond au i-ème bloc SIMD.
+   */
+  class Container
+  {
+   public:
+
+    explicit Container(IMeshComponent* component)
+    : Container(component->pureItems(), component->impureItems())
+    {
+    }
+    Container(ComponentPartItemVectorView pure_items, ComponentPartItemVectorView impure_items)
+    : m_pure_items(pure_items)
+    , m_impure_items(impure_items)
+    {
+      _init();
+    }
+
+   public:
+
+    SimdComponentCellRunCommand createCommand(RunCommand& run_command) const
+    {
+      return SimdComponentCellRunCommand(run_command, *this);
+    }
+
+   public:
+
+    //! Nombre de blocs SIMD
+    Int32 size() const { return m_nb_pure_block + m_nb_impure_block; }
+
+    //! Accesseur pour le i-ème bloc de la liste
+    SimdMatVarIndex operator[](Int32 i) const
+    {
+      if (i < m_nb_pure_block)
+        return SimdMatVarIndex(m_pure_part_index, _simdIndex(m_pure_value_indexes, i));
+      return SimdMatVarIndex(m_impure_part_index, _simdIndex(m_impure_value_indexes, i - m_nb_pure_block));
+    }
+
+   private:
+
+    ComponentPartItemVectorView m_pure_items;
+    ComponentPartItemVectorView m_impure_items;
+    const Int32* m_pure_value_indexes = nullptr;
+    const Int32* m_impure_value_indexes = nullptr;
+    Int32 m_pure_part_index = 0;
+    Int32 m_impure_part_index = 0;
+    Int32 m_nb_pure_block = 0;
+    Int32 m_nb_impure_block = 0;
+
+   private:
+
+    void _init()
+    {
+      m_pure_value_indexes = m_pure_items.valueIndexes().data();
+      m_impure_value_indexes = m_impure_items.valueIndexes().data();
+      m_pure_part_index = m_pure_items.componentPartIndex();
+      m_impure_part_index = m_impure_items.componentPartIndex();
+      m_nb_pure_block = _nbBlock(m_pure_items.nbItem());
+      m_nb_impure_block = _nbBlock(m_impure_items.nbItem());
+    }
+    static Int32 _nbBlock(Int32 n)
+    {
+      return (n + SimdSize - 1) / SimdSize;
+    }
+    static const SimdIndexType& _simdIndex(const Int32* indexes, Int32 block_index)
+    {
+      return *reinterpret_cast<const SimdIndexType*>(indexes + block_index * SimdSize);
+    }
+  };
+
+ private:
+
+  // Uniquement appelable depuis 'Container'
+  explicit SimdComponentCellRunCommand(RunCommand& command, const Container& items)
+  : m_command(command)
+  , m_items(items)
+  {
+  }
+
+ public:
+
+  RunCommand& m_command;
+  Container m_items;
+};
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
 //! Spécialisation pour une vue sur un milieu et la maille globale associée
 template <>
 class RunCommandMatItemEnumeratorTraitsT<Arcane::Materials::EnvAndGlobalCell>
@@ -557,6 +673,48 @@ class RunCommandMatItemEnumeratorTraitsT<Arcane::Materials::MatCell>
 /*---------------------------------------------------------------------------*/
 /*---------------------------------------------------------------------------*/
 
+//! Spécialisation pour une itération vectorielle sur un milieu.
+template <>
+class RunCommandMatItemEnumeratorTraitsT<Arcane::Materials::SimdEnvCell>
+{
+ public:
+
+  using EnumeratorType = Arcane::Materials::SimdMatVarIndex;
+  using ContainerType = SimdComponentCellRunCommand::Container;
+  using MatCommandType = SimdComponentCellRunCommand;
+
+ public:
+
+  static ContainerType createContainer(Arcane::Materials::IMeshEnvironment* env)
+  {
+    return ContainerType{ env };
+  }
+};
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+//! Spécialisation pour une itération vectorielle sur un matériau.
+template <>
+class RunCommandMatItemEnumeratorTraitsT<Arcane::Materials::SimdMatCell>
+{
+ public:
+
+  using EnumeratorType = Arcane::Materials::SimdMatVarIndex;
+  using ContainerType = SimdComponentCellRunCommand::Container;
+  using MatCommandType = SimdComponentCellRunCommand;
+
+ public:
+
+  static ContainerType createContainer(Arcane::Materials::IMeshMaterial* mat)
+  {
+    return ContainerType{ mat };
+  }
+};
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
 #if defined(ARCANE_COMPILING_CUDA) || defined(ARCANE_COMPILING_HIP)
 /*
  * Surcharge de la fonction de lancement de kernel pour GPU pour les ComponentItemLocalId et CellLocalId
@@ -739,6 +897,54 @@ void operator<<(const GenericMatCommand<MatCommandType, ReducerArgs...>& c, cons
     impl::_applyEnvCells(c.m_mat_command.m_command, c.m_mat_command.m_items, func);
 }
 
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+/*!
+ * \brief Applique l'énumération vectorielle \a func sur les blocs SIMD de \a items.
+ *
+ * Seules les politiques d'exécution sur l'hôte sont supportées.
+ */
+template <typename Lambda, typename... ReducerArgs> void
+_applySimdComponentCells(RunCommand& command, SimdComponentCellRunCommand::Container items,
+                         const Lambda& func, const ReducerArgs&... reducer_args)
+{
+  Int32 vsize = items.size();
+  if (vsize == 0)
+    return;
+
+  RunCommandLaunchInfo launch_info(command, vsize);
+  const eExecutionPolicy exec_policy = launch_info.executionPolicy();
+  launch_info.computeLoopRunInfo();
+  launch_info.beginExecute();
+  switch (exec_policy) {
+  case eExecutionPolicy::Sequential:
+    _doMatItemsLambda(0, vsize, items, func, reducer_args...);
+    break;
+  case eExecutionPolicy::Thread:
+    arcaneParallelFor(0, vsize, launch_info.loopRunInfo(),
+                      [&](Int32 begin, Int32 size) {
+                        _doMatItemsLambda(begin, size, items, func, reducer_args...);
+                      });
+    break;
+  default:
+    ARCANE_FATAL("Invalid execution policy '{0}' for SIMD enumeration (only host policies are supported)", exec_policy);
+  }
+  launch_info.endExecute();
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+template <typename... ReducerArgs, typename Lambda>
+void operator<<(const GenericMatCommand<SimdComponentCellRunCommand, ReducerArgs...>& c, const Lambda& func)
+{
+  if constexpr (sizeof...(ReducerArgs) > 0) {
+    std::apply([&](auto... vs) { impl::_applySimdComponentCells(c.m_mat_command.m_command, c.m_mat_command.m_items, func, vs...); }, c.m_reducer_args);
+  }
+  else
+    impl::_applySimdComponentCells(c.m_mat_command.m_command, c.m_mat_command.m_items, func);
+}
+
 template <typename MatItemType, typename MatItemContainerType, typename... ReducerArgs> auto
 makeExtendedMatItemEnumeratorLoop(const MatItemContainerType& container,
                                   const ReducerArgs&... reducer_args)
@@ -804,6 +1010,15 @@ operator<<(RunCommand& command, const impl::MatCellRunCommand::Container& view)
 /*---------------------------------------------------------------------------*/
 /*---------------------------------------------------------------------------*/
 
+inline auto
+operator<<(RunCommand& command, const impl::SimdComponentCellRunCommand::Container& view)
+{
+  return impl::GenericMatCommand<impl::SimdComponentCellRunCommand>(view.createCommand(command));
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
 } // End namespace Arcane::Accelerator
 
 /*---------------------------------------------------------------------------*/
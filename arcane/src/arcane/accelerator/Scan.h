@@ -23,6 +23,7 @@
 
 #include "arcane/accelerator/AcceleratorGlobal.h"
 #include "arcane/accelerator/CommonUtils.h"
+#include "arcane/accelerator/MultiThreadAlgo.h"
 #include "arcane/accelerator/RunCommandLaunchInfo.h"
 #include "arcane/accelerator/RunCommandLoop.h"
 #include "arcane/accelerator/ScanImpl.h"
@@ -140,9 +141,10 @@ class ScannerImpl
 #endif
     } break;
 #endif
-    case eExecutionPolicy::Thread:
-      // Pas encore implémenté en multi-thread
-      [[fallthrough]];
+    case eExecutionPolicy::Thread: {
+      MultiThreadAlgo scanner(launch_info.computeParallelLoopOptions());
+      scanner.doScan<IsExclusive>(nb_item, input_data, output_data, init_value, op);
+    } break;
     case eExecutionPolicy::Sequential: {
       DataType sum = init_value;
       for (Int32 i = 0; i < nb_item; ++i) {
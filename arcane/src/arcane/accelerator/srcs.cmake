@@ -11,6 +11,7 @@ set( ARCANE_SOURCES
   IReduceMemoryImpl.h
   MaterialVariableViews.h
   MemoryCopier.cc
+  MultiThreadAlgo.h
   NumArray.h
   NumArrayViews.h
   NumArrayViews.cc
@@ -0,0 +1,308 @@
+﻿// -*- tab-width: 2; indent-tabs-mode: nil; coding: utf-8-with-signature -*-
+//-----------------------------------------------------------------------------
+// Copyright 2000-2024 CEA (www.cea.fr) IFPEN (www.ifpenergiesnouvelles.com)
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: Apache-2.0
+//-----------------------------------------------------------------------------
+
+#include <gtest/gtest.h>
+
+#include "arcane/utils/NumArray.h"
+#include "arcane/utils/PlatformUtils.h"
+#include "arcane/utils/ConcurrencyUtils.h"
+#include "arcane/utils/NotImplementedException.h"
+#include "arcane/utils/ValueConvert.h"
+
+#include "arcane/accelerator/core/Runner.h"
+#include "arcane/accelerator/core/RunQueue.h"
+#include "arcane/accelerator/Scan.h"
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+extern "C++" void arcaneRegisterDefaultAcceleratorRuntime();
+extern "C++" Arcane::Accelerator::eExecutionPolicy arcaneGetDefaultExecutionPolicy();
+
+using namespace Arcane;
+using namespace Arcane::Accelerator;
+
+namespace
+{
+void _doInit()
+{
+  arcaneRegisterDefaultAcceleratorRuntime();
+}
+Arcane::Accelerator::eExecutionPolicy _defaultExecutionPolicy()
+{
+  return arcaneGetDefaultExecutionPolicy();
+}
+
+//! Opérateur non commutatif pour vérifier l'ordre des arguments
+class FirstNonZeroOperator
+{
+ public:
+
+  ARCCORE_HOST_DEVICE Int64 operator()(Int64 a, Int64 b) const
+  {
+    return (b != 0) ? b : a;
+  }
+};
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+/*!
+ * \brief Implémentation des tâches pour les tests utilisant 'std::thread'.
+ *
+ * Ce test n'a pas d'application et ne peut donc pas créer les services
+ * gérant les tâches. Cette implémentation minimale découpe chaque boucle
+ * en autant d'intervalles qu'il y a de threads et exécute chaque intervalle
+ * dans un thread. Seules les boucles 1D sont supportées.
+ */
+class TestTaskImplementation
+: public ITaskImplementation
+{
+ public:
+
+  explicit TestTaskImplementation(Int32 nb_thread)
+  : m_nb_thread(nb_thread)
+  {}
+
+ public:
+
+  void initialize(Int32) override {}
+  void terminate() override {}
+  ITask* createRootTask(ITaskFunctor*) override
+  {
+    ARCANE_THROW(NotImplementedException, "createRootTask");
+  }
+  void executeParallelFor(Integer begin, Integer size, const ParallelLoopOptions&, IRangeFunctor* f) override
+  {
+    _executeParallelFor(begin, size, f);
+  }
+  void executeParallelFor(Integer begin, Integer size, Integer, IRangeFunctor* f) override
+  {
+    _executeParallelFor(begin, size, f);
+  }
+  void executeParallelFor(Integer begin, Integer size, IRangeFunctor* f) override
+  {
+    _executeParallelFor(begin, size, f);
+  }
+  void executeParallelFor(const ParallelFor1DLoopInfo& loop_info) override
+  {
+    _executeParallelFor(loop_info.beginIndex(), loop_info.size(), loop_info.functor());
+  }
+  void executeParallelFor(const ComplexForLoopRanges<1>&, const ParallelLoopOptions&, IMDRangeFunctor<1>*) override
+  {
+    ARCANE_THROW(NotImplementedException, "executeParallelFor with MDRange");
+  }
+  void executeParallelFor(const ComplexForLoopRanges<2>&, const ParallelLoopOptions&, IMDRangeFunctor<2>*) override
+  {
+    ARCANE_THROW(NotImplementedException, "executeParallelFor with MDRange");
+  }
+  void executeParallelFor(const ComplexForLoopRanges<3>&, const ParallelLoopOptions&, IMDRangeFunctor<3>*) override
+  {
+    ARCANE_THROW(NotImplementedException, "executeParallelFor with MDRange");
+  }
+  void executeParallelFor(const ComplexForLoopRanges<4>&, const ParallelLoopOptions&, IMDRangeFunctor<4>*) override
+  {
+    ARCANE_THROW(NotImplementedException, "executeParallelFor with MDRange");
+  }
+  bool isActive() const override { return true; }
+  Int32 nbAllowedThread() const override { return m_nb_thread; }
+  Int32 currentTaskThreadIndex() const override { return 0; }
+  Int32 currentTaskIndex() const override { return 0; }
+  void printInfos(std::ostream& o) const override { o << "TestTaskImplementation nb_thread=" << m_nb_thread; }
+
+ public:
+
+  //! Nombre de boucles exécutées avec plusieurs threads
+  Int32 nbMultiThreadLoop() const { return m_nb_multi_thread_loop.load(); }
+
+ private:
+
+  Int32 m_nb_thread = 1;
+  std::atomic<Int32> m_nb_multi_thread_loop = 0;
+
+ private:
+
+  void _executeParallelFor(Int32 begin, Int32 size, IRangeFunctor* f)
+  {
+    const Int32 nb_part = std::min(m_nb_thread, size);
+    if (nb_part <= 1) {
+      if (size > 0)
+        f->executeFunctor(begin, size);
+      return;
+    }
+    ++m_nb_multi_thread_loop;
+    auto func = [=](Int32 part) {
+      Int32 part_begin = (size * part) / nb_part;
+      Int32 part_end = (size * (part + 1)) / nb_part;
+      f->executeFunctor(begin + part_begin, part_end - part_begin);
+    };
+    std::vector<std::thread> threads;
+    for (Int32 i = 1; i < nb_part; ++i)
+      threads.emplace_back(func, i);
+    func(0);
+    for (auto& t : threads)
+      t.join();
+  }
+};
+
+/*!
+ * \brief Positionne TestTaskImplementation comme implémentation des tâches
+ * pendant la durée de vie de l'instance.
+ */
+class ScopedTestTaskImplementation
+{
+ public:
+
+  explicit ScopedTestTaskImplementation(Int32 nb_thread)
+  : m_task_implementation(nb_thread)
+  {
+    TaskFactory::_internalSetImplementation(&m_task_implementation);
+  }
+  ~ScopedTestTaskImplementation()
+  {
+    TaskFactory::terminate();
+  }
+
+ public:
+
+  Int32 nbMultiThreadLoop() const { return m_task_implementation.nbMultiThreadLoop(); }
+
+ private:
+
+  TestTaskImplementation m_task_implementation;
+};
+
+} // namespace
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+template <bool IsExclusive, typename Operator> void
+_checkScan(RunQueue& queue, SmallSpan<const Int64> input, Int64 init_value, const Operator& op)
+{
+  const Int32 nb_value = input.size();
+  NumArray<Int64, MDDim1> expected(nb_value);
+  NumArray<Int64, MDDim1> output(nb_value);
+  Int64 sum = init_value;
+  for (Int32 i = 0; i < nb_value; ++i) {
+    if constexpr (IsExclusive) {
+      expected[i] = sum;
+      sum = op(input[i], sum);
+    }
+    else {
+      sum = op(input[i], sum);
+      expected[i] = sum;
+    }
+  }
+  GenericScanner scanner(queue);
+  if constexpr (IsExclusive)
+    scanner.applyExclusive(init_value, input, output.to1DSmallSpan(), op);
+  else
+    scanner.applyInclusive(init_value, input, output.to1DSmallSpan(), op);
+  for (Int32 i = 0; i < nb_value; ++i)
+    ASSERT_EQ(output[i], expected[i]) << "Bad value index=" << i << " size=" << nb_value;
+}
+
+void _doScan1(eExecutionPolicy policy)
+{
+  std::cout << "DO_SCAN_1 policy=" << policy << "\n";
+  Runner runner(policy);
+  RunQueue queue(makeQueue(runner));
+  for (Int32 nb_value : { 1, 27, 2049, 150000, 1000001 }) {
+    NumArray<Int64, MDDim1> input(nb_value);
+    for (Int32 i = 0; i < nb_value; ++i)
+      input[i] = ((i * 7919) % 1000) - 300 + ((i % 13) == 0 ? 0 : 1);
+    SmallSpan<const Int64> input_view(input.to1DSmallSpan());
+    _checkScan<true>(queue, input_view, 5, ScannerSumOperator<Int64>{});
+    _checkScan<false>(queue, input_view, 5, ScannerSumOperator<Int64>{});
+    _checkScan<true>(queue, input_view, ScannerMinOperator<Int64>::defaultValue(), ScannerMinOperator<Int64>{});
+    _checkScan<false>(queue, input_view, ScannerMaxOperator<Int64>::defaultValue(), ScannerMaxOperator<Int64>{});
+    _checkScan<false>(queue, input_view, -1, FirstNonZeroOperator{});
+  }
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+/*!
+ * \brief Mesure le temps d'un scan exclusif de grande taille.
+ */
+void _doScanBenchmark(eExecutionPolicy policy)
+{
+  const Int32 nb_value = 20000000;
+  const Int32 nb_loop = 5;
+  Runner runner(policy);
+  RunQueue queue(makeQueue(runner));
+  NumArray<Int64, MDDim1> input(nb_value);
+  NumArray<Int64, MDDim1> output(nb_value);
+  for (Int32 i = 0; i < nb_value; ++i)
+    input[i] = (i % 7);
+  GenericScanner scanner(queue);
+  Real time_begin = platform::getRealTime();
+  for (Int32 k = 0; k < nb_loop; ++k)
+    scanner.applyExclusive(static_cast<Int64>(0), input.to1DConstSmallSpan(),
+                           output.to1DSmallSpan(), ScannerSumOperator<Int64>{});
+  queue.barrier();
+  Real elapsed = (platform::getRealTime() - time_begin) / nb_loop;
+  Real bandwidth = (elapsed > 0.0) ? ((2.0 * sizeof(Int64) * nb_value) / elapsed) / 1.0e9 : 0.0;
+  std::cout << "SCAN_BENCHMARK policy=" << policy << " nb_thread=" << TaskFactory::nbAllowedThread()
+            << " size=" << nb_value << " time=" << elapsed << " bandwidth(GB/s)=" << bandwidth << "\n";
+  ASSERT_EQ(output[nb_value - 1], ((nb_value - 1) / 7) * 21 + ((nb_value - 1) % 7) * ((nb_value - 1) % 7 - 1) / 2);
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+TEST(ArcaneAccelerator, Scan)
+{
+  _doInit();
+
+  _doScan1(_defaultExecutionPolicy());
+  _doScan1(eExecutionPolicy::Thread);
+}
+
+TEST(ArcaneAccelerator, ScanMultiThread)
+{
+  _doInit();
+
+  ScopedTestTaskImplementation task_implementation(4);
+  ASSERT_EQ(TaskFactory::nbAllowedThread(), 4);
+  _doScan1(eExecutionPolicy::Thread);
+  // Vérifie que l'algorithme multi-thread a bien été utilisé.
+  ASSERT_GT(task_implementation.nbMultiThreadLoop(), 0);
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+/*!
+ * \brief Test de performance.
+ *
+ * Ce test n'est exécuté que si la variable d'environnement
+ * ARCANE_TEST_ACCELERATOR_BENCHMARK est positionnée à une valeur non nulle.
+ * Cette valeur indique le nombre de threads à utiliser.
+ */
+TEST(ArcaneAccelerator, ScanBenchmark)
+{
+  Int32 nb_thread = 0;
+  if (auto v = Convert::Type<Int32>::tryParseFromEnvironment("ARCANE_TEST_ACCELERATOR_BENCHMARK", true))
+    nb_thread = v.value();
+  if (nb_thread <= 0)
+    GTEST_SKIP() << "Set ARCANE_TEST_ACCELERATOR_BENCHMARK to the number of threads to run the benchmark";
+
+  _doInit();
+
+  ScopedTestTaskImplementation task_implementation(nb_thread);
+  _doScanBenchmark(eExecutionPolicy::Sequential);
+  _doScanBenchmark(eExecutionPolicy::Thread);
+  if (_defaultExecutionPolicy() != eExecutionPolicy::Sequential)
+    _doScanBenchmark(_defaultExecutionPolicy());
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
@@ -338,9 +338,17 @@ setDefaultServices()
 {
   bool has_shm = nbSharedMemorySubDomain()>0;
   {
-    String str = m_p->getValue( { "ARCANE_TASK_IMPLEMENTATION" }, "TaskService", "TBB");
-    String service_name = str+"TaskImplementation";
-    m_p->checkSet(m_p->m_task_implementation_services,service_name);
+    StringList list1;
+    String str = m_p->getValue( { "ARCANE_TASK_IMPLEMENTATION" }, "TaskService", String());
+    if (str.null()){
+      // Si aucune implémentation n'est spécifiée, utilise celle des TBB
+      // et sinon 'StdTaskImplementation' qui est toujours disponible.
+      list1.add("TBBTaskImplementation");
+      list1.add("StdTaskImplementation");
+    }
+    else
+      list1.add(str+"TaskImplementation");
+    m_p->checkSet(m_p->m_task_implementation_services,list1);
   }
   {
     StringList list1;
@@ -1,11 +1,11 @@
 ﻿// -*- tab-width: 2; indent-tabs-mode: nil; coding: utf-8-with-signature -*-
 //-----------------------------------------------------------------------------
-// Copyright 2000-2022 CEA (www.cea.fr) IFPEN (www.ifpenergiesnouvelles.com)
+// Copyright 2000-2024 CEA (www.cea.fr) IFPEN (www.ifpenergiesnouvelles.com)
 // See the top-level COPYRIGHT file for details.
 // SPDX-License-Identifier: Apache-2.0
 //-----------------------------------------------------------------------------
 /*---------------------------------------------------------------------------*/
-/* ICheckpointMng.h                                            (C) 2000-2018 */
+/* ICheckpointMng.h                                            (C) 2000-2024 */
 /*                                                                           */
 /* Interface du gestionnaire des informations des protections.               */
 /*---------------------------------------------------------------------------*/
@@ -158,10 +158,26 @@ class ICheckpointMng
    *
    * Il s'agit d'une protection classique qui pourra être relue via readDefaultCheckpoint().
    *
+   * Si l'écriture de \a writer est asynchrone (ICheckpointWriter::isWriteInProgress()),
+   * les informations de relecture ne sont mises à jour qu'une fois l'écriture
+   * terminée, lors de l'appel à waitDefaultCheckpoint() ou lors de la
+   * protection suivante. Jusque là, la reprise se fait à partir de la
+   * protection précédente.
+   *
    * \sa readDefaultCheckpoint
    */
   virtual void writeDefaultCheckpoint(ICheckpointWriter* writer) =0;
 
+  /*!
+   * \brief Attend la fin de la dernière protection écrite par
+   * writeDefaultCheckpoint() et met à jour les informations de relecture.
+   *
+   * Cette opération est collective. Elle ne fait rien s'il n'y a pas
+   * d'écriture asynchrone en cours. Si l'écriture a échoué, l'exception
+   * est relancée et les informations de relecture ne sont pas modifiées.
+   */
+  virtual void waitDefaultCheckpoint() =0;
+
   /*!
    * \brief Observable en écriture.
    *
@@ -1,11 +1,11 @@
 ﻿// -*- tab-width: 2; indent-tabs-mode: nil; coding: utf-8-with-signature -*-
 //-----------------------------------------------------------------------------
-// Copyright 2000-2022 CEA (www.cea.fr) IFPEN (www.ifpenergiesnouvelles.com)
+// Copyright 2000-2024 CEA (www.cea.fr) IFPEN (www.ifpenergiesnouvelles.com)
 // See the top-level COPYRIGHT file for details.
 // SPDX-License-Identifier: Apache-2.0
 //-----------------------------------------------------------------------------
 /*---------------------------------------------------------------------------*/
-/* ICheckpointWriter.h                                         (C) 2000-2007 */
+/* ICheckpointWriter.h                                         (C) 2000-2024 */
 /*                                                                           */
 /* Interface du service d'écriture d'une protection/reprise.                 */
 /*---------------------------------------------------------------------------*/
@@ -93,6 +93,24 @@ class ICheckpointWriter
   //! Ferme les protections
   virtual void close() =0;
 
+  /*!
+   * \brief Attend la fin de l'écriture de la dernière protection.
+   *
+   * Cette méthode n'est utile que pour les services qui écrivent les
+   * protections de manière asynchrone. Elle est collective et relance
+   * l'exception éventuelle survenue lors de l'écriture.
+   */
+  virtual void waitCheckpoint() {}
+
+  /*!
+   * \brief Indique si l'écriture de la dernière protection n'est pas terminée.
+   *
+   * Cela n'est possible que pour les services qui écrivent les
+   * protections de manière asynchrone. Dans ce cas, la protection n'est
+   * complète qu'après l'appel à waitCheckpoint().
+   */
+  virtual bool isWriteInProgress() const { return false; }
+
   //! Nom du service du lecteur associé à cet écrivain
   virtual String readerServiceName() const =0;
   
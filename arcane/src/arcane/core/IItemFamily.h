@@ -1,6 +1,6 @@
 ﻿// -*- tab-width: 2; indent-tabs-mode: nil; coding: utf-8-with-signature -*-
 //-----------------------------------------------------------------------------
-// Copyright 2000-2023 CEA (www.cea.fr) IFPEN (www.ifpenergiesnouvelles.com)
+// Copyright 2000-2024 CEA (www.cea.fr) IFPEN (www.ifpenergiesnouvelles.com)
 // See the top-level COPYRIGHT file for details.
 // SPDX-License-Identifier: Apache-2.0
 //-----------------------------------------------------------------------------
@@ -385,6 +385,25 @@ class IItemFamily
                                       ConstArrayView<ItemUniqueId> unique_ids,
                                       bool do_fatal=true) const =0;
 
+  /*!
+   * \brief Converti un tableau de numéros uniques en numéros locaux.
+   *
+   * Cette méthode est équivalente à itemsUniqueIdToLocalId(local_ids,unique_ids,false)
+   * mais est destinée aux conversions d'un grand nombre d'entités : la
+   * conversion est découpée en paquets traités en concurrence (via
+   * arcaneParallelFor()) si le multi-threading est actif.
+   *
+   * Aucune erreur n'est générée si une entité n'est pas trouvée. Les indices
+   * dans \a unique_ids des entités non trouvées sont ajoutés par ordre
+   * croissant à \a not_found_indexes. Les valeurs de \a unique_ids valant
+   * NULL_ITEM_UNIQUE_ID ne sont pas considérées comme non trouvées.
+   *
+   * \pre hasUniqueIdMap()
+   */
+  virtual void itemsUniqueIdToLocalId(Int32ArrayView local_ids,
+                                      Int64ConstArrayView unique_ids,
+                                      Array<Int32>& not_found_indexes) const =0;
+
  public:
 
   /*!
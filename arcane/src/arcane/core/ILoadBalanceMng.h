@@ -46,6 +46,25 @@ class ILoadBalanceMng
   virtual void addCriterion(VariableCellReal& count) =0;
   virtual void addCommCost(VariableFaceInt32& count, const String& entity="") =0;
 
+  /*!
+   * \brief Positionne les coefficients du coût associé aux matériaux.
+   *
+   * Le coût d'une maille vaut \a cell_cost + \a component_cost * nb_component
+   * avec nb_component le nombre de milieux plus le nombre de matériaux de la
+   * maille. Si la maille est mixte (plusieurs milieux ou un milieu avec
+   * plusieurs matériaux), on ajoute \a mixed_cell_cost.
+   *
+   * Le nombre de milieux et de matériaux est obtenu à partir du
+   * gestionnaire de matériaux associé au maillage. S'il n'y en a pas, le
+   * coût d'une maille vaut \a cell_cost.
+   *
+   * Ce coût n'est utilisé que si setMaterialCostAsCriterion() a été appelé.
+   */
+  virtual void setMaterialCost(Real cell_cost, Real component_cost, Real mixed_cell_cost) =0;
+
+  //! Indique si le coût associé aux matériaux est utilisé comme critère.
+  virtual void setMaterialCostAsCriterion(bool active=true) =0;
+
   virtual void reset() =0;
 
   /*!
@@ -157,7 +157,24 @@ class ARCANE_CORE_EXPORT IVariable
      * Cela signifie qu'il est normal que les valeurs de la variable soient
      * différentes sur les mêmes sous-domaines des autres réplicas.
      */
-    PNoReplicaSync = (1 << 11)
+    PNoReplicaSync = (1 << 11),
+
+    /*!
+     * \brief Indique que la synchronisation de la variable n'envoie que
+     * les valeurs modifiées.
+     *
+     * Pour chaque rang voisin, la dernière valeur envoyée est conservée
+     * et les synchronisations suivantes n'envoient qu'un masque des entités
+     * modifiées suivi des nouvelles valeurs. Cela est intéressant pour les
+     * variables dont seule une petite partie des valeurs change entre deux
+     * synchronisations mais nécessite de conserver une copie des valeurs
+     * envoyées et reçues.
+     *
+     * Cette propriété doit être la même sur tous les sous-domaines.
+     * Elle n'est pas prise en compte si les buffers de synchronisation sont
+     * alloués sur accélérateur.
+     */
+    PDeltaSync = (1 << 12)
   };
 
  public:
@@ -1,11 +1,11 @@
 ﻿// -*- tab-width: 2; indent-tabs-mode: nil; coding: utf-8-with-signature -*-
 //-----------------------------------------------------------------------------
-// Copyright 2000-2023 CEA (www.cea.fr) IFPEN (www.ifpenergiesnouvelles.com)
+// Copyright 2000-2024 CEA (www.cea.fr) IFPEN (www.ifpenergiesnouvelles.com)
 // See the top-level COPYRIGHT file for details.
 // SPDX-License-Identifier: Apache-2.0
 //-----------------------------------------------------------------------------
 /*---------------------------------------------------------------------------*/
-/* IVariableSynchronizer.h                                     (C) 2000-2023 */
+/* IVariableSynchronizer.h                                     (C) 2000-2024 */
 /*                                                                           */
 /* Interface d'un service de synchronisation des variables.                  */
 /*---------------------------------------------------------------------------*/
@@ -82,6 +82,44 @@ class ARCANE_CORE_EXPORT IVariableSynchronizer
    */
   virtual void synchronize(VariableCollection vars) = 0;
 
+  /*!
+   * \brief Commence la synchronisation de la variable \a var en mode non bloquant.
+   *
+   * Il faut appeler endSynchronize() pour terminer la synchronisation.
+   * Entre ces deux appels, il est possible d'effectuer des calculs qui
+   * n'utilisent pas les valeurs des entités fantômes de \a var, par exemple
+   * sur les entités propres qui ne sont pas partagées (voir sharedItems()).
+   * Les valeurs de \a var ne doivent pas être modifiées avant l'appel
+   * à endSynchronize().
+   *
+   * Une seule synchronisation non bloquante peut être en cours pour
+   * une instance. Les synchronisations bloquantes restent possibles
+   * pendant ce temps.
+   *
+   * Cette opération est collective.
+   */
+  virtual void beginSynchronize(IVariable* var) = 0;
+
+  /*!
+   * \brief Commence la synchronisation des variables \a vars en mode non bloquant.
+   *
+   * Les contraintes sont les mêmes que pour synchronize(VariableCollection)
+   * et beginSynchronize(IVariable*). Si les variables ne peuvent pas être
+   * synchronisées en une seule fois (par exemple si certaines sont partielles),
+   * la synchronisation est effectuée en mode bloquant dans cette méthode.
+   */
+  virtual void beginSynchronize(VariableCollection vars) = 0;
+
+  /*!
+   * \brief Termine la synchronisation commencée par beginSynchronize().
+   *
+   * En retour, les valeurs des entités fantômes sont à jour.
+   */
+  virtual void endSynchronize() = 0;
+
+  //! Indique si une synchronisation commencée par beginSynchronize() est en cours
+  virtual bool hasPendingSynchronize() const = 0;
+
   /*!
    * \brief Rangs des sous-domaines avec lesquels on communique.
    */
@@ -115,7 +153,9 @@ class ARCANE_CORE_EXPORT IVariableSynchronizer
    *
    * Cet évènement est envoyé lors des appels aux méthodes
    * de synchronisation synchronize(IVariable* var)
-   * et synchronize(VariableCollection vars). Si on souhaite être notifié
+   * et synchronize(VariableCollection vars). Pour les synchronisations
+   * non bloquantes, l'évènement de début est envoyé par beginSynchronize() et
+   * celui de fin par endSynchronize(). Si on souhaite être notifié
    * des synchronisations pour toutes les instances de IVariableSynchronizer,
    * il faut utiliser IVariableMng::synchronizerMng().
    */
@@ -1,11 +1,11 @@
 ﻿// -*- tab-width: 2; indent-tabs-mode: nil; coding: utf-8-with-signature -*-
 //-----------------------------------------------------------------------------
-// Copyright 2000-2023 CEA (www.cea.fr) IFPEN (www.ifpenergiesnouvelles.com)
+// Copyright 2000-2024 CEA (www.cea.fr) IFPEN (www.ifpenergiesnouvelles.com)
 // See the top-level COPYRIGHT file for details.
 // SPDX-License-Identifier: Apache-2.0
 //-----------------------------------------------------------------------------
 /*---------------------------------------------------------------------------*/
-/* IVariableSynchronizerMng.h                                  (C) 2000-2023 */
+/* IVariableSynchronizerMng.h                                  (C) 2000-2024 */
 /*                                                                           */
 /* Interface du gestionnaire de synchronisation des variables.               */
 /*---------------------------------------------------------------------------*/
@@ -63,6 +63,20 @@ class ARCANE_CORE_EXPORT IVariableSynchronizerMng
   //! Indique si on effectue les comparaisons des valeurs avant et après synchronisation
   virtual bool isSynchronizationComparisonEnabled() const = 0;
 
+  /*!
+   * \brief Positionne pour la variable \a var la taille minimale (en octet)
+   * d'un message de synchronisation pour essayer de le compresser.
+   *
+   * Cette valeur n'est utilisée que si la compression des synchronisations
+   * est active (variable d'environnement ARCANE_SYNCHRONIZE_COMPRESSOR).
+   * Si \a size est négatif, la variable utilise la valeur par défaut.
+   * Une variable ayant une taille spécifique est toujours synchronisée
+   * seule et jamais lors d'une synchronisation multiple.
+   *
+   * La valeur doit être la même sur l'ensemble des rangs de parallelMng().
+   */
+  virtual void setSynchronizeCompressMinSize(IVariable* var, Int64 size) = 0;
+
   /*!
    * \brief Affiche les statistiques sur le flot \a ostr.
    *
@@ -221,6 +221,55 @@ interface() const
   return ItemGroup(m_impl->interfaceGroup());
 }
 
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+/*!
+ * \brief Groupe des entités propres qui ne sont pas connectées à une entité fantôme.
+ *
+ * Une entité est connectée à une entité fantôme si l'un de ses noeuds
+ * appartient à une entité fantôme de la même famille. Pour les noeuds, on
+ * considère les noeuds des mailles connectées au noeud. Les valeurs
+ * d'une variable sur les entités de ce groupe peuvent donc être calculées
+ * avec un stencil aux noeuds sans utiliser les valeurs des entités fantômes,
+ * par exemple pendant une synchronisation non bloquante
+ * (IVariableSynchronizer::beginSynchronize()).
+ *
+ * Les groupes innerOwn() et boundaryOwn() forment une partition de own().
+ * Ils sont recalculés automatiquement lorsque les entités de la famille
+ * ou leurs propriétaires changent.
+ *
+ * Pour les familles sans connectivité aux noeuds (particules, DoF),
+ * toutes les entités propres sont considérées comme connectées
+ * aux entités fantômes.
+ *
+ * Ce groupe n'existe que pour le groupe de toutes les entités d'une famille
+ * (IItemFamily::allItems()). Pour les autres groupes, le groupe nul est retourné.
+ */
+ItemGroup ItemGroup::
+innerOwn() const
+{
+  if (null())
+    return ItemGroup();
+  m_impl->checkNeedUpdate();
+  return ItemGroup(m_impl->innerOwnGroup());
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+/*!
+ * \brief Groupe des entités propres qui sont connectées à une entité fantôme.
+ *
+ * Il s'agit du complémentaire de innerOwn() dans own().
+ */
+ItemGroup ItemGroup::
+boundaryOwn() const
+{
+  if (null())
+    return ItemGroup();
+  m_impl->checkNeedUpdate();
+  return ItemGroup(m_impl->boundaryOwnGroup());
+}
+
 /*---------------------------------------------------------------------------*/
 /*---------------------------------------------------------------------------*/
 
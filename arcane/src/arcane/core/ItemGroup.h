@@ -143,6 +143,12 @@ class ARCANE_CORE_EXPORT ItemGroup
   // Implemented for faces only
   ItemGroup interface() const;
 
+  //! Entités propres qui ne sont pas connectées à une entité fantôme (uniquement pour le groupe de toutes les entités)
+  ItemGroup innerOwn() const;
+
+  //! Entités propres qui sont connectées à une entité fantôme (uniquement pour le groupe de toutes les entités)
+  ItemGroup boundaryOwn() const;
+
   //! Groupe des noeuds des éléments de ce groupe
   NodeGroup nodeGroup() const;
 
@@ -437,6 +443,16 @@ class ItemGroupT
     return ThatClass(ItemGroup::own());
   }
 
+  ThatClass innerOwn() const
+  {
+    return ThatClass(ItemGroup::innerOwn());
+  }
+
+  ThatClass boundaryOwn() const
+  {
+    return ThatClass(ItemGroup::boundaryOwn());
+  }
+
   ItemEnumeratorT<T> enumerator() const
   {
     return ItemEnumeratorT<T>::fromItemEnumerator(ItemGroup::enumerator());
@@ -1,11 +1,11 @@
 ﻿// -*- tab-width: 2; indent-tabs-mode: nil; coding: utf-8-with-signature -*-
 //-----------------------------------------------------------------------------
-// Copyright 2000-2023 CEA (www.cea.fr) IFPEN (www.ifpenergiesnouvelles.com)
+// Copyright 2000-2024 CEA (www.cea.fr) IFPEN (www.ifpenergiesnouvelles.com)
 // See the top-level COPYRIGHT file for details.
 // SPDX-License-Identifier: Apache-2.0
 //-----------------------------------------------------------------------------
 /*---------------------------------------------------------------------------*/
-/* ItemGroupComputeFunctor.cc                                  (C) 2000-2023 */
+/* ItemGroupComputeFunctor.cc                                  (C) 2000-2024 */
 /*                                                                           */
 /* Functors de calcul des éléments d'un groupe en fonction d'un autre groupe */
 /*---------------------------------------------------------------------------*/
@@ -128,6 +128,127 @@ executeFunctor()
 }
 
 
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+namespace
+{
+  /*!
+   * \brief Remplit \a items_lid avec les entités propres de \a parent qui
+   * sont (si \a want_boundary est vrai) ou ne sont pas connectées à une
+   * entité fantôme de la même famille.
+   *
+   * Une entité est connectée à une entité fantôme si l'un de ses noeuds
+   * est un noeud d'une entité fantôme. Pour les noeuds, on regarde les noeuds
+   * des mailles connectées.
+   */
+  void _fillInnerOrBoundaryOwnItems(ItemGroup parent, bool want_boundary, Int32Array& items_lid)
+  {
+    IItemFamily* family = parent.itemFamily();
+    eItemKind ik = family->itemKind();
+    bool has_nodes = (ik == IK_Node || ik == IK_Edge || ik == IK_Face || ik == IK_Cell);
+
+    // Sans connectivité aux noeuds, on ne sait pas déterminer le voisinage.
+    // Toutes les entités propres sont alors considérées au bord.
+    if (!has_nodes) {
+      if (want_boundary) {
+        ENUMERATE_ITEM (iitem, parent) {
+          if ((*iitem).isOwn())
+            items_lid.add(iitem.itemLocalId());
+        }
+      }
+      return;
+    }
+
+    // Marque les noeuds des entités fantômes
+    IItemFamily* node_family = parent.mesh()->nodeFamily();
+    BoolUniqueArray ghost_nodes(node_family->maxLocalId());
+    ghost_nodes.fill(false);
+    ENUMERATE_ITEM (iitem, family->allItems()) {
+      Item item = *iitem;
+      if (item.isOwn())
+        continue;
+      if (ik == IK_Node)
+        ghost_nodes[iitem.itemLocalId()] = true;
+      else
+        for (NodeLocalId node_id : item.toItemWithNodes().nodeIds())
+          ghost_nodes[node_id] = true;
+    }
+
+    auto has_ghost_node = [&](ItemWithNodes item) {
+      for (NodeLocalId node_id : item.nodeIds())
+        if (ghost_nodes[node_id])
+          return true;
+      return false;
+    };
+
+    ENUMERATE_ITEM (iitem, parent) {
+      Item item = *iitem;
+      if (!item.isOwn())
+        continue;
+      bool is_boundary = false;
+      if (ik == IK_Node) {
+        for (Cell cell : item.toNode().cells()) {
+          if (has_ghost_node(cell)) {
+            is_boundary = true;
+            break;
+          }
+        }
+      }
+      else
+        is_boundary = has_ghost_node(item.toItemWithNodes());
+      if (is_boundary == want_boundary)
+        items_lid.add(iitem.itemLocalId());
+    }
+  }
+} // namespace
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+void InnerOwnItemGroupComputeFunctor::
+executeFunctor()
+{
+  ITraceMng* trace = m_group->mesh()->traceMng();
+  ItemGroup parent(m_group->parent());
+
+  m_group->beginTransaction();
+  Int32UniqueArray items_lid;
+  _fillInnerOrBoundaryOwnItems(parent, false, items_lid);
+  m_group->setItems(items_lid);
+  m_group->endTransaction();
+
+  trace->debug() << "InnerOwnItemGroupComputeFunctor::execute()"
+                 << " this=" << m_group
+                 << " parent_name=" << parent.name()
+                 << " name=" << m_group->name()
+                 << " parent_count=" << parent.size()
+                 << " mysize=" << m_group->size();
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+void BoundaryOwnItemGroupComputeFunctor::
+executeFunctor()
+{
+  ITraceMng* trace = m_group->mesh()->traceMng();
+  ItemGroup parent(m_group->parent());
+
+  m_group->beginTransaction();
+  Int32UniqueArray items_lid;
+  _fillInnerOrBoundaryOwnItems(parent, true, items_lid);
+  m_group->setItems(items_lid);
+  m_group->endTransaction();
+
+  trace->debug() << "BoundaryOwnItemGroupComputeFunctor::execute()"
+                 << " this=" << m_group
+                 << " parent_name=" << parent.name()
+                 << " name=" << m_group->name()
+                 << " parent_count=" << parent.size()
+                 << " mysize=" << m_group->size();
+}
+
 /*---------------------------------------------------------------------------*/
 /*---------------------------------------------------------------------------*/
 /*!
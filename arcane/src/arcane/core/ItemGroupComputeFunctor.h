@@ -1,11 +1,11 @@
 ﻿// -*- tab-width: 2; indent-tabs-mode: nil; coding: utf-8-with-signature -*-
 //-----------------------------------------------------------------------------
-// Copyright 2000-2022 CEA (www.cea.fr) IFPEN (www.ifpenergiesnouvelles.com)
+// Copyright 2000-2024 CEA (www.cea.fr) IFPEN (www.ifpenergiesnouvelles.com)
 // See the top-level COPYRIGHT file for details.
 // SPDX-License-Identifier: Apache-2.0
 //-----------------------------------------------------------------------------
 /*---------------------------------------------------------------------------*/
-/* ItemGroupComputeFunctor.h                                   (C) 2000-2016 */
+/* ItemGroupComputeFunctor.h                                   (C) 2000-2024 */
 /*                                                                           */
 /* Functors de calcul des éléments d'un groupe en fonction d'un autre groupe */
 /*---------------------------------------------------------------------------*/
@@ -76,6 +76,26 @@ class ItemItemGroupComputeFunctor
 /*---------------------------------------------------------------------------*/
 /*---------------------------------------------------------------------------*/
 
+class InnerOwnItemGroupComputeFunctor
+: public ItemGroupComputeFunctor
+{
+ public:
+  void executeFunctor() override;
+};
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+class BoundaryOwnItemGroupComputeFunctor
+: public ItemGroupComputeFunctor
+{
+ public:
+  void executeFunctor() override;
+};
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
 class InnerFaceItemGroupComputeFunctor
 : public ItemGroupComputeFunctor
 {
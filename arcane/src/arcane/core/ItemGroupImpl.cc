@@ -378,6 +378,40 @@ interfaceGroup()
 /*---------------------------------------------------------------------------*/
 /*---------------------------------------------------------------------------*/
 
+ItemGroupImpl* ItemGroupImpl::
+innerOwnGroup()
+{
+  if (!isAllItems())
+    return checkSharedNull();
+  ItemGroupImpl* ii = m_p->m_inner_own_group;
+  if (!ii) {
+    ii = createSubGroup("InnerOwn",m_p->m_item_family,new InnerOwnItemGroupComputeFunctor());
+    m_p->m_inner_own_group = ii;
+    ii->setOwn(true);
+  }
+  return ii;
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+ItemGroupImpl* ItemGroupImpl::
+boundaryOwnGroup()
+{
+  if (!isAllItems())
+    return checkSharedNull();
+  ItemGroupImpl* ii = m_p->m_boundary_own_group;
+  if (!ii) {
+    ii = createSubGroup("BoundaryOwn",m_p->m_item_family,new BoundaryOwnItemGroupComputeFunctor());
+    m_p->m_boundary_own_group = ii;
+    ii->setOwn(true);
+  }
+  return ii;
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
 ItemGroupImpl* ItemGroupImpl::
 nodeGroup()
 {
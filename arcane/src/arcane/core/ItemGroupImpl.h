@@ -139,6 +139,22 @@ class ARCANE_CORE_EXPORT ItemGroupImpl
   // Implemented for faces only
   ItemGroupImpl* interfaceGroup();
 
+  /*!
+   * \brief Groupe des entités propres qui ne sont pas connectées à une entité fantôme.
+   *
+   * Ce groupe n'existe que pour le groupe de toutes les entités d'une famille.
+   * Voir ItemGroup::innerOwn() pour plus d'informations.
+   */
+  ItemGroupImpl* innerOwnGroup();
+
+  /*!
+   * \brief Groupe des entités propres qui sont connectées à une entité fantôme.
+   *
+   * Ce groupe n'existe que pour le groupe de toutes les entités d'une famille.
+   * Voir ItemGroup::boundaryOwn() pour plus d'informations.
+   */
+  ItemGroupImpl* boundaryOwnGroup();
+
   //! Groupe des noeuds des éléments de ce groupe
   ItemGroupImpl* nodeGroup();
 
@@ -167,6 +167,8 @@ resetSubGroups()
   m_own_group = nullptr;
   m_ghost_group = nullptr;
   m_interface_group = nullptr;
+  m_inner_own_group = nullptr;
+  m_boundary_own_group = nullptr;
   m_node_group = nullptr;
   m_edge_group = nullptr;
   m_face_group = nullptr;
@@ -559,6 +559,7 @@ property() const
   bool want_notemporary = false;
   bool want_exchange = false;
   bool want_persistant = false;
+  bool want_delta_sync = false;
 
   int property = 0;
   for( VarRefEnumerator i(this); i.hasNext(); ++i ){
@@ -584,6 +585,8 @@ property() const
       want_exchange = true;
     if ( ! (p & IVariable::PTemporary) )
       want_notemporary = true;
+    if ( (p & IVariable::PDeltaSync) )
+      want_delta_sync = true;
   }
 
   if (!want_dump)
@@ -606,6 +609,8 @@ property() const
     property |= IVariable::PNoExchange;
   if (!want_notemporary)
     property |= IVariable::PTemporary;
+  if (want_delta_sync)
+    property |= IVariable::PDeltaSync;
 
   m_p->m_property = property;
   return m_p->m_property;
@@ -428,6 +428,7 @@ _checkValidPropertyChanged(int property)
   case IVariable::PNoExchange:
   case IVariable::PPersistant:
   case IVariable::PNoReplicaSync:
+  case IVariable::PDeltaSync:
     return true;
   case IVariable::PHasTrace:
   case IVariable::PPrivate:
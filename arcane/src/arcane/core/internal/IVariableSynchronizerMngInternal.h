@@ -1,11 +1,11 @@
 ﻿// -*- tab-width: 2; indent-tabs-mode: nil; coding: utf-8-with-signature -*-
 //-----------------------------------------------------------------------------
-// Copyright 2000-2023 CEA (www.cea.fr) IFPEN (www.ifpenergiesnouvelles.com)
+// Copyright 2000-2024 CEA (www.cea.fr) IFPEN (www.ifpenergiesnouvelles.com)
 // See the top-level COPYRIGHT file for details.
 // SPDX-License-Identifier: Apache-2.0
 //-----------------------------------------------------------------------------
 /*---------------------------------------------------------------------------*/
-/* IVariableSynchronizerMngInternal.h                          (C) 2000-2023 */
+/* IVariableSynchronizerMngInternal.h                          (C) 2000-2024 */
 /*                                                                           */
 /* API interne à Arcane de IVariableSynchronizerMng.                         */
 /*---------------------------------------------------------------------------*/
@@ -23,6 +23,7 @@
 namespace Arcane
 {
 class MemoryBuffer;
+class IDataCompressor;
 
 /*---------------------------------------------------------------------------*/
 /*---------------------------------------------------------------------------*/
@@ -39,6 +40,39 @@ class ARCANE_CORE_EXPORT IVariableSynchronizerMngInternal
 
   virtual Ref<MemoryBuffer> createSynchronizeBuffer(IMemoryAllocator* allocator) = 0;
   virtual void releaseSynchronizeBuffer(IMemoryAllocator* allocator,MemoryBuffer* v) = 0;
+
+  /*!
+   * \brief Service de compression des messages de synchronisation.
+   *
+   * Retourne \a nullptr si la compression n'est pas active.
+   */
+  virtual IDataCompressor* synchronizeCompressor() const = 0;
+
+  /*!
+   * \brief Taille minimale (en octet) d'un message pour essayer de le compresser.
+   *
+   * Cette valeur doit être la même pour tous les rangs.
+   */
+  virtual Int64 synchronizeCompressMinSize() const = 0;
+
+  /*!
+   * \brief Taille minimale (en octet) spécifique à la variable \a var d'un
+   * message pour essayer de le compresser.
+   *
+   * Retourne -1 si la variable utilise synchronizeCompressMinSize().
+   *
+   * \sa IVariableSynchronizerMng::setSynchronizeCompressMinSize().
+   */
+  virtual Int64 variableCompressMinSize(IVariable* var) const = 0;
+
+  /*!
+   * \brief Ajoute les statistiques d'envoi d'un message pour lequel
+   * la compression a été essayée.
+   *
+   * \a original_size est la taille non compressée et \a sent_size la
+   * taille effectivement envoyée (sans l'en-tête).
+   */
+  virtual void addCompressStats(Int64 original_size, Int64 sent_size) = 0;
 };
 
 /*---------------------------------------------------------------------------*/
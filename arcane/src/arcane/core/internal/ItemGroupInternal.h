@@ -137,6 +137,8 @@ class ItemGroupInternal
   ItemGroupImpl* m_own_group = nullptr; //!< Items owned by the subdomain
   ItemGroupImpl* m_ghost_group = nullptr; //!< Items not owned by the subdomain
   ItemGroupImpl* m_interface_group = nullptr; //!< Items on the boundary of two subdomains
+  ItemGroupImpl* m_inner_own_group = nullptr; //!< Entités propres non connectées aux entités fantômes
+  ItemGroupImpl* m_boundary_own_group = nullptr; //!< Entités propres connectées aux entités fantômes
   ItemGroupImpl* m_node_group = nullptr; //!< Groupe des noeuds
   ItemGroupImpl* m_edge_group = nullptr; //!< Groupe des arêtes
   ItemGroupImpl* m_face_group = nullptr; //!< Groupe des faces
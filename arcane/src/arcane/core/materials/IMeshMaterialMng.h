@@ -339,6 +339,26 @@ class ARCANE_CORE_EXPORT IMeshMaterialMng
    */
   virtual void forceRecompute() =0;
 
+  /*!
+   * \brief Défragmente les valeurs partielles des variables matériaux.
+   *
+   * Après de nombreuses modifications incrémentales (via MeshMaterialModifier),
+   * les valeurs partielles d'un matériau ou d'un milieu contiennent des trous
+   * et ne sont plus rangées suivant le localId() des mailles, ce qui rend
+   * les accès mémoire aléatoires lors des parcours des mailles matériaux.
+   *
+   * Cette méthode trie les mailles de chaque matériau et milieu fragmenté
+   * suivant leur localId() et permute en une seule passe les valeurs
+   * partielles de toutes les variables matériaux. Les valeurs des variables
+   * sont conservées mais, comme après une modification des matériaux,
+   * les vecteurs de mailles matériaux (MatCellVector, EnvCellVector, ...)
+   * créés avant l'appel sont invalidés.
+   *
+   * Voir MeshMaterialModifier::setDefragmentThreshold() pour
+   * effectuer automatiquement cette opération.
+   */
+  virtual void defragmentPartialValues() =0;
+
   //! Verrou utilisé pour le multi-threading
   virtual Mutex* variableLock() =0;
 
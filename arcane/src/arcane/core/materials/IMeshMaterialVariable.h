@@ -1,11 +1,11 @@
 ﻿// -*- tab-width: 2; indent-tabs-mode: nil; coding: utf-8-with-signature -*-
 //-----------------------------------------------------------------------------
-// Copyright 2000-2023 CEA (www.cea.fr) IFPEN (www.ifpenergiesnouvelles.com)
+// Copyright 2000-2024 CEA (www.cea.fr) IFPEN (www.ifpenergiesnouvelles.com)
 // See the top-level COPYRIGHT file for details.
 // SPDX-License-Identifier: Apache-2.0
 //-----------------------------------------------------------------------------
 /*---------------------------------------------------------------------------*/
-/* IMeshMaterialVariable.h                                     (C) 2000-2023 */
+/* IMeshMaterialVariable.h                                     (C) 2000-2024 */
 /*                                                                           */
 /* Interface d'un variable sur un matériau du maillage.                      */
 /*---------------------------------------------------------------------------*/
@@ -109,6 +109,53 @@ class ARCANE_CORE_EXPORT IMeshMaterialVariable
    */
   virtual bool keepOnChange() const =0;
 
+  /*!
+   * \brief Active ou désactive l'allocation à la demande des valeurs partielles.
+   *
+   * Si ce mode est actif, les valeurs partielles d'un composant (milieu ou
+   * matériau) ne sont allouées que lors de l'appel à allocatePartialValues()
+   * ou lors de la première écriture via update() ou fillFromArray().
+   * Lorsque ce mode est activé, les valeurs partielles de tous les composants
+   * sont libérées, sauf en reprise où seuls les composants dont les valeurs
+   * n'étaient pas allouées lors de la protection sont libérés.
+   *
+   * Ce mode n'est pas conservé lors d'une reprise. Il faut appeler de nouveau
+   * cette méthode après la relecture des variables, par exemple dans un point
+   * d'entrée de type 'continue-init'.
+   *
+   * Les valeurs partielles d'un composant non alloué ne doivent pas être
+   * accédées. En mode vérification, un accès via les vues est détecté.
+   * Les modifications des matériaux, les synchronisations et les
+   * sauvegardes ignorent les composants non alloués.
+   *
+   * Les appels à allocatePartialValues() et releasePartialValues() doivent
+   * être faits de la même manière sur tous les sous-domaines pour que les
+   * synchronisations soient cohérentes.
+   */
+  virtual void setAllocatePartialValuesOnDemand(bool v) =0;
+
+  //! Indique si les valeurs partielles sont allouées à la demande.
+  virtual bool isAllocatePartialValuesOnDemand() const =0;
+
+  /*!
+   * \brief Alloue les valeurs partielles du composant \a component.
+   *
+   * Les nouvelles valeurs sont initialisées avec celles de la variable
+   * globale ou avec zéro suivant IMeshMaterialMng::isDataInitialisationWithZero().
+   * Ne fait rien si les valeurs sont déjà allouées.
+   */
+  virtual void allocatePartialValues(IMeshComponent* component) =0;
+
+  /*!
+   * \brief Libère les valeurs partielles du composant \a component.
+   *
+   * Cette méthode n'est valide que si isAllocatePartialValuesOnDemand() est vrai.
+   */
+  virtual void releasePartialValues(IMeshComponent* component) =0;
+
+  //! Indique si les valeurs partielles du composant \a component sont allouées.
+  virtual bool hasPartialValues(IMeshComponent* component) const =0;
+
   /*!
    * \brief Synchronise la variable.
    *
@@ -88,6 +88,11 @@ class EnvAndGlobalCell
 {};
 class MatAndGlobalCell
 {};
+class SimdEnvCell
+{};
+class SimdMatCell
+{};
+class SimdMatVarIndex;
 class IMeshMaterialMngInternal;
 class MeshEnvironmentBuildInfo;
 class MeshBlockBuildInfo;
@@ -0,0 +1,75 @@
+﻿// -*- tab-width: 2; indent-tabs-mode: nil; coding: utf-8-with-signature -*-
+//-----------------------------------------------------------------------------
+// Copyright 2000-2024 CEA (www.cea.fr) IFPEN (www.ifpenergiesnouvelles.com)
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: Apache-2.0
+//-----------------------------------------------------------------------------
+/*---------------------------------------------------------------------------*/
+/* SimdMatVarIndex.h                                           (C) 2000-2024 */
+/*                                                                           */
+/* Index vectoriel sur les variables matériaux.                              */
+/*---------------------------------------------------------------------------*/
+#ifndef ARCANE_CORE_MATERIALS_SIMDMATVARINDEX_H
+#define ARCANE_CORE_MATERIALS_SIMDMATVARINDEX_H
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+#include "arcane/utils/Simd.h"
+
+#include "arcane/core/materials/MaterialsCoreGlobal.h"
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+namespace Arcane::Materials
+{
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+/*!
+ * \brief Indexeur SIMD sur un composant.
+ *
+ * Cette classe est l'équivalent vectoriel de MatVarIndex : elle contient
+ * l'indice du tableau de valeurs (arrayIndex()) et les SimdSize indices
+ * dans ce tableau (valueIndex()). Tous les indices d'une même instance
+ * font donc référence au même tableau de valeurs (partie pure ou
+ * partie impure du composant).
+ */
+class ARCANE_ALIGNAS(64) SimdMatVarIndex
+{
+ public:
+
+  typedef SimdEnumeratorBase::SimdIndexType SimdIndexType;
+
+ public:
+
+  SimdMatVarIndex(Int32 array_index, SimdIndexType value_index)
+  : m_value_index(value_index)
+  , m_array_index(array_index)
+  {
+  }
+  SimdMatVarIndex() {}
+
+ public:
+
+  //! Retourne l'indice du tableau de valeur dans la liste des variables.
+  Int32 arrayIndex() const { return m_array_index; }
+
+  //! Retourne l'indice dans le tableau de valeur
+  const SimdIndexType& valueIndex() const { return m_value_index; }
+
+ private:
+
+  SimdIndexType m_value_index;
+  Int32 m_array_index;
+};
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+} // End namespace Arcane::Materials
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+#endif
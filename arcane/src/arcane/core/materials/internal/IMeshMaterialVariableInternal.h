@@ -119,6 +119,16 @@ class ARCANE_CORE_EXPORT IMeshMaterialVariableInternal
 
   //! Redimensionne la valeur partielle associée à l'indexer \a index
   virtual void resizeForIndexer(Int32 index, RunQueue& queue) = 0;
+
+  /*!
+   * \brief Réordonne les valeurs partielles associées à l'indexer \a index.
+   *
+   * La nouvelle valeur d'indice \a i est l'ancienne valeur d'indice
+   * \a old_partial_indexes[i]. Les valeurs partielles sont ensuite
+   * redimensionnées au nombre d'éléments de \a old_partial_indexes.
+   */
+  virtual void defragmentForIndexer(Int32 index, SmallSpan<const Int32> old_partial_indexes,
+                                    RunQueue& queue) = 0;
 };
 
 /*---------------------------------------------------------------------------*/
@@ -7,6 +7,7 @@ set(ARCANE_MATERIALS_SOURCES
   materials/MatItem.h
   materials/MatVarIndex.h
   materials/MatVarIndex.cc
+  materials/SimdMatVarIndex.h
   materials/IEnumeratorTracer.h
   materials/IMeshMaterialVariable.cc
   materials/IMeshMaterialVariable.h
@@ -1,11 +1,11 @@
 ﻿// -*- tab-width: 2; indent-tabs-mode: nil; coding: utf-8-with-signature -*-
 //-----------------------------------------------------------------------------
-// Copyright 2000-2022 CEA (www.cea.fr) IFPEN (www.ifpenergiesnouvelles.com)
+// Copyright 2000-2024 CEA (www.cea.fr) IFPEN (www.ifpenergiesnouvelles.com)
 // See the top-level COPYRIGHT file for details.
 // SPDX-License-Identifier: Apache-2.0
 //-----------------------------------------------------------------------------
 /*---------------------------------------------------------------------------*/
-/* CheckpointMng.cc                                            (C) 2000-2018 */
+/* CheckpointMng.cc                                            (C) 2000-2024 */
 /*                                                                           */
 /* Gestionnaire des protections.                                             */
 /*---------------------------------------------------------------------------*/
@@ -87,6 +87,7 @@ class CheckpointMng
   void writeCheckpoint(ICheckpointWriter* writer) override;
   void writeCheckpoint(ICheckpointWriter* writer,ByteArray& infos) override;
   void writeDefaultCheckpoint(ICheckpointWriter* writer) override;
+  void waitDefaultCheckpoint() override;
   IObservable* writeObservable() override { return m_write_observable; }
   IObservable* readObservable() override { return m_read_observable; }
 
@@ -99,10 +100,15 @@ class CheckpointMng
   ISubDomain* m_sub_domain;
   IObservable* m_write_observable; //!< Observable en écriture
   IObservable* m_read_observable; //!< Observable en lecture
+  //! Ecrivain dont l'écriture asynchrone de la dernière protection est en cours
+  ICheckpointWriter* m_pending_writer = nullptr;
+  //! Informations de relecture de la protection en cours d'écriture
+  ByteUniqueArray m_pending_infos;
 
  private:
 
   void _writeCheckpointInfoFile(ICheckpointWriter* checkpoint_writer,ByteArray& infos);
+  void _writeDefaultCheckpointInfo(ByteConstArrayView infos);
   CheckpointInfo _readCheckpointInfo(Span<const Byte> infos,const String& info_file_name);
   void _readCheckpoint(const CheckpointInfo& checkpoint_info);
   void _readCheckpoint(const CheckpointReadInfo& infos);
@@ -395,14 +401,54 @@ writeCheckpoint(ICheckpointWriter* writer)
 void CheckpointMng::
 writeDefaultCheckpoint(ICheckpointWriter* writer)
 {
+  // Termine la protection précédente si son écriture est asynchrone.
+  waitDefaultCheckpoint();
+
   ByteUniqueArray bytes_infos;
   writeCheckpoint(writer,bytes_infos);
 
+  // Si l'écriture n'est pas terminée, il ne faut pas encore référencer
+  // cette protection dans les informations de relecture car ses données
+  // ne sont pas complètes. Elles seront mises à jour par
+  // waitDefaultCheckpoint(). D'ici là, une reprise utilisera la
+  // protection précédente.
+  if (writer->isWriteInProgress()){
+    m_pending_writer = writer;
+    m_pending_infos.swap(bytes_infos);
+    return;
+  }
+  _writeDefaultCheckpointInfo(bytes_infos);
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+void CheckpointMng::
+waitDefaultCheckpoint()
+{
+  if (!m_pending_writer)
+    return;
+  ICheckpointWriter* writer = m_pending_writer;
+  m_pending_writer = nullptr;
+  ByteUniqueArray bytes_infos;
+  bytes_infos.swap(m_pending_infos);
+  // Relance l'exception si l'écriture a échoué. Dans ce cas, les
+  // informations de relecture ne sont pas modifiées.
+  writer->waitCheckpoint();
+  _writeDefaultCheckpointInfo(bytes_infos);
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+void CheckpointMng::
+_writeDefaultCheckpointInfo(ByteConstArrayView infos)
+{
   if (m_sub_domain->allReplicaParallelMng()->isMasterIO()){
     Directory export_directory(m_sub_domain->exportDirectory());
     String info_file(export_directory.file("checkpoint_info.xml"));
     std::ofstream ofile(info_file.localstr());
-    ofile.write((const char*)bytes_infos.unguardedBasePointer(),bytes_infos.size());
+    ofile.write((const char*)infos.data(),infos.size());
     if (!ofile.good())
       ARCANE_THROW(IOException,"Can not write file '{0}'",info_file);
   }
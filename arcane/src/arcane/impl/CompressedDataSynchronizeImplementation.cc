@@ -0,0 +1,312 @@
+﻿// -*- tab-width: 2; indent-tabs-mode: nil; coding: utf-8-with-signature -*-
+//-----------------------------------------------------------------------------
+// Copyright 2000-2024 CEA (www.cea.fr) IFPEN (www.ifpenergiesnouvelles.com)
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: Apache-2.0
+//-----------------------------------------------------------------------------
+/*---------------------------------------------------------------------------*/
+/* CompressedDataSynchronizeImplementation.cc                  (C) 2000-2024 */
+/*                                                                           */
+/* Synchronisation avec compression des messages.                            */
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+#include "arcane/utils/Array.h"
+#include "arcane/utils/FatalErrorException.h"
+#include "arcane/utils/IDataCompressor.h"
+#include "arcane/utils/MemoryView.h"
+#include "arcane/utils/ParallelLoopOptions.h"
+
+#include "arcane/core/IParallelMng.h"
+#include "arcane/core/Concurrency.h"
+#include "arcane/core/internal/IVariableSynchronizerMngInternal.h"
+
+#include "arcane/impl/IDataSynchronizeBuffer.h"
+#include "arcane/impl/IDataSynchronizeImplementation.h"
+
+#include <cstring>
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+namespace Arcane
+{
+
+namespace
+{
+  ArrayView<Byte>
+  _toLegacySmallView(Span<std::byte> bytes)
+  {
+    Int32 size = bytes.smallView().size();
+    return { size, reinterpret_cast<Byte*>(bytes.data()) };
+  }
+} // namespace
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+/*!
+ * \brief Implémentation de la synchronisation avec compression des messages.
+ *
+ * Cette implémentation est similaire à SimpleDataSynchronizeImplementation
+ * mais les messages dont la taille est supérieure ou égale à un seuil sont
+ * compressés entre la recopie dans le buffer d'envoi et l'envoi. Ce seuil
+ * est IVariableSynchronizerMngInternal::synchronizeCompressMinSize() ou
+ * celui spécifié par la fabrique pour les variables ayant un seuil
+ * spécifique (IVariableSynchronizerMng::setSynchronizeCompressMinSize()).
+ * Comme la
+ * taille d'un message compressé n'est pas connue à l'avance par le
+ * destinataire, ces messages commencent par un en-tête de type Int64
+ * contenant la taille compressée (ou 0 si le message n'est pas compressé
+ * car la compression ne fait pas gagner de place). La réception se fait
+ * dans un buffer dont la taille est celle du message non compressé plus
+ * celle de l'en-tête.
+ *
+ * Les messages plus petits que le seuil sont envoyés directement sans
+ * recopie supplémentaire. Comme les deux rangs connaissent la taille non
+ * compressée, ils font toujours le même choix.
+ *
+ * La compression et la décompression des messages des différents rangs
+ * sont effectuées en parallèle (IDataCompressor peut être utilisé
+ * simultanément par plusieurs threads).
+ *
+ * Les buffers de synchronisation doivent être accessibles depuis l'hôte.
+ */
+class CompressedDataSynchronizeImplementation
+: public AbstractDataSynchronizeImplementation
+{
+  static constexpr Int64 HEADER_SIZE = sizeof(Int64);
+
+ public:
+
+  class Factory;
+  explicit CompressedDataSynchronizeImplementation(Factory* f);
+
+ protected:
+
+  void compute() override {}
+  void beginSynchronize(IDataSynchronizeBuffer* buf) override;
+  void endSynchronize(IDataSynchronizeBuffer* buf) override;
+
+ private:
+
+  IParallelMng* m_parallel_mng = nullptr;
+  IVariableSynchronizerMngInternal* m_synchronizer_mng = nullptr;
+  IDataCompressor* m_compressor = nullptr;
+  Int64 m_min_compress_size = 0;
+  UniqueArray<Parallel::Request> m_all_requests;
+  //! Messages (avec en-tête) à envoyer pour chaque rang
+  UniqueArray<UniqueArray<std::byte>> m_send_messages;
+  //! Messages (avec en-tête) reçus pour chaque rang
+  UniqueArray<UniqueArray<std::byte>> m_receive_messages;
+  //! Buffers de compression pour chaque rang
+  UniqueArray<UniqueArray<std::byte>> m_compress_buffers;
+
+ private:
+
+  bool _isCompressed(Int64 size) const { return size >= m_min_compress_size; }
+  void _compressMessage(IDataSynchronizeBuffer* vs_buf, Int32 index);
+  void _decompressMessage(IDataSynchronizeBuffer* vs_buf, Int32 index);
+};
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+class CompressedDataSynchronizeImplementation::Factory
+: public IDataSynchronizeImplementationFactory
+{
+ public:
+
+  Factory(IParallelMng* pm, IVariableSynchronizerMngInternal* sync_mng, Int64 min_compress_size)
+  : m_parallel_mng(pm)
+  , m_synchronizer_mng(sync_mng)
+  , m_min_compress_size(min_compress_size)
+  {}
+
+  Ref<IDataSynchronizeImplementation> createInstance() override
+  {
+    auto* x = new CompressedDataSynchronizeImplementation(this);
+    return makeRef<IDataSynchronizeImplementation>(x);
+  }
+
+ public:
+
+  IParallelMng* m_parallel_mng = nullptr;
+  IVariableSynchronizerMngInternal* m_synchronizer_mng = nullptr;
+  //! Seuil de compression (négatif pour utiliser celui de \a m_synchronizer_mng)
+  Int64 m_min_compress_size = -1;
+};
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+CompressedDataSynchronizeImplementation::
+CompressedDataSynchronizeImplementation(Factory* f)
+: m_parallel_mng(f->m_parallel_mng)
+, m_synchronizer_mng(f->m_synchronizer_mng)
+, m_compressor(m_synchronizer_mng->synchronizeCompressor())
+, m_min_compress_size(f->m_min_compress_size)
+{
+  if (!m_compressor)
+    ARCANE_FATAL("No compressor available for synchronization");
+  if (m_min_compress_size < 0)
+    m_min_compress_size = m_synchronizer_mng->synchronizeCompressMinSize();
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+/*!
+ * \brief Créé une fabrique pour les synchronisations compressées.
+ *
+ * Si \a min_compress_size est négatif, le seuil de compression est
+ * IVariableSynchronizerMngInternal::synchronizeCompressMinSize().
+ */
+extern "C++" Ref<IDataSynchronizeImplementationFactory>
+arcaneCreateCompressedVariableSynchronizerFactory(IParallelMng* pm, IVariableSynchronizerMngInternal* sync_mng,
+                                                  Int64 min_compress_size)
+{
+  auto* x = new CompressedDataSynchronizeImplementation::Factory(pm, sync_mng, min_compress_size);
+  return makeRef<IDataSynchronizeImplementationFactory>(x);
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+void CompressedDataSynchronizeImplementation::
+beginSynchronize(IDataSynchronizeBuffer* vs_buf)
+{
+  ARCANE_CHECK_POINTER(vs_buf);
+  IParallelMng* pm = m_parallel_mng;
+
+  Int32 nb_message = vs_buf->nbRank();
+  m_send_messages.resize(nb_message);
+  m_receive_messages.resize(nb_message);
+  m_compress_buffers.resize(nb_message);
+
+  // Poste les réceptions non bloquantes
+  for (Integer i = 0; i < nb_message; ++i) {
+    Int32 target_rank = vs_buf->targetRank(i);
+    Span<std::byte> receive_buf = vs_buf->receiveBuffer(i).bytes();
+    Int64 size = receive_buf.size();
+    if (size == 0)
+      continue;
+    if (_isCompressed(size)) {
+      UniqueArray<std::byte>& message = m_receive_messages[i];
+      message.resize(HEADER_SIZE + size);
+      receive_buf = message.span();
+    }
+    m_all_requests.add(pm->recv(_toLegacySmallView(receive_buf), target_rank, false));
+  }
+
+  vs_buf->copyAllSend();
+
+  // Compresse les messages en parallèle.
+  {
+    ParallelLoopOptions options;
+    options.setGrainSize(1);
+    arcaneParallelFor(0, nb_message, options, [&](Int32 begin, Int32 size) {
+      for (Int32 i = begin; i < (begin + size); ++i)
+        _compressMessage(vs_buf, i);
+    });
+  }
+
+  // Envoie les messages en mode non bloquant.
+  for (Integer i = 0; i < nb_message; ++i) {
+    Int32 target_rank = vs_buf->targetRank(i);
+    Span<std::byte> send_buf = vs_buf->sendBuffer(i).bytes();
+    Int64 size = send_buf.size();
+    if (size == 0)
+      continue;
+    if (_isCompressed(size)) {
+      UniqueArray<std::byte>& message = m_send_messages[i];
+      m_synchronizer_mng->addCompressStats(size, message.largeSize() - HEADER_SIZE);
+      send_buf = message.span();
+    }
+    m_all_requests.add(pm->send(_toLegacySmallView(send_buf), target_rank, false));
+  }
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+/*!
+ * \brief Construit le message (avec en-tête) à envoyer pour le rang d'indice \a index.
+ *
+ * Cette méthode peut être appelée simultanément pour des indices différents.
+ */
+void CompressedDataSynchronizeImplementation::
+_compressMessage(IDataSynchronizeBuffer* vs_buf, Int32 index)
+{
+  Span<const std::byte> send_buf = vs_buf->sendBuffer(index).bytes();
+  Int64 size = send_buf.size();
+  if (size == 0 || !_isCompressed(size))
+    return;
+  UniqueArray<std::byte>& compress_buffer = m_compress_buffers[index];
+  m_compressor->compress(send_buf, compress_buffer);
+  Int64 compressed_size = compress_buffer.largeSize();
+  // Si la compression ne fait rien gagner, envoie les valeurs non compressées.
+  bool is_compressed = (compressed_size < size);
+  Int64 header = (is_compressed) ? compressed_size : 0;
+  Span<const std::byte> payload = (is_compressed) ? compress_buffer.constSpan() : send_buf;
+  UniqueArray<std::byte>& message = m_send_messages[index];
+  message.resize(HEADER_SIZE + payload.size());
+  std::memcpy(message.data(), &header, HEADER_SIZE);
+  std::memcpy(message.data() + HEADER_SIZE, payload.data(), payload.size());
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+void CompressedDataSynchronizeImplementation::
+endSynchronize(IDataSynchronizeBuffer* vs_buf)
+{
+  IParallelMng* pm = m_parallel_mng;
+
+  pm->waitAllRequests(m_all_requests);
+  m_all_requests.clear();
+
+  // Décompresse les messages reçus en parallèle.
+  Int32 nb_message = vs_buf->nbRank();
+  {
+    ParallelLoopOptions options;
+    options.setGrainSize(1);
+    arcaneParallelFor(0, nb_message, options, [&](Int32 begin, Int32 size) {
+      for (Int32 i = begin; i < (begin + size); ++i)
+        _decompressMessage(vs_buf, i);
+    });
+  }
+
+  vs_buf->copyAllReceive();
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+/*!
+ * \brief Décompresse le message reçu du rang d'indice \a index.
+ *
+ * Cette méthode peut être appelée simultanément pour des indices différents.
+ */
+void CompressedDataSynchronizeImplementation::
+_decompressMessage(IDataSynchronizeBuffer* vs_buf, Int32 index)
+{
+  Span<std::byte> receive_buf = vs_buf->receiveBuffer(index).bytes();
+  Int64 size = receive_buf.size();
+  if (size == 0 || !_isCompressed(size))
+    return;
+  Span<const std::byte> message = m_receive_messages[index].constSpan();
+  Int64 header = 0;
+  std::memcpy(&header, message.data(), HEADER_SIZE);
+  if (header < 0 || header >= size)
+    ARCANE_FATAL("Invalid compressed size '{0}' for message from rank '{1}' (size={2})",
+                 header, vs_buf->targetRank(index), size);
+  if (header == 0)
+    std::memcpy(receive_buf.data(), message.data() + HEADER_SIZE, size);
+  else
+    m_compressor->decompress(message.subspan(HEADER_SIZE, header), receive_buf);
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+} // namespace Arcane
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
@@ -1,11 +1,11 @@
 ﻿// -*- tab-width: 2; indent-tabs-mode: nil; coding: utf-8-with-signature -*-
 //-----------------------------------------------------------------------------
-// Copyright 2000-2023 CEA (www.cea.fr) IFPEN (www.ifpenergiesnouvelles.com)
+// Copyright 2000-2024 CEA (www.cea.fr) IFPEN (www.ifpenergiesnouvelles.com)
 // See the top-level COPYRIGHT file for details.
 // SPDX-License-Identifier: Apache-2.0
 //-----------------------------------------------------------------------------
 /*---------------------------------------------------------------------------*/
-/* DataSynchronizeDispatcher.cc                                (C) 2000-2023 */
+/* DataSynchronizeDispatcher.cc                                (C) 2000-2024 */
 /*                                                                           */
 /* Gestion de la synchronisation d'une instance de 'IData'.                  */
 /*---------------------------------------------------------------------------*/
@@ -220,21 +220,33 @@ class ARCANE_IMPL_EXPORT DataSynchronizeMultiDispatcher
 
   void compute() override {}
   void setSynchronizeBuffer(Ref<MemoryBuffer>) override {}
-  void synchronize(ConstArrayView<IVariable*> vars) override;
+  void beginSynchronize(ConstArrayView<IVariable*> vars) override;
+  void endSynchronize() override;
 
  private:
 
   IParallelMng* m_parallel_mng = nullptr;
   Ref<DataSynchronizeInfo> m_sync_info;
+  Ref<IParallelExchanger> m_exchanger;
+  UniqueArray<IVariable*> m_variables;
 };
 
 /*---------------------------------------------------------------------------*/
 /*---------------------------------------------------------------------------*/
 
+/*!
+ * \brief Commence la synchronisation.
+ *
+ * Cette implémentation utilise IParallelExchanger::processExchange() qui est
+ * bloquant. Les messages sont donc envoyés et reçus dans cette méthode et
+ * endSynchronize() se contente de recopier les valeurs reçues.
+ */
 void DataSynchronizeMultiDispatcher::
-synchronize(ConstArrayView<IVariable*> vars)
+beginSynchronize(ConstArrayView<IVariable*> vars)
 {
-  Ref<IParallelExchanger> exchanger{ ParallelMngUtils::createExchangerRef(m_parallel_mng) };
+  m_variables = vars;
+  m_exchanger = ParallelMngUtils::createExchangerRef(m_parallel_mng);
+  IParallelExchanger* exchanger = m_exchanger.get();
   Integer nb_rank = m_sync_info->size();
   Int32UniqueArray recv_ranks(nb_rank);
   for (Integer i = 0; i < nb_rank; ++i) {
@@ -258,15 +270,29 @@ synchronize(ConstArrayView<IVariable*> vars)
     }
   }
   exchanger->processExchange();
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+void DataSynchronizeMultiDispatcher::
+endSynchronize()
+{
+  IParallelExchanger* exchanger = m_exchanger.get();
+  if (!exchanger)
+    ARCANE_FATAL("beginSynchronize() has not been called");
+  Integer nb_rank = m_sync_info->size();
   for (Integer i = 0; i < nb_rank; ++i) {
     ISerializeMessage* msg = exchanger->messageToReceive(i);
     ISerializer* sbuf = msg->serializer();
     Int32ConstArrayView ghost_ids = m_sync_info->receiveInfo().localIds(i);
     sbuf->setMode(ISerializer::ModeGet);
-    for (IVariable* var : vars) {
+    for (IVariable* var : m_variables) {
       var->serialize(sbuf, ghost_ids, nullptr);
     }
   }
+  m_exchanger.reset();
+  m_variables.clear();
 }
 
 /*---------------------------------------------------------------------------*/
@@ -294,7 +320,8 @@ class ARCANE_IMPL_EXPORT DataSynchronizeMultiDispatcherV2
 
   void compute() override { _compute(); }
   void setSynchronizeBuffer(Ref<MemoryBuffer> buffer) override { m_sync_buffer.setSynchronizeBuffer(buffer); }
-  void synchronize(ConstArrayView<IVariable*> vars) override;
+  void beginSynchronize(ConstArrayView<IVariable*> vars) override;
+  void endSynchronize() override;
 
  private:
 
@@ -305,7 +332,7 @@ class ARCANE_IMPL_EXPORT DataSynchronizeMultiDispatcherV2
 /*---------------------------------------------------------------------------*/
 
 void DataSynchronizeMultiDispatcherV2::
-synchronize(ConstArrayView<IVariable*> vars)
+beginSynchronize(ConstArrayView<IVariable*> vars)
 {
   const Int32 nb_var = vars.size();
   m_sync_buffer.setNbData(nb_var);
@@ -330,6 +357,14 @@ synchronize(ConstArrayView<IVariable*> vars)
   m_sync_buffer.prepareSynchronize(all_datatype_size, is_compare_sync);
 
   m_synchronize_implementation->beginSynchronize(&m_sync_buffer);
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+void DataSynchronizeMultiDispatcherV2::
+endSynchronize()
+{
   m_synchronize_implementation->endSynchronize(&m_sync_buffer);
 }
 
@@ -0,0 +1,315 @@
+﻿// -*- tab-width: 2; indent-tabs-mode: nil; coding: utf-8-with-signature -*-
+//-----------------------------------------------------------------------------
+// Copyright 2000-2024 CEA (www.cea.fr) IFPEN (www.ifpenergiesnouvelles.com)
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: Apache-2.0
+//-----------------------------------------------------------------------------
+/*---------------------------------------------------------------------------*/
+/* DeltaDataSynchronizeImplementation.cc                       (C) 2000-2024 */
+/*                                                                           */
+/* Synchronisation n'envoyant que les valeurs modifiées.                     */
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+#include "arcane/utils/Array.h"
+#include "arcane/utils/FatalErrorException.h"
+#include "arcane/utils/MemoryView.h"
+
+#include "arcane/core/IParallelMng.h"
+
+#include "arcane/impl/IDataSynchronizeBuffer.h"
+#include "arcane/impl/IDataSynchronizeImplementation.h"
+
+#include <cstring>
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+namespace Arcane
+{
+
+namespace
+{
+  ArrayView<Byte>
+  _toLegacySmallView(Span<std::byte> bytes)
+  {
+    Int32 size = bytes.smallView().size();
+    return { size, reinterpret_cast<Byte*>(bytes.data()) };
+  }
+} // namespace
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+/*!
+ * \brief Implémentation de la synchronisation n'envoyant que les valeurs
+ * modifiées depuis la synchronisation précédente.
+ *
+ * Une instance de cette classe est associée à une seule variable. Pour chaque
+ * rang voisin, on conserve une copie du dernier buffer envoyé et du dernier
+ * buffer reçu. Les messages commencent par un en-tête de type Int64 qui
+ * vaut \a FULL_MESSAGE si le message contient toutes les valeurs ou
+ * \a DELTA_MESSAGE s'il contient un masque de bits (un bit par entité)
+ * suivi uniquement des valeurs des entités modifiées. Le destinataire
+ * reconstruit alors le buffer complet à partir de sa copie du dernier
+ * buffer reçu.
+ *
+ * L'émetteur envoie toutes les valeurs lors du premier envoi, si la taille
+ * du buffer a changé ou si le message différentiel n'est pas plus petit.
+ * Comme les deux rangs mettent à jour leur copie à chaque message,
+ * ces copies sont toujours identiques.
+ *
+ * La réception se fait dans un buffer dont la taille est celle du message
+ * complet plus celle de l'en-tête et du masque. Les buffers de
+ * synchronisation doivent être accessibles depuis l'hôte.
+ */
+class DeltaDataSynchronizeImplementation
+: public AbstractDataSynchronizeImplementation
+{
+  static constexpr Int64 HEADER_SIZE = sizeof(Int64);
+  static constexpr Int64 FULL_MESSAGE = 0;
+  static constexpr Int64 DELTA_MESSAGE = 1;
+
+ public:
+
+  class Factory;
+  explicit DeltaDataSynchronizeImplementation(Factory* f);
+
+ protected:
+
+  void compute() override {}
+  void beginSynchronize(IDataSynchronizeBuffer* buf) override;
+  void endSynchronize(IDataSynchronizeBuffer* buf) override;
+
+ private:
+
+  IParallelMng* m_parallel_mng = nullptr;
+  UniqueArray<Parallel::Request> m_all_requests;
+  //! Messages (avec en-tête) à envoyer pour chaque rang
+  UniqueArray<UniqueArray<std::byte>> m_send_messages;
+  //! Messages (avec en-tête) reçus pour chaque rang
+  UniqueArray<UniqueArray<std::byte>> m_receive_messages;
+  //! Dernières valeurs envoyées pour chaque rang
+  UniqueArray<UniqueArray<std::byte>> m_last_sent;
+  //! Dernières valeurs reçues pour chaque rang
+  UniqueArray<UniqueArray<std::byte>> m_last_received;
+
+ private:
+
+  static Int64 _bitmapSize(Int64 nb_element)
+  {
+    // Arrondi à un multiple de 8 octets pour garder les valeurs alignées.
+    return ((nb_element + 63) / 64) * 8;
+  }
+  void _buildSendMessage(Int32 index, MutableMemoryView send_view);
+  void _processReceiveMessage(Int32 index, Int32 target_rank, MutableMemoryView receive_view);
+};
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+class DeltaDataSynchronizeImplementation::Factory
+: public IDataSynchronizeImplementationFactory
+{
+ public:
+
+  explicit Factory(IParallelMng* pm)
+  : m_parallel_mng(pm)
+  {}
+
+  Ref<IDataSynchronizeImplementation> createInstance() override
+  {
+    auto* x = new DeltaDataSynchronizeImplementation(this);
+    return makeRef<IDataSynchronizeImplementation>(x);
+  }
+
+ public:
+
+  IParallelMng* m_parallel_mng = nullptr;
+};
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+DeltaDataSynchronizeImplementation::
+DeltaDataSynchronizeImplementation(Factory* f)
+: m_parallel_mng(f->m_parallel_mng)
+{
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+extern "C++" Ref<IDataSynchronizeImplementationFactory>
+arcaneCreateDeltaVariableSynchronizerFactory(IParallelMng* pm)
+{
+  auto* x = new DeltaDataSynchronizeImplementation::Factory(pm);
+  return makeRef<IDataSynchronizeImplementationFactory>(x);
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+void DeltaDataSynchronizeImplementation::
+beginSynchronize(IDataSynchronizeBuffer* vs_buf)
+{
+  ARCANE_CHECK_POINTER(vs_buf);
+  IParallelMng* pm = m_parallel_mng;
+
+  Int32 nb_message = vs_buf->nbRank();
+  m_send_messages.resize(nb_message);
+  m_receive_messages.resize(nb_message);
+  m_last_sent.resize(nb_message);
+  m_last_received.resize(nb_message);
+
+  // Poste les réceptions non bloquantes. Le message peut contenir
+  // au maximum l'en-tête, le masque et toutes les valeurs.
+  for (Integer i = 0; i < nb_message; ++i) {
+    Int32 target_rank = vs_buf->targetRank(i);
+    MutableMemoryView receive_view = vs_buf->receiveBuffer(i);
+    Int64 size = receive_view.bytes().size();
+    if (size == 0)
+      continue;
+    UniqueArray<std::byte>& message = m_receive_messages[i];
+    message.resize(HEADER_SIZE + _bitmapSize(receive_view.nbElement()) + size);
+    m_all_requests.add(pm->recv(_toLegacySmallView(message.span()), target_rank, false));
+  }
+
+  vs_buf->copyAllSend();
+
+  // Construit et envoie les messages en mode non bloquant.
+  for (Integer i = 0; i < nb_message; ++i) {
+    Int32 target_rank = vs_buf->targetRank(i);
+    MutableMemoryView send_view = vs_buf->sendBuffer(i);
+    if (send_view.bytes().size() == 0)
+      continue;
+    _buildSendMessage(i, send_view);
+    m_all_requests.add(pm->send(_toLegacySmallView(m_send_messages[i].span()), target_rank, false));
+  }
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+void DeltaDataSynchronizeImplementation::
+endSynchronize(IDataSynchronizeBuffer* vs_buf)
+{
+  IParallelMng* pm = m_parallel_mng;
+
+  pm->waitAllRequests(m_all_requests);
+  m_all_requests.clear();
+
+  Int32 nb_message = vs_buf->nbRank();
+  for (Integer i = 0; i < nb_message; ++i) {
+    MutableMemoryView receive_view = vs_buf->receiveBuffer(i);
+    if (receive_view.bytes().size() == 0)
+      continue;
+    _processReceiveMessage(i, vs_buf->targetRank(i), receive_view);
+  }
+
+  vs_buf->copyAllReceive();
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+/*!
+ * \brief Construit le message à envoyer au \a index-ème rang.
+ *
+ * Met aussi à jour la copie des dernières valeurs envoyées.
+ */
+void DeltaDataSynchronizeImplementation::
+_buildSendMessage(Int32 index, MutableMemoryView send_view)
+{
+  Span<const std::byte> values = send_view.bytes();
+  const Int64 size = values.size();
+  const Int64 nb_element = send_view.nbElement();
+  const Int64 datatype_size = send_view.datatypeSize();
+  UniqueArray<std::byte>& last_sent = m_last_sent[index];
+  UniqueArray<std::byte>& message = m_send_messages[index];
+
+  bool is_delta = (last_sent.largeSize() == size);
+  if (is_delta) {
+    const Int64 bitmap_size = _bitmapSize(nb_element);
+    message.resize(HEADER_SIZE + bitmap_size + size);
+    std::byte* bitmap = message.data() + HEADER_SIZE;
+    std::byte* delta_values = bitmap + bitmap_size;
+    std::memset(bitmap, 0, bitmap_size);
+    const std::byte* old_values = last_sent.data();
+    Int64 delta_size = 0;
+    for (Int64 k = 0; k < nb_element; ++k) {
+      const std::byte* v = values.data() + k * datatype_size;
+      if (std::memcmp(v, old_values + k * datatype_size, datatype_size) != 0) {
+        bitmap[k / 8] |= static_cast<std::byte>(1 << (k % 8));
+        std::memcpy(delta_values + delta_size, v, datatype_size);
+        delta_size += datatype_size;
+      }
+    }
+    // Si le message différentiel n'est pas plus petit, envoie toutes les valeurs.
+    is_delta = ((bitmap_size + delta_size) < size);
+    if (is_delta)
+      message.resize(HEADER_SIZE + bitmap_size + delta_size);
+  }
+  if (!is_delta) {
+    message.resize(HEADER_SIZE + size);
+    std::memcpy(message.data() + HEADER_SIZE, values.data(), size);
+  }
+  Int64 header = (is_delta) ? DELTA_MESSAGE : FULL_MESSAGE;
+  std::memcpy(message.data(), &header, HEADER_SIZE);
+
+  last_sent.resize(size);
+  std::memcpy(last_sent.data(), values.data(), size);
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+/*!
+ * \brief Reconstruit les valeurs reçues du \a index-ème rang.
+ *
+ * Met aussi à jour la copie des dernières valeurs reçues.
+ */
+void DeltaDataSynchronizeImplementation::
+_processReceiveMessage(Int32 index, Int32 target_rank, MutableMemoryView receive_view)
+{
+  Span<std::byte> values = receive_view.bytes();
+  const Int64 size = values.size();
+  const Int64 nb_element = receive_view.nbElement();
+  const Int64 datatype_size = receive_view.datatypeSize();
+  UniqueArray<std::byte>& last_received = m_last_received[index];
+  const std::byte* message = m_receive_messages[index].data();
+
+  Int64 header = 0;
+  std::memcpy(&header, message, HEADER_SIZE);
+  if (header == FULL_MESSAGE) {
+    std::memcpy(values.data(), message + HEADER_SIZE, size);
+  }
+  else if (header == DELTA_MESSAGE) {
+    if (last_received.largeSize() != size)
+      ARCANE_FATAL("Delta message from rank '{0}' but no previous values of the same size"
+                   " (previous_size={1} size={2})",
+                   target_rank, last_received.largeSize(), size);
+    const std::byte* bitmap = message + HEADER_SIZE;
+    const std::byte* delta_values = bitmap + _bitmapSize(nb_element);
+    const std::byte* old_values = last_received.data();
+    for (Int64 k = 0; k < nb_element; ++k) {
+      std::byte* v = values.data() + k * datatype_size;
+      if ((bitmap[k / 8] & static_cast<std::byte>(1 << (k % 8))) != std::byte{ 0 }) {
+        std::memcpy(v, delta_values, datatype_size);
+        delta_values += datatype_size;
+      }
+      else
+        std::memcpy(v, old_values + k * datatype_size, datatype_size);
+    }
+  }
+  else
+    ARCANE_FATAL("Invalid header '{0}' for delta message from rank '{1}'", header, target_rank);
+
+  last_received.resize(size);
+  std::memcpy(last_received.data(), values.data(), size);
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+} // namespace Arcane
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
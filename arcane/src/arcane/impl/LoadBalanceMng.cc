@@ -34,6 +34,9 @@
 #include "arcane/core/VariableTypes.h"
 #include "arcane/core/CommonVariables.h"
 #include "arcane/core/VariableCollection.h"
+#include "arcane/core/materials/IMeshMaterialMng.h"
+#include "arcane/core/materials/CellToAllEnvCellConverter.h"
+#include "arcane/core/materials/MatItemEnumerator.h"
 
 /*---------------------------------------------------------------------------*/
 /*---------------------------------------------------------------------------*/
@@ -410,6 +413,8 @@ initAccess(IMesh* mesh)
   m_mass_over_weigth = new VariableCellReal(VariableBuildInfo(m_mesh_handle, "LbMngOverallMass", vflags));
   m_mass_res_weight = new VariableCellReal(VariableBuildInfo(m_mesh_handle, "LbMngResidentMass", vflags));
   m_event_weights = new VariableCellArrayReal(VariableBuildInfo(m_mesh_handle, "LbMngMCriteriaWgt", vflags));
+  if (m_material_criterion)
+    m_material_cost = new VariableCellReal(VariableBuildInfo(m_mesh_handle, "LbMngMaterialCost", vflags));
   m_comm_costs->fill(1);
   m_mass_over_weigth->fill(1);
   m_mass_res_weight->fill(1);
@@ -424,6 +429,8 @@ initAccess(IMesh* mesh)
     _computeComm();
   if (m_mass_criterion)
     _computeOverallMass();
+  if (m_material_criterion)
+    _computeMaterialCost();
   _computeEvents();
 }
 
@@ -433,6 +440,7 @@ initAccess(IMesh* mesh)
 void LoadBalanceMng::
 endAccess()
 {
+  m_material_cost = nullptr;
   m_event_weights = nullptr;
   m_mass_res_weight = nullptr;
   m_mass_over_weigth = nullptr;
@@ -484,6 +492,17 @@ addCommCost(VariableFaceInt32& count, const String& entity)
 /*---------------------------------------------------------------------------*/
 /*---------------------------------------------------------------------------*/
 
+void LoadBalanceMng::
+setMaterialCost(Real cell_cost, Real component_cost, Real mixed_cell_cost)
+{
+  m_material_cell_cost = cell_cost;
+  m_material_component_cost = component_cost;
+  m_material_mixed_cell_cost = mixed_cell_cost;
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
 Integer LoadBalanceMng::
 nbCriteria()
 {
@@ -492,6 +511,7 @@ nbCriteria()
   count = m_event_vars.size();
   count -= ((m_mass_criterion) ? 0 : 1); // First event is mass !
   count += ((m_nb_criterion) ? 1 : 0);
+  count += ((m_material_criterion) ? 1 : 0);
   return count;
 }
 
@@ -528,6 +548,41 @@ _computeResidentMass()
   }
 }
 
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+/*!
+ * \brief Calcule le coût de chaque maille à partir de ses milieux et matériaux.
+ */
+void LoadBalanceMng::
+_computeMaterialCost()
+{
+  using namespace Materials;
+  IMesh* mesh = m_mesh_handle.mesh();
+  VariableCellReal& cost = *m_material_cost;
+  IMeshMaterialMng* mm = IMeshMaterialMng::getReference(mesh, false);
+  if (!mm) {
+    cost.fill(m_material_cell_cost);
+    return;
+  }
+  CellToAllEnvCellConverter all_env_cell_converter(mm->cellToAllEnvCellConverter());
+  ENUMERATE_CELL (icell, mesh->ownCells()) {
+    AllEnvCell all_env_cell = all_env_cell_converter[icell];
+    Int32 nb_env = all_env_cell.nbEnvironment();
+    Int32 nb_component = nb_env;
+    bool is_mixed = (nb_env > 1);
+    ENUMERATE_CELL_ENVCELL (ienvcell, all_env_cell) {
+      Int32 nb_mat = (*ienvcell).nbMaterial();
+      nb_component += nb_mat;
+      if (nb_mat > 1)
+        is_mixed = true;
+    }
+    Real w = m_material_cell_cost + m_material_component_cost * nb_component;
+    if (is_mixed)
+      w += m_material_mixed_cell_cost;
+    cost[icell] = w;
+  }
+}
+
 /*---------------------------------------------------------------------------*/
 /*---------------------------------------------------------------------------*/
 
@@ -589,6 +644,15 @@ _computeEvents()
       (*m_event_weights)[icell][count] = eventVars[i][icell];
     }
   }
+
+  // Le coût associé aux matériaux est le dernier critère.
+  if (m_material_criterion) {
+    Integer index = nbCriteria() - 1;
+    VariableCellReal& cost = *m_material_cost;
+    ENUMERATE_CELL (icell, m_mesh_handle.mesh()->ownCells()) {
+      (*m_event_weights)[icell][index] = cost[icell];
+    }
+  }
 }
 
 /*---------------------------------------------------------------------------*/
@@ -126,6 +126,8 @@ class ARCANE_IMPL_EXPORT LoadBalanceMng
   void addCriterion(VariableCellInt32& count) override;
   void addCriterion(VariableCellReal& count) override;
   void addCommCost(VariableFaceInt32& count, const String& entity="") override;
+  void setMaterialCost(Real cell_cost, Real component_cost, Real mixed_cell_cost) override;
+  void setMaterialCostAsCriterion(bool active=true) override { m_material_criterion = active; }
 
   void reset() override;
 
@@ -153,6 +155,7 @@ class ARCANE_IMPL_EXPORT LoadBalanceMng
   void _computeResidentMass();
   void _computeComm();
   void _computeEvents();
+  void _computeMaterialCost();
 
   MeshHandle m_mesh_handle;
   ScopedPtrT<CriteriaMng> m_criteria;
@@ -163,11 +166,16 @@ class ARCANE_IMPL_EXPORT LoadBalanceMng
   bool m_nb_criterion = false;
   bool m_cell_comm = true;
   bool m_compute_comm = true;
+  bool m_material_criterion = false;
+  Real m_material_cell_cost = 1.0;
+  Real m_material_component_cost = 0.0;
+  Real m_material_mixed_cell_cost = 0.0;
 
   ScopedPtrT<VariableFaceReal> m_comm_costs;
   ScopedPtrT<VariableCellReal> m_mass_over_weigth;
   ScopedPtrT<VariableCellReal> m_mass_res_weight;
   ScopedPtrT<VariableCellArrayReal> m_event_weights;
+  ScopedPtrT<VariableCellReal> m_material_cost;
 
   std::unique_ptr<VariableCellInt32> m_cell_new_owner; // SdC This variable is a problem when using a custom mesh
 };
@@ -1,17 +1,18 @@
 ﻿// -*- tab-width: 2; indent-tabs-mode: nil; coding: utf-8-with-signature -*-
 //-----------------------------------------------------------------------------
-// Copyright 2000-2023 CEA (www.cea.fr) IFPEN (www.ifpenergiesnouvelles.com)
+// Copyright 2000-2024 CEA (www.cea.fr) IFPEN (www.ifpenergiesnouvelles.com)
 // See the top-level COPYRIGHT file for details.
 // SPDX-License-Identifier: Apache-2.0
 //-----------------------------------------------------------------------------
 /*---------------------------------------------------------------------------*/
-/* NullVariableSynchronizer.cc                                 (C) 2000-2023 */
+/* NullVariableSynchronizer.cc                                 (C) 2000-2024 */
 /*                                                                           */
 /* Synchronisation des variables en séquentiel.                              */
 /*---------------------------------------------------------------------------*/
 /*---------------------------------------------------------------------------*/
 
 #include "arcane/utils/Event.h"
+#include "arcane/utils/FatalErrorException.h"
 
 #include "arcane/IVariableSynchronizer.h"
 #include "arcane/VariableSynchronizerEventArgs.h"
@@ -73,6 +74,25 @@ class NullVariableSynchronizer
       m_on_synchronized.notify(args);
     }
   }
+  void beginSynchronize(IVariable* var) override
+  {
+    _checkNotPending();
+    m_has_pending = true;
+    synchronize(var);
+  }
+  void beginSynchronize(VariableCollection vars) override
+  {
+    _checkNotPending();
+    m_has_pending = true;
+    synchronize(vars);
+  }
+  void endSynchronize() override
+  {
+    if (!m_has_pending)
+      ARCANE_FATAL("No pending synchronization. You need to call beginSynchronize() before");
+    m_has_pending = false;
+  }
+  bool hasPendingSynchronize() const override { return m_has_pending; }
   Int32ConstArrayView communicatingRanks() override
   {
     return Int32ConstArrayView();
@@ -104,6 +124,15 @@ class NullVariableSynchronizer
   IParallelMng* m_parallel_mng;
   ItemGroup m_item_group;
   EventObservable<const VariableSynchronizerEventArgs&> m_on_synchronized;
+  bool m_has_pending = false;
+
+ private:
+
+  void _checkNotPending()
+  {
+    if (m_has_pending)
+      ARCANE_FATAL("A synchronization is already pending. You need to call endSynchronize() before");
+  }
 };
 
 /*---------------------------------------------------------------------------*/
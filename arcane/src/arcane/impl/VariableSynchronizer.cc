@@ -1,11 +1,11 @@
 ﻿// -*- tab-width: 2; indent-tabs-mode: nil; coding: utf-8-with-signature -*-
 //-----------------------------------------------------------------------------
-// Copyright 2000-2023 CEA (www.cea.fr) IFPEN (www.ifpenergiesnouvelles.com)
+// Copyright 2000-2024 CEA (www.cea.fr) IFPEN (www.ifpenergiesnouvelles.com)
 // See the top-level COPYRIGHT file for details.
 // SPDX-License-Identifier: Apache-2.0
 //-----------------------------------------------------------------------------
 /*---------------------------------------------------------------------------*/
-/* VariableSynchronizer.cc                                     (C) 2000-2023 */
+/* VariableSynchronizer.cc                                     (C) 2000-2024 */
 /*                                                                           */
 /* Service de synchronisation des variables.                                 */
 /*---------------------------------------------------------------------------*/
@@ -43,6 +43,7 @@
 #include "arcane/impl/internal/IBufferCopier.h"
 
 #include <algorithm>
+#include <memory>
 
 /*---------------------------------------------------------------------------*/
 /*---------------------------------------------------------------------------*/
@@ -55,6 +56,11 @@ namespace Arcane
 
 extern "C++" Ref<IDataSynchronizeImplementationFactory>
 arcaneCreateSimpleVariableSynchronizerFactory(IParallelMng* pm);
+extern "C++" Ref<IDataSynchronizeImplementationFactory>
+arcaneCreateCompressedVariableSynchronizerFactory(IParallelMng* pm, IVariableSynchronizerMngInternal* sync_mng,
+                                                  Int64 min_compress_size = -1);
+extern "C++" Ref<IDataSynchronizeImplementationFactory>
+arcaneCreateDeltaVariableSynchronizerFactory(IParallelMng* pm);
 
 /*---------------------------------------------------------------------------*/
 /*---------------------------------------------------------------------------*/
@@ -137,19 +143,45 @@ class VariableSynchronizer::SyncMessage
 
   //! Effectue la synchronisation
   void synchronize()
+  {
+    beginSynchronize();
+    endSynchronize();
+  }
+
+  /*!
+   * \brief Commence la synchronisation.
+   *
+   * Le buffer de synchronisation est conservé jusqu'à l'appel
+   * à endSynchronize().
+   */
+  void beginSynchronize()
   {
     Int32 nb_var = m_variables.size();
     if (nb_var == 0)
       return;
+    m_pending_buffer = std::make_unique<ScopedBuffer>(m_variable_synchronizer_mng->_internalApi(), m_allocator);
     if (nb_var == 1) {
       bool is_compare_sync = m_variable_synchronizer_mng->isSynchronizationComparisonEnabled();
-      m_synchronize_result = synchronizeData(m_data_list[0], is_compare_sync);
+      m_dispatcher->setSynchronizeBuffer(m_pending_buffer->m_buffer);
+      m_dispatcher->beginSynchronize(m_data_list[0], is_compare_sync);
     }
-    if (nb_var >= 2) {
-      ScopedBuffer tmp_buf(m_variable_synchronizer_mng->_internalApi(), m_allocator);
-      m_multi_dispatcher->setSynchronizeBuffer(tmp_buf.m_buffer);
-      m_multi_dispatcher->synchronize(m_variables);
+    else {
+      m_multi_dispatcher->setSynchronizeBuffer(m_pending_buffer->m_buffer);
+      m_multi_dispatcher->beginSynchronize(m_variables);
     }
+  }
+
+  //! Termine la synchronisation commencée par beginSynchronize()
+  void endSynchronize()
+  {
+    Int32 nb_var = m_variables.size();
+    if (nb_var == 0)
+      return;
+    if (nb_var == 1)
+      m_synchronize_result = m_dispatcher->endSynchronize();
+    else
+      m_multi_dispatcher->endSynchronize();
+    m_pending_buffer.reset();
     for (IVariable* var : m_variables)
       var->setIsSynchronized();
   }
@@ -175,6 +207,7 @@ class VariableSynchronizer::SyncMessage
   UniqueArray<INumericDataInternal*> m_data_list;
   DataSynchronizeResult m_synchronize_result;
   IMemoryAllocator* m_allocator = nullptr;
+  std::unique_ptr<ScopedBuffer> m_pending_buffer;
 
  private:
 
@@ -207,10 +240,23 @@ VariableSynchronizer(IParallelMng* pm, const ItemGroup& group,
   m_sync_info = DataSynchronizeInfo::create();
   if (!implementation_factory.get())
     implementation_factory = arcaneCreateSimpleVariableSynchronizerFactory(pm);
-  m_implementation_factory = implementation_factory;
 
   m_variable_synchronizer_mng = group.itemFamily()->mesh()->variableMng()->synchronizerMng();
 
+  // Si la compression des messages est active, utilise l'implémentation
+  // spécifique. Elle n'est pas disponible si les buffers sont sur accélérateur.
+  // Il en est de même pour la synchronisation différentielle.
+  {
+    IVariableSynchronizerMngInternal* sync_mng_api = m_variable_synchronizer_mng->_internalApi();
+    auto* internal_pm = pm->_internalApi();
+    bool is_device_buffer = internal_pm->defaultRunner() && internal_pm->isAcceleratorAware();
+    m_is_compress_available = sync_mng_api->synchronizeCompressor() && !is_device_buffer;
+    if (m_is_compress_available)
+      implementation_factory = arcaneCreateCompressedVariableSynchronizerFactory(pm, sync_mng_api);
+    m_is_delta_sync_available = !is_device_buffer;
+  }
+  m_implementation_factory = implementation_factory;
+
   {
     String s = platform::getEnvironmentVariable("ARCANE_ALLOW_MULTISYNC");
     if (s == "0" || s == "FALSE" || s == "false")
@@ -233,6 +279,9 @@ VariableSynchronizer::
 {
   delete m_sync_timer;
   delete m_default_message;
+  delete m_async_message;
+  _clearDeltaMessages();
+  _clearCompressMessages();
 }
 
 /*---------------------------------------------------------------------------*/
@@ -240,6 +289,15 @@ VariableSynchronizer::
 
 VariableSynchronizer::SyncMessage* VariableSynchronizer::
 _buildMessage()
+{
+  return _buildMessage(m_implementation_factory);
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+VariableSynchronizer::SyncMessage* VariableSynchronizer::
+_buildMessage(Ref<IDataSynchronizeImplementationFactory> factory)
 {
   GroupIndexTable* table = nullptr;
   if (!m_item_group.isAllItems())
@@ -265,7 +323,7 @@ _buildMessage()
   }
 
   // Créé une instance de l'implémentation
-  Ref<IDataSynchronizeImplementation> sync_impl = m_implementation_factory->createInstance();
+  Ref<IDataSynchronizeImplementation> sync_impl = factory->createInstance();
   sync_impl->setDataSynchronizeInfo(m_sync_info.get());
 
   DataSynchronizeDispatcherBuildInfo bi(m_parallel_mng, sync_impl, m_sync_info, buffer_copier);
@@ -280,11 +338,21 @@ _buildMessage()
 void VariableSynchronizer::
 compute()
 {
+  // Doit être fait avant de modifier les listes de synchronisation
+  // utilisées par une éventuelle synchronisation en cours.
+  _checkNotPending("compute");
+
   VariableSynchronizerComputeList computer(this);
   computer.compute();
 
   _setCurrentDevice();
   m_default_message->compute();
+  if (m_async_message)
+    m_async_message->compute();
+  // Les valeurs conservées pour la synchronisation différentielle
+  // ne sont plus valides.
+  _clearDeltaMessages();
+  _clearCompressMessages();
   if (m_is_verbose)
     info() << "End compute dispatcher Date=" << platform::getCurrentDateTime();
 }
@@ -310,21 +378,110 @@ _doSynchronize(SyncMessage* message)
     message->synchronize();
   }
 
-  Int32 nb_var = message->nbVariable();
-  // Si une seule variable, affiche le résutat de la comparaison de
-  // la synchronisation
-  if (nb_var == 1 && m_variable_synchronizer_mng->isSynchronizationComparisonEnabled()) {
-    eDataSynchronizeCompareStatus s = message->result().compareStatus();
-    if (s == eDataSynchronizeCompareStatus::Different) {
-      event_args.setCompareStatus(0, VariableSynchronizerEventArgs::CompareStatus::Different);
-    }
-    else if (s == eDataSynchronizeCompareStatus::Same) {
-      event_args.setCompareStatus(0, VariableSynchronizerEventArgs::CompareStatus::Same);
+  // Fin de la synchro
+  _sendEndEvent(message, m_sync_timer->lastActivationTime());
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+void VariableSynchronizer::
+_doBeginSynchronize(SyncMessage* message)
+{
+  IParallelMng* pm = m_parallel_mng;
+  ITimeStats* ts = pm->timeStats();
+  Timer::Phase tphase(ts, TP_Communication);
+
+  _setCurrentDevice();
+
+  _sendBeginEvent(message->eventArgs());
+
+  {
+    Timer::Sentry ts2(m_sync_timer);
+    message->beginSynchronize();
+  }
+  m_pending_begin_time = m_sync_timer->lastActivationTime();
+  m_pending_message = message;
+  m_has_pending_synchronize = true;
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+void VariableSynchronizer::
+beginSynchronize(IVariable* var)
+{
+  _checkNotPending("beginSynchronize");
+  SyncMessage* message = _variableMessage(var);
+  if (!message)
+    message = _asyncMessage();
+  message->initialize(var);
+
+  debug(Trace::High) << " Proc " << m_parallel_mng->commRank() << " BeginSync variable " << var->fullName();
+  if (m_trace_sync) {
+    info() << " BeginSynchronize variable " << var->fullName()
+           << " stack=" << platform::getStackTrace();
+  }
+  _doBeginSynchronize(message);
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+void VariableSynchronizer::
+beginSynchronize(VariableCollection vars)
+{
+  _checkNotPending("beginSynchronize");
+  if (vars.count() == 1) {
+    beginSynchronize(vars.front());
+    return;
+  }
+  if (!vars.empty() && m_allow_multi_sync && _canSynchronizeMulti(vars)) {
+    SyncMessage* message = _asyncMessage();
+    message->initialize(vars);
+    debug(Trace::High) << " Proc " << m_parallel_mng->commRank() << " BeginMultiSync variable";
+    if (m_trace_sync) {
+      info() << " BeginMultiSynchronize"
+             << " stack=" << platform::getStackTrace();
     }
+    _doBeginSynchronize(message);
+    return;
   }
+  // Les variables ne peuvent pas être synchronisées en une fois (ou la
+  // liste est vide). Dans ce cas on effectue une synchronisation bloquante
+  // et endSynchronize() n'aura rien à faire.
+  synchronize(vars);
+  m_pending_message = nullptr;
+  m_has_pending_synchronize = true;
+}
 
-  // Fin de la synchro
-  _sendEndEvent(event_args);
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+void VariableSynchronizer::
+endSynchronize()
+{
+  if (!m_has_pending_synchronize)
+    ARCANE_FATAL("No pending synchronization. You need to call beginSynchronize() before");
+
+  SyncMessage* message = m_pending_message;
+  m_pending_message = nullptr;
+  m_has_pending_synchronize = false;
+  if (!message)
+    return;
+
+  IParallelMng* pm = m_parallel_mng;
+  ITimeStats* ts = pm->timeStats();
+  Timer::Phase tphase(ts, TP_Communication);
+
+  _setCurrentDevice();
+
+  {
+    Timer::Sentry ts2(m_sync_timer);
+    message->endSynchronize();
+  }
+
+  _sendEndEvent(message, m_pending_begin_time + m_sync_timer->lastActivationTime());
 }
 
 /*---------------------------------------------------------------------------*/
@@ -333,7 +490,10 @@ _doSynchronize(SyncMessage* message)
 void VariableSynchronizer::
 synchronize(IVariable* var)
 {
-  m_default_message->initialize(var);
+  SyncMessage* message = _variableMessage(var);
+  if (!message)
+    message = m_default_message;
+  message->initialize(var);
 
   IParallelMng* pm = m_parallel_mng;
   debug(Trace::High) << " Proc " << pm->commRank() << " Sync variable " << var->fullName();
@@ -341,7 +501,7 @@ synchronize(IVariable* var)
     info() << " Synchronize variable " << var->fullName()
            << " stack=" << platform::getStackTrace();
   }
-  _doSynchronize(m_default_message);
+  _doSynchronize(message);
 }
 
 /*---------------------------------------------------------------------------*/
@@ -393,8 +553,17 @@ void VariableSynchronizer::
 changeLocalIds(Int32ConstArrayView old_to_new_ids)
 {
   info(4) << "** VariableSynchronizer::changeLocalIds() group=" << m_item_group.name();
+  _checkNotPending("changeLocalIds");
   m_sync_info->changeLocalIds(old_to_new_ids);
   m_default_message->compute();
+  if (m_async_message)
+    m_async_message->compute();
+  // Le renumérotage ne change pas l'ordre des entités dans les buffers donc
+  // les valeurs conservées pour la synchronisation différentielle restent valides.
+  for (auto& x : m_delta_messages)
+    x.second->compute();
+  for (auto& x : m_compress_messages)
+    x.second.second->compute();
 }
 
 /*---------------------------------------------------------------------------*/
@@ -404,7 +573,9 @@ changeLocalIds(Int32ConstArrayView old_to_new_ids)
  * en une seule fois.
  *
  * Pour que cela soit possible, il faut que ces variables ne soient pas
- * partielles et reposent sur le même ItemGroup (donc soient de la même famille)
+ * partielles et reposent sur le même ItemGroup (donc soient de la même famille).
+ * Les variables utilisant la synchronisation différentielle ou ayant un
+ * seuil de compression spécifique sont synchronisées séparément.
  */
 bool VariableSynchronizer::
 _canSynchronizeMulti(const VariableCollection& vars)
@@ -417,6 +588,10 @@ _canSynchronizeMulti(const VariableCollection& vars)
     IVariable* var = *ivar;
     if (var->isPartial())
       return false;
+    if (_isDeltaSync(var))
+      return false;
+    if (_variableCompressMinSize(var) >= 0)
+      return false;
     ItemGroup var_group = var->itemGroup();
     if (!is_set) {
       group = var_group;
@@ -488,10 +663,22 @@ _sendBeginEvent(VariableSynchronizerEventArgs& args)
 /*---------------------------------------------------------------------------*/
 
 void VariableSynchronizer::
-_sendEndEvent(VariableSynchronizerEventArgs& args)
+_sendEndEvent(SyncMessage* message, Real elapsed_time)
 {
-  ARCANE_CHECK_POINTER(m_sync_timer);
-  Real elapsed_time = m_sync_timer->lastActivationTime();
+  VariableSynchronizerEventArgs& args = message->eventArgs();
+
+  // Si une seule variable, affiche le résutat de la comparaison de
+  // la synchronisation
+  if (message->nbVariable() == 1 && m_variable_synchronizer_mng->isSynchronizationComparisonEnabled()) {
+    eDataSynchronizeCompareStatus s = message->result().compareStatus();
+    if (s == eDataSynchronizeCompareStatus::Different) {
+      args.setCompareStatus(0, VariableSynchronizerEventArgs::CompareStatus::Different);
+    }
+    else if (s == eDataSynchronizeCompareStatus::Same) {
+      args.setCompareStatus(0, VariableSynchronizerEventArgs::CompareStatus::Same);
+    }
+  }
+
   m_parallel_mng->stat()->add("Synchronize", elapsed_time, 1);
   args.setState(VariableSynchronizerEventArgs::State::EndSynchronize);
   args.setElapsedTime(elapsed_time);
@@ -511,6 +698,152 @@ _sendEvent(VariableSynchronizerEventArgs& args)
 /*---------------------------------------------------------------------------*/
 /*---------------------------------------------------------------------------*/
 
+/*!
+ * \brief Message utilisé pour les synchronisations non bloquantes.
+ *
+ * On utilise une instance différente de \a m_default_message pour pouvoir
+ * effectuer des synchronisations bloquantes pendant qu'une synchronisation
+ * non bloquante est en cours.
+ */
+VariableSynchronizer::SyncMessage* VariableSynchronizer::
+_asyncMessage()
+{
+  if (!m_async_message) {
+    m_async_message = _buildMessage();
+    m_async_message->compute();
+  }
+  return m_async_message;
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+bool VariableSynchronizer::
+_isDeltaSync(IVariable* var) const
+{
+  return m_is_delta_sync_available && (var->property() & IVariable::PDeltaSync);
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+/*!
+ * \brief Message pour la synchronisation différentielle de \a var.
+ *
+ * Retourne \a nullptr si la variable n'utilise pas la synchronisation
+ * différentielle. Comme l'implémentation conserve les dernières valeurs
+ * envoyées et reçues, il faut un message par variable. Ils sont indexés par
+ * le nom complet de la variable qui est le même sur tous les rangs.
+ */
+VariableSynchronizer::SyncMessage* VariableSynchronizer::
+_deltaMessage(IVariable* var)
+{
+  if (!_isDeltaSync(var))
+    return nullptr;
+  SyncMessage*& message = m_delta_messages[var->fullName()];
+  if (!message) {
+    message = _buildMessage(arcaneCreateDeltaVariableSynchronizerFactory(m_parallel_mng));
+    message->compute();
+  }
+  return message;
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+void VariableSynchronizer::
+_clearDeltaMessages()
+{
+  for (auto& x : m_delta_messages)
+    delete x.second;
+  m_delta_messages.clear();
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+/*!
+ * \brief Seuil de compression spécifique à la variable \a var.
+ *
+ * Retourne -1 si la compression n'est pas active ou si la variable
+ * utilise le seuil par défaut.
+ */
+Int64 VariableSynchronizer::
+_variableCompressMinSize(IVariable* var) const
+{
+  if (!m_is_compress_available)
+    return (-1);
+  return m_variable_synchronizer_mng->_internalApi()->variableCompressMinSize(var);
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+/*!
+ * \brief Message pour les variables ayant un seuil de compression spécifique.
+ *
+ * Retourne \a nullptr si la variable utilise le seuil par défaut. Le
+ * message est reconstruit si le seuil de la variable a changé.
+ */
+VariableSynchronizer::SyncMessage* VariableSynchronizer::
+_compressMessage(IVariable* var)
+{
+  Int64 min_size = _variableCompressMinSize(var);
+  if (min_size < 0)
+    return nullptr;
+  auto& x = m_compress_messages[var->fullName()];
+  if (x.second && x.first != min_size) {
+    delete x.second;
+    x.second = nullptr;
+  }
+  if (!x.second) {
+    IVariableSynchronizerMngInternal* sync_mng_api = m_variable_synchronizer_mng->_internalApi();
+    x.first = min_size;
+    x.second = _buildMessage(arcaneCreateCompressedVariableSynchronizerFactory(m_parallel_mng, sync_mng_api, min_size));
+    x.second->compute();
+  }
+  return x.second;
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+void VariableSynchronizer::
+_clearCompressMessages()
+{
+  for (auto& x : m_compress_messages)
+    delete x.second.second;
+  m_compress_messages.clear();
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+/*!
+ * \brief Message spécifique à la variable \a var.
+ *
+ * Retourne \a nullptr si la variable peut utiliser les messages communs.
+ */
+VariableSynchronizer::SyncMessage* VariableSynchronizer::
+_variableMessage(IVariable* var)
+{
+  SyncMessage* message = _deltaMessage(var);
+  if (!message)
+    message = _compressMessage(var);
+  return message;
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+void VariableSynchronizer::
+_checkNotPending(const char* func_name)
+{
+  if (m_has_pending_synchronize)
+    ARCANE_FATAL("Can not call '{0}' for group '{1}' because a synchronization is pending."
+                 " You need to call endSynchronize() before",
+                 func_name, m_item_group.name());
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
 void VariableSynchronizer::
 _checkCreateTimer()
 {
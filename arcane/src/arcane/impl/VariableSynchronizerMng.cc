@@ -1,11 +1,11 @@
 ﻿// -*- tab-width: 2; indent-tabs-mode: nil; coding: utf-8-with-signature -*-
 //-----------------------------------------------------------------------------
-// Copyright 2000-2023 CEA (www.cea.fr) IFPEN (www.ifpenergiesnouvelles.com)
+// Copyright 2000-2024 CEA (www.cea.fr) IFPEN (www.ifpenergiesnouvelles.com)
 // See the top-level COPYRIGHT file for details.
 // SPDX-License-Identifier: Apache-2.0
 //-----------------------------------------------------------------------------
 /*---------------------------------------------------------------------------*/
-/* VariableSynchronizerMng.cc                                  (C) 2000-2023 */
+/* VariableSynchronizerMng.cc                                  (C) 2000-2024 */
 /*                                                                           */
 /* Gestionnaire des synchroniseurs de variables.                             */
 /*---------------------------------------------------------------------------*/
@@ -18,12 +18,17 @@
 #include "arcane/utils/FatalErrorException.h"
 #include "arcane/utils/OStringStream.h"
 #include "arcane/utils/internal/MemoryBuffer.h"
+#include "arcane/utils/IDataCompressor.h"
 
 #include "arcane/core/IVariableMng.h"
 #include "arcane/core/IParallelMng.h"
 #include "arcane/core/VariableSynchronizerEventArgs.h"
 #include "arcane/core/IVariable.h"
+#include "arcane/core/ISubDomain.h"
+#include "arcane/core/ServiceBuilder.h"
+#include "arcane/core/internal/IVariableMngInternal.h"
 
+#include <algorithm>
 #include <map>
 #include <stack>
 
@@ -261,6 +266,39 @@ void VariableSynchronizerMng::
 initialize()
 {
   m_stats->init();
+
+  // Regarde si on compresse les messages de synchronisation.
+  // La compression n'est utile que si le réseau est plus lent que la
+  // compression/décompression, ce qui dépend des données.
+  String compressor_name = platform::getEnvironmentVariable("ARCANE_SYNCHRONIZE_COMPRESSOR");
+  if (!compressor_name.null() && m_parallel_mng->isParallel()) {
+    IApplication* app = m_variable_mng->_internalApi()->internalSubDomain()->application();
+    ServiceBuilder<IDataCompressor> sb(app);
+    Ref<IDataCompressor> compressor = sb.createReference(compressor_name);
+    m_internal_api.m_compressor = compressor;
+    Int64 min_size = compressor->minCompressSize();
+    if (auto v = Convert::Type<Int64>::tryParseFromEnvironment("ARCANE_SYNCHRONIZE_COMPRESS_MIN_SIZE", true))
+      min_size = v.value();
+    // Il faut au moins un octet pour distinguer les messages vides
+    m_internal_api.m_compress_min_size = std::max(min_size, static_cast<Int64>(1));
+    info() << "Using compression for synchronizations compressor=" << compressor_name
+           << " min_size=" << m_internal_api.m_compress_min_size;
+  }
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+void VariableSynchronizerMng::
+setSynchronizeCompressMinSize(IVariable* var, Int64 size)
+{
+  ARCANE_CHECK_POINTER(var);
+  auto& sizes = m_internal_api.m_variable_compress_min_size;
+  if (size < 0)
+    sizes.erase(var->fullName());
+  else
+    // Il faut au moins un octet pour distinguer les messages vides
+    sizes[var->fullName()] = std::max(size, static_cast<Int64>(1));
 }
 
 /*---------------------------------------------------------------------------*/
@@ -398,9 +436,46 @@ releaseSynchronizeBuffer(IMemoryAllocator* allocator, MemoryBuffer* v)
 /*---------------------------------------------------------------------------*/
 /*---------------------------------------------------------------------------*/
 
+Int64 VariableSynchronizerMng::InternalApi::
+variableCompressMinSize(IVariable* var) const
+{
+  auto x = m_variable_compress_min_size.find(var->fullName());
+  if (x == m_variable_compress_min_size.end())
+    return (-1);
+  return x->second;
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+void VariableSynchronizerMng::InternalApi::
+addCompressStats(Int64 original_size, Int64 sent_size)
+{
+  ++m_nb_compress_try;
+  if (sent_size < original_size)
+    ++m_nb_compressed;
+  m_total_original_size += original_size;
+  m_total_sent_size += sent_size;
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
 void VariableSynchronizerMng::InternalApi::
 dumpStats(std::ostream& ostr) const
 {
+  if (m_compressor.get()) {
+    Real ratio = 1.0;
+    if (m_total_original_size > 0)
+      ratio = static_cast<Real>(m_total_sent_size) / static_cast<Real>(m_total_original_size);
+    ostr << "SynchronizeCompress: compressor=" << m_compressor->name()
+         << " nb_try=" << m_nb_compress_try
+         << " nb_compressed=" << m_nb_compressed
+         << " original_size=" << m_total_original_size
+         << " sent_size=" << m_total_sent_size
+         << " ratio=" << ratio << "\n";
+  }
+
   //! Liste par allocateur des buffers en cours d'utilisation
   for (const auto& x : m_buffer_list->m_used_map)
     ostr << "SynchronizeBuffer: nb_used_map = " << x.second.size() << "\n";
@@ -1,11 +1,11 @@
 ﻿// -*- tab-width: 2; indent-tabs-mode: nil; coding: utf-8-with-signature -*-
 //-----------------------------------------------------------------------------
-// Copyright 2000-2023 CEA (www.cea.fr) IFPEN (www.ifpenergiesnouvelles.com)
+// Copyright 2000-2024 CEA (www.cea.fr) IFPEN (www.ifpenergiesnouvelles.com)
 // See the top-level COPYRIGHT file for details.
 // SPDX-License-Identifier: Apache-2.0
 //-----------------------------------------------------------------------------
 /*---------------------------------------------------------------------------*/
-/* DataSynchronizeDispatcher.h                                 (C) 2000-2023 */
+/* DataSynchronizeDispatcher.h                                 (C) 2000-2024 */
 /*                                                                           */
 /* Gestion de la synchronisation d'une instance de 'IData'.                  */
 /*---------------------------------------------------------------------------*/
@@ -150,10 +150,23 @@ class ARCANE_IMPL_EXPORT IDataSynchronizeMultiDispatcher
   /*!
    * \brief Positionne le buffer de synchronisation.
    *
-   * Il faut appeler cette méthode avant synchronize().
+   * Il faut appeler cette méthode avant beginSynchronize(). Le buffer ne doit pas être
+   * modifié avant l'appel à endSynchronize()
    */
   virtual void setSynchronizeBuffer(Ref<MemoryBuffer> buffer) =0;
-  virtual void synchronize(ConstArrayView<IVariable*> vars) = 0;
+  /*!
+   * \brief Commence la synchronisation des variables \a vars.
+   *
+   * Les valeurs des variables ne doivent pas être modifiées
+   * avant l'appel à endSynchronize().
+   */
+  virtual void beginSynchronize(ConstArrayView<IVariable*> vars) = 0;
+  /*!
+   * \brief Termine la synchronisation.
+   *
+   * Il faut avoir appelé beginSynchronize() avant.
+   */
+  virtual void endSynchronize() = 0;
 
  public:
 
@@ -1,11 +1,11 @@
 ﻿// -*- tab-width: 2; indent-tabs-mode: nil; coding: utf-8-with-signature -*-
 //-----------------------------------------------------------------------------
-// Copyright 2000-2023 CEA (www.cea.fr) IFPEN (www.ifpenergiesnouvelles.com)
+// Copyright 2000-2024 CEA (www.cea.fr) IFPEN (www.ifpenergiesnouvelles.com)
 // See the top-level COPYRIGHT file for details.
 // SPDX-License-Identifier: Apache-2.0
 //-----------------------------------------------------------------------------
 /*---------------------------------------------------------------------------*/
-/* VariableSynchronizer.h                                      (C) 2000-2023 */
+/* VariableSynchronizer.h                                      (C) 2000-2024 */
 /*                                                                           */
 /* Service de synchronisation des variables.                                 */
 /*---------------------------------------------------------------------------*/
@@ -28,6 +28,8 @@
 
 #include "arcane/impl/internal/IDataSynchronizeDispatcher.h"
 
+#include <map>
+
 /*---------------------------------------------------------------------------*/
 /*---------------------------------------------------------------------------*/
 
@@ -77,6 +79,14 @@ class ARCANE_IMPL_EXPORT VariableSynchronizer
 
   void synchronize(VariableCollection vars) override;
 
+  void beginSynchronize(IVariable* var) override;
+
+  void beginSynchronize(VariableCollection vars) override;
+
+  void endSynchronize() override;
+
+  bool hasPendingSynchronize() const override { return m_has_pending_synchronize; }
+
   Int32ConstArrayView communicatingRanks() override;
 
   Int32ConstArrayView sharedItems(Int32 index) override;
@@ -108,6 +118,21 @@ class ARCANE_IMPL_EXPORT VariableSynchronizer
   Ref<IDataSynchronizeImplementationFactory> m_implementation_factory;
   IVariableSynchronizerMng* m_variable_synchronizer_mng = nullptr;
   SyncMessage* m_default_message = nullptr;
+  //! Message pour les synchronisations non bloquantes (créé à la demande)
+  SyncMessage* m_async_message = nullptr;
+  //! Message de la synchronisation non bloquante en cours (nul si effectuée en mode bloquant)
+  SyncMessage* m_pending_message = nullptr;
+  bool m_has_pending_synchronize = false;
+  //! Messages des variables ayant la propriété IVariable::PDeltaSync (indexés par nom complet)
+  std::map<String, SyncMessage*> m_delta_messages;
+  //! Indique si la synchronisation différentielle est disponible
+  bool m_is_delta_sync_available = false;
+  //! Messages des variables ayant un seuil de compression spécifique (indexés par nom complet)
+  std::map<String, std::pair<Int64, SyncMessage*>> m_compress_messages;
+  //! Indique si la compression des messages est active
+  bool m_is_compress_available = false;
+  //! Temps passé dans beginSynchronize() pour la synchronisation non bloquante en cours
+  Real m_pending_begin_time = 0.0;
   Runner* m_runner = nullptr;
 
  private:
@@ -116,11 +141,22 @@ class ARCANE_IMPL_EXPORT VariableSynchronizer
   bool _canSynchronizeMulti(const VariableCollection& vars);
   DataSynchronizeResult _synchronize(INumericDataInternal* data, bool is_compare_sync);
   SyncMessage* _buildMessage();
+  SyncMessage* _buildMessage(Ref<IDataSynchronizeImplementationFactory> factory);
   void _sendBeginEvent(VariableSynchronizerEventArgs& args);
-  void _sendEndEvent(VariableSynchronizerEventArgs& args);
+  void _sendEndEvent(SyncMessage* message, Real elapsed_time);
   void _sendEvent(VariableSynchronizerEventArgs& args);
   void _checkCreateTimer();
   void _doSynchronize(SyncMessage* message);
+  void _doBeginSynchronize(SyncMessage* message);
+  void _checkNotPending(const char* func_name);
+  SyncMessage* _asyncMessage();
+  SyncMessage* _deltaMessage(IVariable* var);
+  void _clearDeltaMessages();
+  bool _isDeltaSync(IVariable* var) const;
+  SyncMessage* _compressMessage(IVariable* var);
+  void _clearCompressMessages();
+  Int64 _variableCompressMinSize(IVariable* var) const;
+  SyncMessage* _variableMessage(IVariable* var);
   void _setCurrentDevice();
 };
 
@@ -1,11 +1,11 @@
 ﻿// -*- tab-width: 2; indent-tabs-mode: nil; coding: utf-8-with-signature -*-
 //-----------------------------------------------------------------------------
-// Copyright 2000-2023 CEA (www.cea.fr) IFPEN (www.ifpenergiesnouvelles.com)
+// Copyright 2000-2024 CEA (www.cea.fr) IFPEN (www.ifpenergiesnouvelles.com)
 // See the top-level COPYRIGHT file for details.
 // SPDX-License-Identifier: Apache-2.0
 //-----------------------------------------------------------------------------
 /*---------------------------------------------------------------------------*/
-/* VariableSynchronizerMng.h                                   (C) 2000-2023 */
+/* VariableSynchronizerMng.h                                   (C) 2000-2024 */
 /*                                                                           */
 /* Gestionnaire des synchroniseurs de variables.                             */
 /*---------------------------------------------------------------------------*/
@@ -17,10 +17,13 @@
 
 #include "arcane/utils/TraceAccessor.h"
 #include "arcane/utils/Event.h"
+#include "arcane/utils/String.h"
 
 #include "arcane/core/IVariableSynchronizerMng.h"
 #include "arcane/core/internal/IVariableSynchronizerMngInternal.h"
 
+#include <map>
+
 /*---------------------------------------------------------------------------*/
 /*---------------------------------------------------------------------------*/
 
@@ -49,6 +52,7 @@ class ARCANE_IMPL_EXPORT VariableSynchronizerMng
   , public IVariableSynchronizerMngInternal
   {
     class BufferList;
+    friend VariableSynchronizerMng;
 
    public:
 
@@ -59,6 +63,10 @@ class ARCANE_IMPL_EXPORT VariableSynchronizerMng
 
     Ref<MemoryBuffer> createSynchronizeBuffer(IMemoryAllocator* allocator) override;
     void releaseSynchronizeBuffer(IMemoryAllocator* allocator, MemoryBuffer* v) override;
+    IDataCompressor* synchronizeCompressor() const override { return m_compressor.get(); }
+    Int64 synchronizeCompressMinSize() const override { return m_compress_min_size; }
+    Int64 variableCompressMinSize(IVariable* var) const override;
+    void addCompressStats(Int64 original_size, Int64 sent_size) override;
 
    public:
 
@@ -68,6 +76,18 @@ class ARCANE_IMPL_EXPORT VariableSynchronizerMng
 
     VariableSynchronizerMng* m_synchronizer_mng = nullptr;
     BufferList* m_buffer_list = nullptr;
+    Ref<IDataCompressor> m_compressor;
+    Int64 m_compress_min_size = 0;
+    //! Taille minimale de compression spécifique à certaines variables (indexées par nom complet)
+    std::map<String, Int64> m_variable_compress_min_size;
+    //! Nombre de messages pour lesquels la compression a été essayée
+    Int64 m_nb_compress_try = 0;
+    //! Nombre de messages envoyés compressés
+    Int64 m_nb_compressed = 0;
+    //! Taille totale non compressée des messages
+    Int64 m_total_original_size = 0;
+    //! Taille totale envoyée
+    Int64 m_total_sent_size = 0;
   };
 
  public:
@@ -86,6 +106,7 @@ class ARCANE_IMPL_EXPORT VariableSynchronizerMng
   void setSynchronizationCompareLevel(Int32 v) final { m_synchronize_compare_level = v; }
   Int32 synchronizationCompareLevel() const final { return m_synchronize_compare_level; }
   bool isSynchronizationComparisonEnabled() const final { return m_synchronize_compare_level > 0; }
+  void setSynchronizeCompressMinSize(IVariable* var, Int64 size) override;
 
   void dumpStats(std::ostream& ostr) const override;
   void flushPendingStats() override;
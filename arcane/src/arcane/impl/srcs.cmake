@@ -18,6 +18,8 @@ set( ARCANE_SOURCES
   CaseDocumentLangTranslator.h
   CaseMng.cc
   CheckpointMng.cc
+  CompressedDataSynchronizeImplementation.cc
+  DeltaDataSynchronizeImplementation.cc
   Configuration.cc
   ConfigurationReader.h
   ConfigurationReader.cc
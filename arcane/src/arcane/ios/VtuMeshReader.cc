@@ -242,14 +242,20 @@ readGroupsFromFieldData(IMesh* mesh,vtkFieldData* allFieldData,int i)
 
   // Récupère le localId() correspondant.
   Int32UniqueArray local_ids(unique_ids.size());
-  family->itemsUniqueIdToLocalId(local_ids,unique_ids,false);
+  Int32UniqueArray not_found_indexes;
+  family->itemsUniqueIdToLocalId(local_ids,unique_ids,not_found_indexes);
 
   // Tous les entités ne sont pas forcément dans le maillage actuel et
   // il faut donc les filtrer.
   Int32UniqueArray ids;
-  for( Integer i=0; i<nb_item; ++i )
-    if (local_ids[i]!=NULL_ITEM_LOCAL_ID)
-      ids.add(local_ids[i]);
+  if (not_found_indexes.empty())
+    ids = local_ids;
+  else{
+    ids.reserve(nb_item - not_found_indexes.size());
+    for( Integer i=0; i<nb_item; ++i )
+      if (local_ids[i]!=NULL_ITEM_LOCAL_ID)
+        ids.add(local_ids[i]);
+  }
 
   info() << "Create group family=" << family->name() << " name=" << group_name << " ids=" << ids.size();
   family->createGroup(group_name,ids);
@@ -491,6 +491,49 @@ recomputeIncremental()
     _checkConnectivityCoherency();
 }
 
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+/*!
+ * \brief Défragmente les valeurs partielles.
+ *
+ * Pour chaque indexeur dont le taux de fragmentation est supérieur
+ * à \a threshold, trie les entités suivant leur localId(), renumérote
+ * les valeurs partielles de manière contigüe et permute en une seule passe
+ * les valeurs partielles de toutes les variables matériaux. Les
+ * informations des milieux et matériaux sont ensuite recalculées.
+ *
+ * Retourne le nombre d'indexeurs défragmentés.
+ */
+Int32 AllEnvData::
+defragmentPartialValues(Real threshold)
+{
+  ConstArrayView<MeshMaterialVariableIndexer*> vars_idx = m_material_mng->_internalApi()->variablesIndexer();
+  RunQueue& queue(m_material_mng->runQueue());
+  UniqueArray<Int32> old_partial_indexes(MemoryUtils::getDefaultDataAllocator());
+  Int32 nb_defragmented = 0;
+
+  for (MeshMaterialVariableIndexer* var_indexer : vars_idx) {
+    MeshMaterialVariableIndexer::FragmentationInfo fi = var_indexer->fragmentationInfo();
+    if (fi.nb_item == 0 || fi.ratio() <= threshold)
+      continue;
+    info(4) << "DefragmentPartialValues indexer=" << var_indexer->name()
+            << " nb_item=" << fi.nb_item << " nb_partial=" << fi.nb_partial
+            << " nb_hole=" << fi.nb_hole << " nb_unordered=" << fi.nb_unordered
+            << " ratio=" << fi.ratio();
+    var_indexer->defragment(old_partial_indexes);
+    const Int32 var_index = var_indexer->index();
+    auto func = [&](IMeshMaterialVariable* mv) {
+      mv->_internalApi()->defragmentForIndexer(var_index, old_partial_indexes, queue);
+    };
+    functor::apply(m_material_mng, &MeshMaterialMng::visitVariables, func);
+    ++nb_defragmented;
+  }
+
+  if (nb_defragmented > 0)
+    recomputeIncremental();
+  return nb_defragmented;
+}
+
 /*---------------------------------------------------------------------------*/
 /*---------------------------------------------------------------------------*/
 
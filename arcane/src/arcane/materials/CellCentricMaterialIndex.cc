@@ -0,0 +1,117 @@
+﻿// -*- tab-width: 2; indent-tabs-mode: nil; coding: utf-8-with-signature -*-
+//-----------------------------------------------------------------------------
+// Copyright 2000-2024 CEA (www.cea.fr) IFPEN (www.ifpenergiesnouvelles.com)
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: Apache-2.0
+//-----------------------------------------------------------------------------
+/*---------------------------------------------------------------------------*/
+/* CellCentricMaterialIndex.cc                                 (C) 2000-2024 */
+/*                                                                           */
+/* Index des valeurs matériaux rangées de manière contigüe par maille.       */
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+#include "arcane/materials/CellCentricMaterialIndex.h"
+
+#include "arcane/utils/MemoryUtils.h"
+#include "arcane/utils/FatalErrorException.h"
+
+#include "arcane/core/IMesh.h"
+#include "arcane/core/IItemFamily.h"
+#include "arcane/core/ItemGroup.h"
+#include "arcane/core/materials/IMeshMaterialMng.h"
+#include "arcane/core/materials/MatItemEnumerator.h"
+#include "arcane/core/materials/CellToAllEnvCellConverter.h"
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+namespace Arcane::Materials
+{
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+CellCentricMaterialIndex::
+CellCentricMaterialIndex(IMeshMaterialMng* mm)
+: m_material_mng(mm)
+, m_cells_offset(MemoryUtils::getDefaultDataAllocator())
+, m_materials_id(MemoryUtils::getDefaultDataAllocator())
+, m_matvar_indexes(MemoryUtils::getDefaultDataAllocator())
+{
+  if (!mm)
+    ARCANE_FATAL("Null material manager");
+  m_cells_offset.add(0);
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+bool CellCentricMaterialIndex::
+update()
+{
+  if (m_timestamp == m_material_mng->timestamp())
+    return false;
+  forceUpdate();
+  return true;
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+void CellCentricMaterialIndex::
+forceUpdate()
+{
+  IMesh* mesh = m_material_mng->mesh();
+  CellGroup all_cells = mesh->allCells();
+  const Int32 nb_cell = mesh->cellFamily()->maxLocalId();
+
+  // Les mailles sans matériau ont un nombre de valeurs nul.
+  m_cells_offset.resize(nb_cell + 1);
+  m_cells_offset.fill(0);
+
+  CellToAllEnvCellConverter all_env_cell_converter(m_material_mng);
+
+  // Calcule le nombre de matériaux de chaque maille
+  Int32 nb_value = 0;
+  ENUMERATE_ (Cell, icell, all_cells) {
+    AllEnvCell all_env_cell = all_env_cell_converter[icell];
+    Int32 nb_mat = 0;
+    ENUMERATE_CELL_ENVCELL (ienvcell, all_env_cell) {
+      nb_mat += (*ienvcell).nbMaterial();
+    }
+    m_cells_offset[icell.itemLocalId() + 1] = nb_mat;
+    nb_value += nb_mat;
+  }
+
+  for (Int32 i = 0; i < nb_cell; ++i)
+    m_cells_offset[i + 1] += m_cells_offset[i];
+
+  m_materials_id.resize(nb_value);
+  m_matvar_indexes.resize(nb_value);
+
+  // Remplit les identifiants des matériaux et les indices dans le
+  // rangement classique.
+  ENUMERATE_ (Cell, icell, all_cells) {
+    AllEnvCell all_env_cell = all_env_cell_converter[icell];
+    Int32 index = m_cells_offset[icell.itemLocalId()];
+    ENUMERATE_CELL_ENVCELL (ienvcell, all_env_cell) {
+      ENUMERATE_CELL_MATCELL (imatcell, (*ienvcell)) {
+        MatCell mc = *imatcell;
+        m_materials_id[index] = static_cast<Int16>(mc.materialId());
+        m_matvar_indexes[index] = mc._varIndex();
+        ++index;
+      }
+    }
+  }
+
+  m_timestamp = m_material_mng->timestamp();
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+} // End namespace Arcane::Materials
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
@@ -0,0 +1,120 @@
+﻿// -*- tab-width: 2; indent-tabs-mode: nil; coding: utf-8-with-signature -*-
+//-----------------------------------------------------------------------------
+// Copyright 2000-2024 CEA (www.cea.fr) IFPEN (www.ifpenergiesnouvelles.com)
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: Apache-2.0
+//-----------------------------------------------------------------------------
+/*---------------------------------------------------------------------------*/
+/* CellCentricMaterialIndex.h                                  (C) 2000-2024 */
+/*                                                                           */
+/* Index des valeurs matériaux rangées de manière contigüe par maille.       */
+/*---------------------------------------------------------------------------*/
+#ifndef ARCANE_MATERIALS_CELLCENTRICMATERIALINDEX_H
+#define ARCANE_MATERIALS_CELLCENTRICMATERIALINDEX_H
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+#include "arcane/utils/Array.h"
+
+#include "arcane/core/materials/MatVarIndex.h"
+
+#include "arcane/materials/MaterialsGlobal.h"
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+namespace Arcane::Materials
+{
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+/*!
+ * \ingroup ArcaneMaterials
+ * \brief Index pour le rangement 'centré maille' des valeurs matériaux.
+ *
+ * Dans le rangement classique des variables matériaux, les valeurs sont
+ * rangées par matériau : les valeurs partielles d'un même matériau sont
+ * contigües mais celles des différents matériaux d'une même maille mixte
+ * sont éloignées en mémoire. Pour les noyaux de calcul qui itèrent sur les
+ * mailles puis sur les matériaux de chaque maille (fermeture des lois
+ * d'état, calcul des grandeurs moyennes, ...), cela conduit à des accès
+ * mémoire dispersés.
+ *
+ * Cette classe calcule un rangement compact de type CSR dans lequel les
+ * valeurs des matériaux d'une maille sont contigües. Pour une maille de
+ * numéro local \a lid, les valeurs sont aux indices compris entre
+ * cellsOffset()[lid] et cellsOffset()[lid+1]. Pour chacun de ces indices,
+ * on conserve l'identifiant du matériau et le MatVarIndex de la valeur
+ * dans le rangement classique. L'ordre des matériaux dans une maille est
+ * celui de ENUMERATE_CELL_ENVCELL puis de ENUMERATE_CELL_MATCELL.
+ *
+ * Cet index est partagé par toutes les instances de
+ * CellCentricMaterialVariableScalar associées au même gestionnaire de
+ * matériaux. Il doit être mis à jour via update() après chaque
+ * modification des MatVarIndex, ce qui est détecté par le changement de
+ * IMeshMaterialMng::timestamp(). CellCentricMaterialVariableScalar::gather()
+ * et la création des vues le font automatiquement. La mémoire utilisée est
+ * accessible sur accélérateur.
+ */
+class ARCANE_MATERIALS_EXPORT CellCentricMaterialIndex
+{
+ public:
+
+  explicit CellCentricMaterialIndex(IMeshMaterialMng* mm);
+
+ public:
+
+  CellCentricMaterialIndex(const CellCentricMaterialIndex&) = delete;
+  CellCentricMaterialIndex& operator=(const CellCentricMaterialIndex&) = delete;
+
+ public:
+
+  /*!
+   * \brief Met à jour l'index si les matériaux ont été modifiés.
+   *
+   * Retourne \a true si l'index a été recalculé.
+   */
+  bool update();
+
+  //! Force le recalcul de l'index
+  void forceUpdate();
+
+  //! Gestionnaire de matériaux associé
+  IMeshMaterialMng* materialMng() const { return m_material_mng; }
+
+  //! Nombre total de valeurs matériaux
+  Int32 nbValue() const { return m_matvar_indexes.size(); }
+
+  //! Nombre de mailles indexées (égal à maxLocalId() de la famille des mailles)
+  Int32 nbCell() const { return m_cells_offset.size() - 1; }
+
+  //! Indice de la première valeur de chaque maille (taille nbCell()+1)
+  SmallSpan<const Int32> cellsOffset() const { return m_cells_offset.view(); }
+
+  //! Identifiant du matériau de chaque valeur
+  SmallSpan<const Int16> materialsId() const { return m_materials_id.view(); }
+
+  //! Indice dans le rangement classique de chaque valeur
+  SmallSpan<const MatVarIndex> matVarIndexes() const { return m_matvar_indexes.view(); }
+
+  //! Temps de modification (IMeshMaterialMng::timestamp()) de la dernière mise à jour
+  Int64 timestamp() const { return m_timestamp; }
+
+ private:
+
+  IMeshMaterialMng* m_material_mng = nullptr;
+  Int64 m_timestamp = -1;
+  UniqueArray<Int32> m_cells_offset;
+  UniqueArray<Int16> m_materials_id;
+  UniqueArray<MatVarIndex> m_matvar_indexes;
+};
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+} // End namespace Arcane::Materials
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+#endif
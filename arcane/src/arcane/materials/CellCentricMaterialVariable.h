@@ -0,0 +1,221 @@
+﻿// -*- tab-width: 2; indent-tabs-mode: nil; coding: utf-8-with-signature -*-
+//-----------------------------------------------------------------------------
+// Copyright 2000-2024 CEA (www.cea.fr) IFPEN (www.ifpenergiesnouvelles.com)
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: Apache-2.0
+//-----------------------------------------------------------------------------
+/*---------------------------------------------------------------------------*/
+/* CellCentricMaterialVariable.h                               (C) 2000-2024 */
+/*                                                                           */
+/* Copie 'centrée maille' des valeurs d'une variable matériau.               */
+/*---------------------------------------------------------------------------*/
+#ifndef ARCANE_MATERIALS_CELLCENTRICMATERIALVARIABLE_H
+#define ARCANE_MATERIALS_CELLCENTRICMATERIALVARIABLE_H
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+#include "arcane/utils/Array.h"
+#include "arcane/utils/MemoryUtils.h"
+#include "arcane/utils/FatalErrorException.h"
+
+#include "arcane/core/materials/MeshMaterialVariableRef.h"
+#include "arcane/core/materials/IMeshMaterialMng.h"
+
+#include "arcane/materials/CellCentricMaterialIndex.h"
+
+#include "arcane/accelerator/core/RunQueue.h"
+#include "arcane/accelerator/RunCommandLoop.h"
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+namespace Arcane::Materials
+{
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+/*!
+ * \ingroup ArcaneMaterials
+ * \brief Accès 'centré maille' à une variable matériau scalaire.
+ *
+ * Cette classe permet de parcourir les valeurs matériaux d'une variable
+ * scalaire suivant le rangement décrit par CellCentricMaterialIndex.
+ *
+ * Par défaut, une copie des valeurs (le tampon compagnon) est conservée de
+ * telle sorte que les valeurs des matériaux d'une même maille soient
+ * contigües. Les vues accèdent alors uniquement à ce tampon. Si
+ * setUseCompanionBuffer() est désactivé pour cette variable, les vues
+ * accèdent directement aux valeurs de la variable via leur MatVarIndex et
+ * gather() et scatter() ne font rien. Cela évite la copie et la mémoire
+ * supplémentaire au prix d'accès mémoire dispersés.
+ *
+ * Le tampon compagnon n'est pas automatiquement synchronisé avec la
+ * variable. Il faut appeler gather() pour recopier les valeurs de la
+ * variable dans le tampon avant utilisation et scatter() pour recopier
+ * les valeurs du tampon dans la variable après modification. L'index
+ * associé est mis à jour par gather() et lors de la création des vues
+ * dès que le timestamp du gestionnaire de matériaux change, c'est à dire
+ * à chaque modification des MatVarIndex (modification des matériaux ou
+ * défragmentation). Si le tampon compagnon a été rempli avant une telle
+ * modification, la création des vues et scatter() lèvent une exception
+ * tant que gather() n'a pas été appelé de nouveau.
+ *
+ * L'accès aux valeurs dans les noyaux de calcul se fait via les vues
+ * retournées par Accelerator::viewIn(), Accelerator::viewOut() et
+ * Accelerator::viewInOut() (voir MaterialVariableViews.h) :
+ *
+ * \code
+ * CellCentricMaterialIndex index(material_mng);
+ * index.update();
+ * CellCentricMaterialVariableScalar<Real> pressure(&index, mat_pressure);
+ * pressure.gather(queue);
+ * auto command = makeCommand(queue);
+ * auto in_pressure = viewIn(command, pressure);
+ * command << RUNCOMMAND_ENUMERATE (Cell, cid, allCells())
+ * {
+ *   Real sum = 0.0;
+ *   for (Int32 i = 0, n = in_pressure.nbMaterial(cid); i < n; ++i)
+ *     sum += in_pressure(cid, i);
+ * };
+ * \endcode
+ */
+template <typename DataType>
+class CellCentricMaterialVariableScalar
+{
+ public:
+
+  CellCentricMaterialVariableScalar(CellCentricMaterialIndex* index,
+                                    const CellMaterialVariableScalarRef<DataType>& var)
+  : m_index(index)
+  , m_variable(var)
+  , m_values(MemoryUtils::getDefaultDataAllocator())
+  {
+    if (!m_index)
+      ARCANE_FATAL("Null index");
+  }
+
+ public:
+
+  //! Index associé
+  CellCentricMaterialIndex* index() const { return m_index; }
+
+  //! Variable associée
+  const CellMaterialVariableScalarRef<DataType>& variable() const { return m_variable; }
+
+  /*!
+   * \brief Indique si on utilise un tampon compagnon pour cette variable.
+   *
+   * Le défaut est \a true. Si \a v vaut \a false, la mémoire du tampon
+   * est libérée. Si \a v vaut \a true, il faut appeler gather() avant
+   * d'utiliser les vues.
+   */
+  void setUseCompanionBuffer(bool v)
+  {
+    m_use_companion_buffer = v;
+    m_values.clear();
+    m_values_timestamp = -1;
+  }
+
+  //! Indique si on utilise un tampon compagnon pour cette variable
+  bool isUseCompanionBuffer() const { return m_use_companion_buffer; }
+
+  //! Valeurs rangées par maille (vide s'il n'y a pas de tampon compagnon)
+  SmallSpan<const DataType> values() const { return m_values.view(); }
+
+  //! Valeurs rangées par maille (vide s'il n'y a pas de tampon compagnon)
+  SmallSpan<DataType> values() { return m_values.view(); }
+
+  /*!
+   * \brief Recopie les valeurs de la variable dans le tampon compagnon.
+   *
+   * L'index est mis à jour si les matériaux ont été modifiés.
+   * Ne fait rien s'il n'y a pas de tampon compagnon.
+   */
+  void gather(const Accelerator::RunQueue& queue)
+  {
+    if (!m_use_companion_buffer)
+      return;
+    m_index->update();
+    m_values_timestamp = m_index->timestamp();
+    m_values.resize(m_index->nbValue());
+    SmallSpan<DataType> values(m_values.view());
+    SmallSpan<const MatVarIndex> indexes(m_index->matVarIndexes());
+    ArrayView<DataType>* var_values = m_variable._internalValue();
+    auto command = makeCommand(queue);
+    command << RUNCOMMAND_LOOP1(iter, values.size())
+    {
+      auto [i] = iter();
+      MatVarIndex mvi = indexes[i];
+      values[i] = var_values[mvi.arrayIndex()][mvi.valueIndex()];
+    };
+  }
+
+  /*!
+   * \brief Recopie les valeurs du tampon compagnon dans la variable.
+   *
+   * Ne fait rien s'il n'y a pas de tampon compagnon.
+   */
+  void scatter(const Accelerator::RunQueue& queue)
+  {
+    if (!m_use_companion_buffer)
+      return;
+    _checkCompanionBuffer();
+    SmallSpan<const DataType> values(m_values.view());
+    SmallSpan<const MatVarIndex> indexes(m_index->matVarIndexes());
+    ArrayView<DataType>* var_values = m_variable._internalValue();
+    auto command = makeCommand(queue);
+    command << RUNCOMMAND_LOOP1(iter, values.size())
+    {
+      auto [i] = iter();
+      MatVarIndex mvi = indexes[i];
+      var_values[mvi.arrayIndex()][mvi.valueIndex()] = values[i];
+    };
+  }
+
+ public:
+
+  /*!
+   * \brief Met à jour l'index avant la création d'une vue.
+   *
+   * Si on utilise un tampon compagnon, vérifie qu'il a été rempli
+   * avec l'index courant.
+   *
+   * \note Cette méthode est interne à %Arcane et est appelée par
+   * les méthodes viewIn(), viewOut() et viewInOut().
+   */
+  void _internalUpdateForView() const
+  {
+    m_index->update();
+    if (m_use_companion_buffer)
+      _checkCompanionBuffer();
+  }
+
+ private:
+
+  CellCentricMaterialIndex* m_index = nullptr;
+  CellMaterialVariableScalarRef<DataType> m_variable;
+  UniqueArray<DataType> m_values;
+  //! Timestamp de l'index lors du dernier appel à gather()
+  Int64 m_values_timestamp = -1;
+  bool m_use_companion_buffer = true;
+
+ private:
+
+  void _checkCompanionBuffer() const
+  {
+    if (m_values_timestamp != m_index->materialMng()->timestamp())
+      ARCANE_FATAL("Companion buffer of variable '{0}' is not up to date "
+                   "(gather() has to be called after each modification of the materials)",
+                   m_variable.name());
+  }
+};
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+} // End namespace Arcane::Materials
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+#endif
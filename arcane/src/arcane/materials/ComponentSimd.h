@@ -1,11 +1,11 @@
 ﻿// -*- tab-width: 2; indent-tabs-mode: nil; coding: utf-8-with-signature -*-
 //-----------------------------------------------------------------------------
-// Copyright 2000-2022 CEA (www.cea.fr) IFPEN (www.ifpenergiesnouvelles.com)
+// Copyright 2000-2024 CEA (www.cea.fr) IFPEN (www.ifpenergiesnouvelles.com)
 // See the top-level COPYRIGHT file for details.
 // SPDX-License-Identifier: Apache-2.0
 //-----------------------------------------------------------------------------
 /*---------------------------------------------------------------------------*/
-/* ComponentSimd.h                                             (C) 2000-2017 */
+/* ComponentSimd.h                                             (C) 2000-2024 */
 /*                                                                           */
 /* Support de la vectorisation pour les matériaux et milieux.                */
 /*---------------------------------------------------------------------------*/
@@ -27,6 +27,8 @@
 #include "arcane/materials/MatItemEnumerator.h"
 #include "arcane/materials/ComponentPartItemVectorView.h"
 
+#include "arcane/core/materials/SimdMatVarIndex.h"
+
 /*---------------------------------------------------------------------------*/
 /*---------------------------------------------------------------------------*/
 
@@ -42,37 +44,6 @@
 ARCANE_BEGIN_NAMESPACE
 MATERIALS_BEGIN_NAMESPACE
 
-/*---------------------------------------------------------------------------*/
-/*---------------------------------------------------------------------------*/
-/*!
- * \brief Indexeur SIMD sur un composant.
- */
-class ARCANE_MATERIALS_EXPORT ARCANE_ALIGNAS(64) SimdMatVarIndex
-{
- public:
-  typedef SimdEnumeratorBase::SimdIndexType SimdIndexType;
- public:
-
-  SimdMatVarIndex(Int32 array_index,SimdIndexType value_index)
-  : m_value_index(value_index), m_array_index(array_index)
-  {
-  }
-  SimdMatVarIndex(){}
-
- public:
-
-  //! Retourne l'indice du tableau de valeur dans la liste des variables.
-  Int32 arrayIndex() const { return m_array_index; }
-
-  //! Retourne l'indice dans le tableau de valeur
-  const SimdIndexType& valueIndex() const { return m_value_index; }
-
- private:
-
-  SimdIndexType m_value_index;
-  Int32 m_array_index;
-};
-
 /*---------------------------------------------------------------------------*/
 /*---------------------------------------------------------------------------*/
 /*!
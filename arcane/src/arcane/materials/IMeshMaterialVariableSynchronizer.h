@@ -1,11 +1,11 @@
 ﻿// -*- tab-width: 2; indent-tabs-mode: nil; coding: utf-8-with-signature -*-
 //-----------------------------------------------------------------------------
-// Copyright 2000-2023 CEA (www.cea.fr) IFPEN (www.ifpenergiesnouvelles.com)
+// Copyright 2000-2024 CEA (www.cea.fr) IFPEN (www.ifpenergiesnouvelles.com)
 // See the top-level COPYRIGHT file for details.
 // SPDX-License-Identifier: Apache-2.0
 //-----------------------------------------------------------------------------
 /*---------------------------------------------------------------------------*/
-/* IMeshMaterialVariableSynchronizer.h                         (C) 2000-2023 */
+/* IMeshMaterialVariableSynchronizer.h                         (C) 2000-2024 */
 /*                                                                           */
 /* Interface du synchroniseur de variables matériaux.                        */
 /*---------------------------------------------------------------------------*/
@@ -69,6 +69,17 @@ class ARCANE_MATERIALS_EXPORT IMeshMaterialVariableSynchronizer
 
   //! Ressource mémoire à utiliser pour les buffers de communication
   virtual eMemoryRessource bufferMemoryRessource() const =0;
+
+  /*!
+   * \brief Indique si seules les valeurs partielles des mailles mixtes
+   * sont échangées.
+   *
+   * Dans ce cas, sharedItems() et ghostItems() ne contiennent pas les
+   * MatVarIndex des valeurs globales (MatVarIndex::arrayIndex() nul) et
+   * il faut synchroniser la variable globale associée pour avoir des
+   * valeurs cohérentes dans les mailles pures.
+   */
+  virtual bool isMixedCellsOnly() const =0;
 };
 
 /*---------------------------------------------------------------------------*/
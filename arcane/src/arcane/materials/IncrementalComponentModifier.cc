@@ -19,6 +19,7 @@
 #include "arcane/utils/MemoryUtils.h"
 
 #include "arcane/core/IItemFamily.h"
+#include "arcane/core/Concurrency.h"
 #include "arcane/core/internal/ItemGroupImplInternal.h"
 #include "arcane/core/materials/IMeshMaterialVariable.h"
 #include "arcane/core/materials/internal/IMeshMaterialVariableInternal.h"
@@ -60,6 +61,19 @@ initialize()
   Int32 max_local_id = m_material_mng->mesh()->cellFamily()->maxLocalId();
   m_work_info.initialize(max_local_id, m_queue);
   m_work_info.is_verbose = traceMng()->verbosityLevel() >= 5;
+
+  // Le mode multi-thread n'est utilisé que si les tâches sont actives
+  // et que les calculs ont lieu sur l'hôte.
+  m_is_multi_thread_active = m_use_multi_thread && TaskFactory::isActive() && !m_queue.isAcceleratorPolicy();
+  if (m_is_multi_thread_active) {
+    // Utilise plus de blocs que de threads pour équilibrer la charge.
+    // Chaque bloc a sa propre file car les files ne peuvent pas être
+    // utilisées simultanément par plusieurs threads.
+    Int32 nb_block = TaskFactory::nbAllowedThread() * 2;
+    while (m_thread_queues.size() < nb_block)
+      m_thread_queues.add(makeQueue(m_material_mng->runner()));
+  }
+  info(4) << "IncrementalComponentModifier: use_multi_thread=" << m_is_multi_thread_active;
 }
 
 /*---------------------------------------------------------------------------*/
@@ -70,6 +84,49 @@ finalize()
 {
 }
 
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+/*!
+ * \brief Applique \a func en parallèle sur les indices [0,n[.
+ *
+ * \a func est appelée avec comme arguments l'indice et la file à utiliser.
+ * Les indices sont répartis en blocs contigus et chaque bloc utilise sa
+ * propre file. Comme la répartition ne dépend que de \a n et du nombre de
+ * files, elle est identique d'une exécution à l'autre.
+ */
+template <typename Lambda> void IncrementalComponentModifier::
+_parallelFor(Int32 n, const Lambda& func)
+{
+  const Int32 nb_block = math::min(n, m_thread_queues.size());
+  if (nb_block == 0)
+    return;
+  ParallelLoopOptions options;
+  options.setGrainSize(1);
+  arcaneParallelFor(0, nb_block, options, [&](Int32 begin, Int32 size) {
+    for (Int32 block = begin; block < (begin + size); ++block) {
+      RunQueue& queue = m_thread_queues[block];
+      const Int32 first = (n * block) / nb_block;
+      const Int32 last = (n * (block + 1)) / nb_block;
+      for (Int32 i = first; i < last; ++i)
+        func(i, queue);
+    }
+  });
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+UniqueArray<IMeshMaterialVariable*> IncrementalComponentModifier::
+_materialVariables() const
+{
+  UniqueArray<IMeshMaterialVariable*> vars;
+  auto func = [&](IMeshMaterialVariable* mv) {
+    vars.add(mv);
+  };
+  functor::apply(static_cast<IMeshMaterialMng*>(m_material_mng), &IMeshMaterialMng::visitVariables, func);
+  return vars;
+}
+
 /*---------------------------------------------------------------------------*/
 /*---------------------------------------------------------------------------*/
 
@@ -189,7 +246,10 @@ apply(MaterialModifierOperation* operation)
   // d'ajout) ou les mailles partielles en mailles pures (en cas de
   // suppression).
   info(4) << "Transform PartialPure for material name=" << true_mat->name();
-  _switchCellsForMaterials(true_mat, orig_ids);
+  if (m_is_multi_thread_active)
+    _switchCellsForMaterialsMultiThread(true_mat, orig_ids);
+  else
+    _switchCellsForMaterials(true_mat, orig_ids);
   info(4) << "Transform PartialPure for environment name=" << env->name();
   _switchCellsForEnvironments(env, orig_ids);
 
@@ -298,6 +358,11 @@ _switchCellsForEnvironments(const IMeshEnvironment* modified_env,
   // optimisation. Ce n'est pas actif par défaut pour compatibilité avec l'existant.
   const bool is_copy = is_add || !(m_material_mng->isUseMaterialValueWhenRemovingPartialValue());
 
+  if (m_is_multi_thread_active) {
+    _switchCellsForEnvironmentsMultiThread(modified_env, ids, is_copy);
+    return;
+  }
+
   for (const MeshEnvironment* env : m_material_mng->trueEnvironments()) {
     // Ne traite pas le milieu en cours de modification.
     if (env == modified_env)
@@ -529,7 +594,18 @@ _addItemsToIndexer(MeshMaterialVariableIndexer* var_indexer,
 
   // Maintenant que les nouveaux MatVar sont créés, il faut les
   // initialiser avec les bonnes valeurs.
-  {
+  if (m_is_multi_thread_active) {
+    // Les variables sont indépendantes et peuvent donc être traitées en parallèle.
+    UniqueArray<IMeshMaterialVariable*> vars = _materialVariables();
+    bool do_init = m_do_init_new_items;
+    _parallelFor(vars.size(), [&](Int32 index, RunQueue& queue) {
+      IMeshMaterialVariable* mv = vars[index];
+      mv->_internalApi()->resizeForIndexer(var_indexer->index(), queue);
+      if (do_init)
+        mv->_internalApi()->initializeNewItems(list_builder, queue);
+    });
+  }
+  else {
     // TODO: Comme tout est indépendant par variable, on pourrait
     // éventuellement utiliser plusieurs files.
     RunQueue::ScopedAsync sc(&m_queue);
@@ -545,6 +621,144 @@ _addItemsToIndexer(MeshMaterialVariableIndexer* var_indexer,
   }
 }
 
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+/*!
+ * \brief Version multi-thread de _switchCellsForMaterials().
+ *
+ * Les mailles à transformer ne dépendent que du milieu. Elles sont donc
+ * calculées une seule fois par milieu puis les indexeurs des matériaux
+ * du milieu sont transformés en parallèle. Les valeurs des variables
+ * sont ensuite mises à jour en parallèle sur les variables.
+ */
+void IncrementalComponentModifier::
+_switchCellsForMaterialsMultiThread(const MeshMaterial* modified_mat,
+                                    SmallSpan<const Int32> ids)
+{
+  UniqueArray<MeshMaterialVariableIndexer*> indexers;
+
+  for (MeshEnvironment* true_env : m_material_mng->trueEnvironments()) {
+    const MeshMaterial* first_mat = nullptr;
+    const Int32 first_index = indexers.size();
+    for (MeshMaterial* mat : true_env->trueMaterials()) {
+      // Ne traite pas le matériau en cours de modification.
+      if (mat == modified_mat)
+        continue;
+      if (!first_mat)
+        first_mat = mat;
+      indexers.add(mat->variableIndexer());
+    }
+    if (!first_mat)
+      continue;
+
+    _computeCellsToTransformForMaterial(first_mat, ids);
+    _transformIndexersMultiThread(indexers.subConstView(first_index, indexers.size() - first_index), first_index);
+    _resetTransformedCells(ids);
+  }
+
+  _copyBetweenPartialsAndGlobalsMultiThread(indexers);
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+/*!
+ * \brief Version multi-thread de _switchCellsForEnvironments().
+ */
+void IncrementalComponentModifier::
+_switchCellsForEnvironmentsMultiThread(const IMeshEnvironment* modified_env,
+                                       SmallSpan<const Int32> ids, bool is_copy)
+{
+  UniqueArray<MeshMaterialVariableIndexer*> indexers;
+  for (const MeshEnvironment* env : m_material_mng->trueEnvironments()) {
+    // Ne traite pas le milieu en cours de modification.
+    if (env == modified_env)
+      continue;
+    indexers.add(env->variableIndexer());
+  }
+  if (indexers.empty())
+    return;
+
+  // Les mailles à transformer sont les mêmes pour tous les milieux.
+  _computeCellsToTransformForEnvironments(ids);
+  _transformIndexersMultiThread(indexers, 0);
+  _resetTransformedCells(ids);
+
+  if (is_copy)
+    _copyBetweenPartialsAndGlobalsMultiThread(indexers);
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+/*!
+ * \brief Transforme en parallèle les indexeurs \a indexers.
+ *
+ * Les mailles transformées de l'indexeur \a indexers[i] sont conservées dans
+ * m_transformed_cells_infos[first_info_index+i].
+ */
+void IncrementalComponentModifier::
+_transformIndexersMultiThread(ConstArrayView<MeshMaterialVariableIndexer*> indexers,
+                              Int32 first_info_index)
+{
+  const Int32 nb_indexer = indexers.size();
+  const std::size_t nb_needed = first_info_index + nb_indexer;
+  while (m_transformed_cells_infos.size() < nb_needed)
+    m_transformed_cells_infos.emplace_back(std::make_unique<TransformedCellsInfo>());
+
+  _parallelFor(nb_indexer, [&](Int32 index, RunQueue& queue) {
+    TransformedCellsInfo& cells_info = *m_transformed_cells_infos[first_info_index + index];
+    cells_info.pure_local_ids.clearHost();
+    cells_info.partial_indexes.clearHost();
+    indexers[index]->transformCellsV2(m_work_info, cells_info.pure_local_ids,
+                                      cells_info.partial_indexes, queue);
+  });
+
+  if (m_work_info.is_verbose) {
+    for (Int32 i = 0; i < nb_indexer; ++i) {
+      TransformedCellsInfo& cells_info = *m_transformed_cells_infos[first_info_index + i];
+      info() << "NB_TRANSFORM (MT) nb_pure=" << cells_info.pure_local_ids.view(false).size()
+             << " name=" << indexers[i]->name();
+    }
+  }
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+/*!
+ * \brief Met à jour en parallèle les valeurs des variables après
+ * transformation des indexeurs \a indexers.
+ *
+ * Chaque tâche traite toutes les transformations d'une variable dans l'ordre
+ * des indexeurs, ce qui garantit le même résultat qu'en séquentiel.
+ */
+void IncrementalComponentModifier::
+_copyBetweenPartialsAndGlobalsMultiThread(ConstArrayView<MeshMaterialVariableIndexer*> indexers)
+{
+  const bool is_add = m_work_info.isAdd();
+  const bool do_copy = m_do_copy_between_partial_and_pure;
+  const Int32 nb_indexer = indexers.size();
+  UniqueArray<IMeshMaterialVariable*> vars = _materialVariables();
+
+  _parallelFor(vars.size(), [&](Int32 index, RunQueue& queue) {
+    IMeshMaterialVariableInternal* mvi = vars[index]->_internalApi();
+    for (Int32 i = 0; i < nb_indexer; ++i) {
+      TransformedCellsInfo& cells_info = *m_transformed_cells_infos[i];
+      SmallSpan<const Int32> pure_local_ids = cells_info.pure_local_ids.view(false);
+      if (pure_local_ids.empty())
+        continue;
+      SmallSpan<const Int32> partial_indexes = cells_info.partial_indexes.view(false);
+      MeshVariableCopyBetweenPartialAndGlobalArgs args(indexers[i]->index(), pure_local_ids,
+                                                       partial_indexes, do_copy, &queue);
+      if (is_add) {
+        mvi->resizeForIndexer(args.m_var_index, queue);
+        if (do_copy)
+          mvi->copyGlobalToPartial(args);
+      }
+      else if (do_copy)
+        mvi->copyPartialToGlobal(args);
+    }
+  });
+}
+
 /*---------------------------------------------------------------------------*/
 /*---------------------------------------------------------------------------*/
 
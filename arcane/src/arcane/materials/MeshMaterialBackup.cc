@@ -1,11 +1,11 @@
 ﻿// -*- tab-width: 2; indent-tabs-mode: nil; coding: utf-8-with-signature -*-
 //-----------------------------------------------------------------------------
-// Copyright 2000-2023 CEA (www.cea.fr) IFPEN (www.ifpenergiesnouvelles.com)
+// Copyright 2000-2024 CEA (www.cea.fr) IFPEN (www.ifpenergiesnouvelles.com)
 // See the top-level COPYRIGHT file for details.
 // SPDX-License-Identifier: Apache-2.0
 //-----------------------------------------------------------------------------
 /*---------------------------------------------------------------------------*/
-/* MeshMaterialBackup.cc                                       (C) 2000-2023 */
+/* MeshMaterialBackup.cc                                       (C) 2000-2024 */
 /*                                                                           */
 /* Sauvegarde/restauration des valeurs des matériaux et milieux.             */
 /*---------------------------------------------------------------------------*/
@@ -104,16 +104,23 @@ setCompressorServiceName(const String& name)
 /*---------------------------------------------------------------------------*/
 /*!
  * \brief Indique si la variable \a var est définie sur le composant \a component.
+ *
+ * Si la variable alloue ses valeurs partielles à la demande, il faut
+ * en plus que ces valeurs soient allouées pour \a component.
  */
 bool MeshMaterialBackup::
 _isValidComponent(IMeshMaterialVariable* var,IMeshComponent* component)
 {
   MatVarSpace mvs = var->space();
+  bool is_valid = false;
   if (mvs==MatVarSpace::MaterialAndEnvironment)
-    return true;
-  if (mvs==MatVarSpace::Environment && component->isEnvironment())
-    return true;
-  return false;
+    is_valid = true;
+  else if (mvs==MatVarSpace::Environment && component->isEnvironment())
+    is_valid = true;
+  // Les valeurs partielles non allouées n'ont pas besoin d'être sauvegardées.
+  if (is_valid && var->isAllocatePartialValuesOnDemand())
+    is_valid = var->hasPartialValues(component);
+  return is_valid;
 }
 
 /*---------------------------------------------------------------------------*/
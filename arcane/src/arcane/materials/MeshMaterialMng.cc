@@ -138,6 +138,10 @@ MeshMaterialMng::
   if (tracer)
     tracer->dumpStats();
 
+  // Les statistiques utilisent les indexeurs qui sont détruits ci-dessous.
+  if (m_modifier)
+    m_modifier->dumpStats();
+
   delete m_variable_factory_mng;
   m_exchange_mng.reset();
   m_all_cells_env_only_synchronizer.reset();
@@ -162,10 +166,7 @@ MeshMaterialMng::
   for( MeshMaterialVariableIndexer* mvi : m_variables_indexer_to_destroy )
     delete mvi;
 
-  if (m_modifier){
-    m_modifier->dumpStats();
-    m_modifier.reset();
-  }
+  m_modifier.reset();
 
   m_internal_api.reset();
 
@@ -617,6 +618,18 @@ forceRecompute()
   _endUpdate();
 }
 
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+void MeshMaterialMng::
+defragmentPartialValues()
+{
+  // Le modificateur n'existe qu'après l'appel à endCreate().
+  if (!m_modifier)
+    ARCANE_FATAL("Invalid call to defragmentPartialValues() before endCreate()");
+  m_modifier->defragmentPartialValues(0.0);
+}
+
 /*---------------------------------------------------------------------------*/
 /*---------------------------------------------------------------------------*/
 /*!
@@ -128,6 +128,24 @@ setPersistantWorkBuffer(bool v)
 /*---------------------------------------------------------------------------*/
 /*---------------------------------------------------------------------------*/
 
+void MeshMaterialModifier::
+setUseMultiThread(bool v)
+{
+  m_impl->setUseMultiThread(v);
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+void MeshMaterialModifier::
+setDefragmentThreshold(Real v)
+{
+  m_impl->setDefragmentThreshold(v);
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
 } // namespace Arcane::Materials
 
 /*---------------------------------------------------------------------------*/
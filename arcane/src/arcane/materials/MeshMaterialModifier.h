@@ -97,6 +97,38 @@ class ARCANE_MATERIALS_EXPORT MeshMaterialModifier
    */
   void setPersistantWorkBuffer(bool v);
 
+  /*!
+   * \brief Indique si on utilise plusieurs threads pour la mise à jour.
+   *
+   * Si vrai et que le multi-threading est actif (TaskFactory::isActive()),
+   * les transformations des matériaux et milieux indépendants ainsi que
+   * les mises à jour des valeurs des variables sont effectuées en parallèle
+   * lors de endUpdate(). Le résultat est identique à celui obtenu sans
+   * multi-threading. Cela n'est utilisé que si les modifications
+   * sont faites sur l'hôte et que les optimisations sont actives
+   * (IMeshMaterialMng::setModificationFlags()).
+   *
+   * La valeur par défaut est faux sauf si la variable d'environnement
+   * ARCANE_MATERIAL_MODIFIER_USE_MULTI_THREAD vaut 1.
+   */
+  void setUseMultiThread(bool v);
+
+  /*!
+   * \brief Positionne le taux de fragmentation à partir duquel les valeurs
+   * partielles sont défragmentées.
+   *
+   * Après les modifications incrémentales effectuées lors de endUpdate(), si
+   * le taux de fragmentation d'un matériau ou d'un milieu est supérieur à
+   * \a v, ses mailles sont triées suivant leur localId() et ses valeurs
+   * partielles sont renumérotées de manière contigüe
+   * (voir IMeshMaterialMng::defragmentPartialValues()). Le taux est compris
+   * entre 0 et 1. Une valeur nulle désactive la défragmentation automatique.
+   *
+   * La valeur par défaut est 0 sauf si la variable d'environnement
+   * ARCANE_MATERIAL_DEFRAGMENT_THRESHOLD est positionnée.
+   */
+  void setDefragmentThreshold(Real v);
+
  private:
 
   MeshMaterialModifierImpl* m_impl = nullptr;
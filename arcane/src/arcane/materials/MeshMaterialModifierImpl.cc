@@ -29,6 +29,7 @@
 #include "arcane/materials/internal/MaterialModifierOperation.h"
 #include "arcane/materials/internal/IncrementalComponentModifier.h"
 #include "arcane/materials/internal/ConstituentListPrinter.h"
+#include "arcane/materials/internal/MeshMaterialVariableIndexer.h"
 
 /*---------------------------------------------------------------------------*/
 /*---------------------------------------------------------------------------*/
@@ -88,6 +89,10 @@ MeshMaterialModifierImpl(MeshMaterialMng* mm)
     if (value > 1)
       m_print_component_list = true;
   }
+  if (auto v = Convert::Type<Int32>::tryParseFromEnvironment("ARCANE_MATERIAL_MODIFIER_USE_MULTI_THREAD", true))
+    m_use_multi_thread = (v.value() != 0);
+  if (auto v = Convert::Type<Real>::tryParseFromEnvironment("ARCANE_MATERIAL_DEFRAGMENT_THRESHOLD", true))
+    m_defragment_threshold = v.value();
 }
 
 /*---------------------------------------------------------------------------*/
@@ -262,9 +267,12 @@ _endUpdate()
     m_incremental_modifier = std::make_unique<IncrementalComponentModifier>(all_env_data, m_queue);
   }
   if (is_optimization_active && m_use_incremental_recompute) {
-    m_incremental_modifier->initialize();
+    // Les propriétés doivent être positionnées avant initialize() qui
+    // s'en sert pour déterminer si le mode multi-thread est actif.
     m_incremental_modifier->setDoCopyBetweenPartialAndPure(m_do_copy_between_partial_and_pure);
     m_incremental_modifier->setDoInitNewItems(m_do_init_new_items);
+    m_incremental_modifier->setUseMultiThread(m_use_multi_thread);
+    m_incremental_modifier->initialize();
   }
 
   if (is_optimization_active) {
@@ -288,6 +296,8 @@ _endUpdate()
         op->filterIds();
 
       m_incremental_modifier->apply(op);
+      if (m_incremental_modifier->isMultiThreadActive())
+        ++nb_optimize_multi_thread;
     }
     no_optimization_done = false;
   }
@@ -310,6 +320,9 @@ _endUpdate()
   else {
     m_incremental_modifier->finalize();
     all_env_data->recomputeIncremental();
+    // Les modifications incrémentales fragmentent les valeurs partielles.
+    if (m_defragment_threshold > 0.0)
+      defragmentPartialValues(m_defragment_threshold);
   }
 
   if (!m_is_keep_work_buffer)
@@ -416,6 +429,52 @@ dumpStats()
   info() << " Nb save/restore : " << nb_save_restore;
   info() << " Nb optimized add : " << nb_optimize_add;
   info() << " Nb optimized remove : " << nb_optimize_remove;
+  info() << " Nb optimized multi-thread : " << nb_optimize_multi_thread;
+  info() << " Nb defragment : " << nb_defragment
+         << " (nb_indexer=" << nb_defragmented_indexer << ")";
+
+  // Affiche le taux de fragmentation actuel des valeurs partielles.
+  Int64 total_nb_partial = 0;
+  Int64 total_nb_hole = 0;
+  Int64 total_nb_unordered = 0;
+  Real max_ratio = 0.0;
+  String max_ratio_name;
+  for (MeshMaterialVariableIndexer* var_indexer : m_material_mng->_internalApi()->variablesIndexer()) {
+    MeshMaterialVariableIndexer::FragmentationInfo fi = var_indexer->fragmentationInfo();
+    total_nb_partial += fi.nb_partial;
+    total_nb_hole += fi.nb_hole;
+    total_nb_unordered += fi.nb_unordered;
+    if (fi.ratio() > max_ratio) {
+      max_ratio = fi.ratio();
+      max_ratio_name = var_indexer->name();
+    }
+  }
+  info() << " Fragmentation : nb_partial=" << total_nb_partial
+         << " nb_hole=" << total_nb_hole
+         << " nb_unordered=" << total_nb_unordered
+         << " max_ratio=" << max_ratio << " (" << max_ratio_name << ")";
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+/*!
+ * \brief Défragmente les valeurs partielles dont le taux de fragmentation
+ * est supérieur à \a threshold.
+ *
+ * Si des valeurs ont été déplacées, les MatVarIndex changent et il faut
+ * incrémenter le timestamp pour que les structures qui en dépendent
+ * (par exemple CellCentricMaterialIndex) soient mises à jour.
+ */
+void MeshMaterialModifierImpl::
+defragmentPartialValues(Real threshold)
+{
+  Int32 n = m_material_mng->allEnvData()->defragmentPartialValues(threshold);
+  if (n > 0) {
+    m_material_mng->incrementTimestamp();
+    ++nb_defragment;
+    nb_defragmented_indexer += n;
+  }
+  linfo() << "DefragmentPartialValues threshold=" << threshold << " nb_indexer=" << n;
 }
 
 /*---------------------------------------------------------------------------*/
@@ -46,6 +46,8 @@
 #include "arcane/materials/internal/MeshMaterialVariablePrivate.h"
 #include "arcane/materials/internal/MeshMaterialVariableIndexer.h"
 
+#include "arcane/accelerator/core/RunQueue.h"
+
 /*---------------------------------------------------------------------------*/
 /*---------------------------------------------------------------------------*/
 
@@ -183,6 +185,15 @@ resizeForIndexer(Int32 index, RunQueue& queue)
 /*---------------------------------------------------------------------------*/
 /*---------------------------------------------------------------------------*/
 
+void MeshMaterialVariablePrivate::
+defragmentForIndexer(Int32 index, SmallSpan<const Int32> old_partial_indexes, RunQueue& queue)
+{
+  m_variable->_defragmentForIndexer(index, old_partial_indexes, queue);
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
 /*---------------------------------------------------------------------------*/
 /*---------------------------------------------------------------------------*/
 
@@ -277,6 +288,7 @@ removeVariableRef(MeshMaterialVariableRef* ref)
     // pas détruit.
     delete m_p->m_global_variable_changed_observer;
     m_p->m_global_variable_changed_observer = nullptr;
+    m_p->m_partial_values_read_observers.detachAll();
     m_p->materialMng()->_internalApi()->removeVariable(this);
     delete this;
   }
@@ -331,6 +343,96 @@ keepOnChange() const
 /*---------------------------------------------------------------------------*/
 /*---------------------------------------------------------------------------*/
 
+void MeshMaterialVariable::
+setAllocatePartialValuesOnDemand(bool v)
+{
+  if (m_p->m_is_allocate_on_demand == v)
+    return;
+  m_p->m_is_allocate_on_demand = v;
+  ConstArrayView<MeshMaterialVariableIndexer*> indexers = m_p->materialMng()->_internalApi()->variablesIndexer();
+  for (MeshMaterialVariableIndexer* indexer : indexers) {
+    Int32 index = indexer->index();
+    if (v) {
+      // En reprise, conserve les valeurs partielles qui ont été relues.
+      ConstArrayView<bool> is_read = m_p->m_is_partial_values_read;
+      if (index >= is_read.size() || !is_read[index])
+        _releasePartialValues(index);
+    }
+    else
+      _allocatePartialValues(index);
+  }
+  syncReferences();
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+bool MeshMaterialVariable::
+isAllocatePartialValuesOnDemand() const
+{
+  return m_p->m_is_allocate_on_demand;
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+void MeshMaterialVariable::
+allocatePartialValues(IMeshComponent* component)
+{
+  Int32 index = _checkComponentIndex(component);
+  if (_hasPartialValues(index))
+    return;
+  _traceMng()->info(5) << "Allocate partial values for variable '" << name()
+                       << "' component=" << component->name();
+  _allocatePartialValues(index);
+  syncReferences();
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+void MeshMaterialVariable::
+releasePartialValues(IMeshComponent* component)
+{
+  if (!m_p->m_is_allocate_on_demand)
+    ARCANE_FATAL("Can not release partial values of variable '{0}' because"
+                 " allocation on demand is not active",
+                 name());
+  Int32 index = _checkComponentIndex(component);
+  if (!_hasPartialValues(index))
+    return;
+  _traceMng()->info(5) << "Release partial values for variable '" << name()
+                       << "' component=" << component->name();
+  _releasePartialValues(index);
+  syncReferences();
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+bool MeshMaterialVariable::
+hasPartialValues(IMeshComponent* component) const
+{
+  if (!component->hasSpace(space()))
+    return false;
+  return _hasPartialValues(component->_internalApi()->variableIndexerIndex());
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+Int32 MeshMaterialVariable::
+_checkComponentIndex(IMeshComponent* component) const
+{
+  if (!component->hasSpace(space()))
+    ARCANE_FATAL("Component '{0}' is not in the space of variable '{1}'",
+                 component->name(), name());
+  return component->_internalApi()->variableIndexerIndex();
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
 void MeshMaterialVariable::
 update(IMeshMaterial* mat)
 {
@@ -367,6 +469,9 @@ update(IMeshMaterial* mat)
   if (need_update){
     IMeshMaterialVariableComputeFunction* cf = m_p->m_compute_function.get();
     if (cf){
+      // Le calcul écrit les valeurs du matériau : il faut qu'elles soient allouées.
+      if (m_p->m_is_allocate_on_demand)
+        allocatePartialValues(mat);
       cf->execute(mat);
     }
     else{
@@ -493,10 +598,29 @@ _copyToBuffer(SmallSpan<const MatVarIndex> matvar_indexes,
               Span<std::byte> bytes, RunQueue* queue) const
 {
   const Integer one_data_size = dataTypeSize();
-  SmallSpan<const Int32> indexes(_toInt32Indexes(matvar_indexes));
   const Int32 nb_item = matvar_indexes.size();
   MutableMemoryView destination_buffer(makeMutableMemoryView(bytes.data(),one_data_size,nb_item));
   ConstMultiMemoryView source_view(m_views_as_bytes.view(),one_data_size);
+  if (m_p->m_is_allocate_on_demand) {
+    // Ne copie que les valeurs des composants alloués. Les autres valeurs
+    // du buffer ne sont pas modifiées.
+    UniqueArray<Int32> positions(MemoryUtils::getDefaultDataAllocator());
+    UniqueArray<MatVarIndex> allocated_indexes(MemoryUtils::getDefaultDataAllocator());
+    _filterAllocatedIndexes(matvar_indexes, positions, allocated_indexes);
+    if (positions.size() != nb_item) {
+      const Int32 nb_allocated = positions.size();
+      UniqueArray<std::byte> tmp_values(MemoryUtils::getDefaultDataAllocator());
+      tmp_values.resize(static_cast<Int64>(nb_allocated) * one_data_size);
+      MutableMemoryView tmp_view(makeMutableMemoryView(tmp_values.data(), one_data_size, nb_allocated));
+      source_view.copyToIndexes(tmp_view, _toInt32Indexes(allocated_indexes), queue);
+      destination_buffer.copyFromIndexes(tmp_view, positions, queue);
+      // Il faut attendre la fin des copies avant de détruire les tableaux temporaires.
+      if (queue)
+        queue->barrier();
+      return;
+    }
+  }
+  SmallSpan<const Int32> indexes(_toInt32Indexes(matvar_indexes));
   source_view.copyToIndexes(destination_buffer,indexes,queue);
 }
 
@@ -508,13 +632,56 @@ _copyFromBuffer(SmallSpan<const MatVarIndex> matvar_indexes,
                 Span<const std::byte> bytes, RunQueue* queue)
 {
   const Int32 one_data_size = dataTypeSize();
-  SmallSpan<const Int32> indexes(_toInt32Indexes(matvar_indexes));
   const Int32 nb_item = matvar_indexes.size();
   MutableMultiMemoryView destination_view(m_views_as_bytes.view(),one_data_size);
   ConstMemoryView source_buffer(makeConstMemoryView(bytes.data(),one_data_size,nb_item));
+  if (m_p->m_is_allocate_on_demand) {
+    // Ignore les valeurs des composants non alloués.
+    UniqueArray<Int32> positions(MemoryUtils::getDefaultDataAllocator());
+    UniqueArray<MatVarIndex> allocated_indexes(MemoryUtils::getDefaultDataAllocator());
+    _filterAllocatedIndexes(matvar_indexes, positions, allocated_indexes);
+    if (positions.size() != nb_item) {
+      const Int32 nb_allocated = positions.size();
+      UniqueArray<std::byte> tmp_values(MemoryUtils::getDefaultDataAllocator());
+      tmp_values.resize(static_cast<Int64>(nb_allocated) * one_data_size);
+      MutableMemoryView tmp_view(makeMutableMemoryView(tmp_values.data(), one_data_size, nb_allocated));
+      source_buffer.copyToIndexes(tmp_view, positions, queue);
+      destination_view.copyFromIndexes(tmp_view, _toInt32Indexes(allocated_indexes), queue);
+      // Il faut attendre la fin des copies avant de détruire les tableaux temporaires.
+      if (queue)
+        queue->barrier();
+      return;
+    }
+  }
+  SmallSpan<const Int32> indexes(_toInt32Indexes(matvar_indexes));
   destination_view.copyFromIndexes(source_buffer,indexes,queue);
 }
 
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+/*!
+ * \brief Filtre les indices dont les valeurs partielles sont allouées.
+ *
+ * En retour, \a positions contient la position dans \a matvar_indexes
+ * des indices conservés et \a allocated_indexes les indices correspondants.
+ */
+void MeshMaterialVariable::
+_filterAllocatedIndexes(SmallSpan<const MatVarIndex> matvar_indexes,
+                        Array<Int32>& positions, Array<MatVarIndex>& allocated_indexes) const
+{
+  const Int32 nb_item = matvar_indexes.size();
+  positions.reserve(nb_item);
+  allocated_indexes.reserve(nb_item);
+  for (Int32 i = 0; i < nb_item; ++i) {
+    MatVarIndex mvi = matvar_indexes[i];
+    Int32 array_index = mvi.arrayIndex();
+    if (array_index == 0 || _hasPartialValues(array_index - 1)) {
+      positions.add(i);
+      allocated_indexes.add(mvi);
+    }
+  }
+}
+
 /*---------------------------------------------------------------------------*/
 /*---------------------------------------------------------------------------*/
 
@@ -87,6 +87,12 @@ class ARCANE_MATERIALS_EXPORT MeshMaterialVariable
   void setKeepOnChange(bool v) override;
   bool keepOnChange() const override;
 
+  void setAllocatePartialValuesOnDemand(bool v) override;
+  bool isAllocatePartialValuesOnDemand() const override;
+  void allocatePartialValues(IMeshComponent* component) override;
+  void releasePartialValues(IMeshComponent* component) override;
+  bool hasPartialValues(IMeshComponent* component) const override;
+
   MatVarSpace space() const override;
 
  public:
@@ -155,9 +161,18 @@ class ARCANE_MATERIALS_EXPORT MeshMaterialVariable
   virtual void _initializeNewItems(const ComponentItemListBuilder& list_builder, RunQueue& queue) = 0;
   virtual void _syncReferences(bool update_views) = 0;
   virtual void _resizeForIndexer(Int32 index, RunQueue& queue) = 0;
+  virtual void _defragmentForIndexer(Int32 index, SmallSpan<const Int32> old_partial_indexes,
+                                     RunQueue& queue) = 0;
+  virtual void _allocatePartialValues(Int32 index) = 0;
+  virtual void _releasePartialValues(Int32 index) = 0;
+  virtual bool _hasPartialValues(Int32 index) const = 0;
 
  private:
 
+  Int32 _checkComponentIndex(IMeshComponent* component) const;
+  void _filterAllocatedIndexes(SmallSpan<const MatVarIndex> matvar_indexes,
+                               Array<Int32>& positions, Array<MatVarIndex>& allocated_indexes) const;
+
   static SmallSpan<const Int32> _toInt32Indexes(SmallSpan<const MatVarIndex> indexes);
 };
 
@@ -339,6 +354,7 @@ class ItemMaterialVariableBase
  protected:
 
   void _syncFromGlobalVariable();
+  void _onPartialVariableRead(const IObservable& observable);
   PrivatePartType* _trueGlobalVariable()
   {
     return m_global_variable;
@@ -349,7 +365,12 @@ class ItemMaterialVariableBase
   _fillPartialValuesWithSuperValues(MeshComponentList components);
   ARCANE_MATERIALS_EXPORT void _syncReferences(bool check_resize) override;
   ARCANE_MATERIALS_EXPORT void _resizeForIndexer(Int32 index, RunQueue& queue) override;
+  ARCANE_MATERIALS_EXPORT void _defragmentForIndexer(Int32 index, SmallSpan<const Int32> old_partial_indexes,
+                                                     RunQueue& queue) override;
   ARCANE_MATERIALS_EXPORT void _copyHostViewsToViews(RunQueue* queue);
+  ARCANE_MATERIALS_EXPORT void _allocatePartialValues(Int32 index) override;
+  ARCANE_MATERIALS_EXPORT void _releasePartialValues(Int32 index) override;
+  ARCANE_MATERIALS_EXPORT bool _hasPartialValues(Int32 index) const override;
 
  public:
 
@@ -366,6 +387,9 @@ class ItemMaterialVariableBase
 
  protected:
 
+  //! Indique si les valeurs du tableau d'indice \a array_index sont allouées
+  bool _isAllocated(Int32 array_index) const;
+
   void _setView(Int32 index)
   {
     ContainerViewType view;
@@ -198,12 +198,20 @@ serialize(ISerializer* sbuf,Int32ConstArrayView ids)
   case ISerializer::ModePut:
     {
       UniqueArray<DataType> values;
+      // Pour les composants dont les valeurs ne sont pas allouées,
+      // envoie la valeur globale.
+      auto add_value = [&](MatVarIndex mvi,Int32 local_id){
+        if (!this->_isAllocated(mvi.arrayIndex()))
+          mvi = MatVarIndex(0,local_id);
+        values.addRange(value(mvi));
+      };
       ENUMERATE_ALLENVCELL(iallenvcell,mat_mng,ids_view){
+        Int32 local_id = (*iallenvcell).globalCell().localId();
         ENUMERATE_CELL_ENVCELL(ienvcell,(*iallenvcell)){
-          values.addRange(value(ienvcell._varIndex()));
+          add_value(ienvcell._varIndex(),local_id);
           if (has_mat){
             ENUMERATE_CELL_MATCELL(imatcell,(*ienvcell)){
-              values.addRange(value(imatcell._varIndex()));
+              add_value(imatcell._varIndex(),local_id);
             }
           }
         }
@@ -232,11 +240,15 @@ serialize(ISerializer* sbuf,Int32ConstArrayView ids)
         ENUMERATE_ALLENVCELL(iallenvcell,mat_mng,ids_view){
           ENUMERATE_CELL_ENVCELL(ienvcell,(*iallenvcell)){
             EnvCell envcell = *ienvcell;
-            setValue(ienvcell._varIndex(),data_values[index]);
+            MatVarIndex evi = ienvcell._varIndex();
+            if (this->_isAllocated(evi.arrayIndex()))
+              setValue(evi,data_values[index]);
             ++index;
             if (has_mat){
               ENUMERATE_CELL_MATCELL(imatcell,envcell){
-                setValue(imatcell._varIndex(),data_values[index]);
+                MatVarIndex mvi = imatcell._varIndex();
+                if (this->_isAllocated(mvi.arrayIndex()))
+                  setValue(mvi,data_values[index]);
                 ++index;
               }
             }
@@ -321,7 +333,9 @@ _copyToBufferLegacy(SmallSpan<const MatVarIndex> matvar_indexes,Span<std::byte>
   const Int32 value_size = CheckedConvert::toInt32(bytes.size() / one_data_size);
   Array2View<DataType> values(reinterpret_cast<DataType*>(bytes.data()),value_size,dim2_size);
   for( Integer z=0; z<value_size; ++z ){
-    values[z].copy(value(matvar_indexes[z]));
+    MatVarIndex mvi = matvar_indexes[z];
+    if (this->_isAllocated(mvi.arrayIndex()))
+      values[z].copy(value(mvi));
   }
 }
 
@@ -351,7 +365,9 @@ _copyFromBufferLegacy(SmallSpan<const MatVarIndex> matvar_indexes,Span<const std
   const Integer value_size = CheckedConvert::toInt32(bytes.size() / one_data_size);
   ConstArray2View<DataType> values(reinterpret_cast<const DataType*>(bytes.data()),value_size,dim2_size);
   for( Integer z=0; z<value_size; ++z ){
-    setValue(matvar_indexes[z],values[z]);
+    MatVarIndex mvi = matvar_indexes[z];
+    if (this->_isAllocated(mvi.arrayIndex()))
+      setValue(mvi,values[z]);
   }
 }
 
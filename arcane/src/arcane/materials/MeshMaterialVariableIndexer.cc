@@ -28,6 +28,8 @@
 #include "arcane/accelerator/Reduce.h"
 #include "arcane/accelerator/RunCommandLoop.h"
 
+#include <algorithm>
+
 /*---------------------------------------------------------------------------*/
 /*---------------------------------------------------------------------------*/
 
@@ -260,6 +262,74 @@ endUpdateRemoveV2(ConstituentModifierWorkInfo& work_info, Integer nb_remove, Run
 /*---------------------------------------------------------------------------*/
 /*---------------------------------------------------------------------------*/
 
+MeshMaterialVariableIndexer::FragmentationInfo MeshMaterialVariableIndexer::
+fragmentationInfo() const
+{
+  FragmentationInfo fi;
+  const Int32 nb_item = nbItem();
+  fi.nb_item = nb_item;
+  Int32 nb_partial = 0;
+  for (Int32 i = 0; i < nb_item; ++i) {
+    if (m_matvar_indexes[i].arrayIndex() != 0)
+      ++nb_partial;
+    if (i > 0 && m_local_ids[i] < m_local_ids[i - 1])
+      ++fi.nb_unordered;
+  }
+  fi.nb_partial = nb_partial;
+  fi.nb_hole = math::max(maxIndexInMultipleArray() - nb_partial, 0);
+  return fi;
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+/*!
+ * \brief Défragmente les valeurs partielles.
+ *
+ * Trie les entités suivant leur localId() et renumérote les indices des
+ * valeurs partielles de manière contigüe dans ce nouvel ordre.
+ *
+ * En retour, \a old_partial_indexes contient pour chaque nouvel indice
+ * de valeur partielle l'ancien indice correspondant. Il faut ensuite
+ * permuter les valeurs partielles de chaque variable en conséquence.
+ */
+void MeshMaterialVariableIndexer::
+defragment(Array<Int32>& old_partial_indexes)
+{
+  const Int32 nb_item = nbItem();
+
+  UniqueArray<Int32> new_order(nb_item);
+  for (Int32 i = 0; i < nb_item; ++i)
+    new_order[i] = i;
+  ConstArrayView<Int32> local_ids = m_local_ids;
+  std::stable_sort(new_order.begin(), new_order.end(),
+                   [=](Int32 a, Int32 b) { return local_ids[a] < local_ids[b]; });
+
+  UniqueArray<Int32> new_local_ids(nb_item);
+  UniqueArray<MatVarIndex> new_matvar_indexes(nb_item);
+  old_partial_indexes.clear();
+  Int32 partial_index = 0;
+  for (Int32 i = 0; i < nb_item; ++i) {
+    Int32 old_index = new_order[i];
+    MatVarIndex mvi = m_matvar_indexes[old_index];
+    new_local_ids[i] = m_local_ids[old_index];
+    if (mvi.arrayIndex() != 0) {
+      old_partial_indexes.add(mvi.valueIndex());
+      mvi.setIndex(mvi.arrayIndex(), partial_index);
+      ++partial_index;
+    }
+    new_matvar_indexes[i] = mvi;
+  }
+  m_local_ids.copy(new_local_ids);
+  m_matvar_indexes.copy(new_matvar_indexes);
+  m_max_index_in_multiple_array = partial_index - 1;
+
+  info(4) << "Defragment indexer name=" << name() << " nb_item=" << nb_item
+          << " nb_partial=" << partial_index;
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
 void MeshMaterialVariableIndexer::
 changeLocalIds(Int32ConstArrayView old_to_new_ids)
 {
@@ -331,7 +401,28 @@ _changeLocalIdsV2(MeshMaterialVariableIndexer* var_indexer, Int32ConstArrayView
 void MeshMaterialVariableIndexer::
 transformCellsV2(ConstituentModifierWorkInfo& work_info, RunQueue& queue)
 {
-  _switchBetweenPureAndPartial(work_info, queue, work_info.isAdd());
+  _switchBetweenPureAndPartial(work_info, work_info.pure_local_ids,
+                               work_info.partial_indexes, queue, work_info.isAdd());
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+/*!
+ * \brief Transforme les mailles en utilisant \a pure_local_ids et
+ * \a partial_indexes pour conserver la liste des mailles transformées.
+ *
+ * Cette surcharge permet de transformer plusieurs indexeurs en même temps
+ * (chacun avec ses propres tableaux) car \a work_info n'est alors utilisé
+ * qu'en lecture.
+ */
+void MeshMaterialVariableIndexer::
+transformCellsV2(ConstituentModifierWorkInfo& work_info,
+                 DualUniqueArray<Int32>& pure_local_ids,
+                 DualUniqueArray<Int32>& partial_indexes,
+                 RunQueue& queue)
+{
+  _switchBetweenPureAndPartial(work_info, pure_local_ids, partial_indexes,
+                               queue, work_info.isAdd());
 }
 
 /*---------------------------------------------------------------------------*/
@@ -341,14 +432,16 @@ transformCellsV2(ConstituentModifierWorkInfo& work_info, RunQueue& queue)
  */
 void MeshMaterialVariableIndexer::
 _switchBetweenPureAndPartial(ConstituentModifierWorkInfo& work_info,
+                             DualUniqueArray<Int32>& pure_local_ids_array,
+                             DualUniqueArray<Int32>& partial_indexes_array,
                              RunQueue& queue,
                              bool is_pure_to_partial)
 {
   bool is_device = isAcceleratorPolicy(queue.executionPolicy());
 
   Integer nb = nbItem();
-  auto pure_local_ids_modifier = work_info.pure_local_ids.modifier(is_device);
-  auto partial_indexes_modifier = work_info.partial_indexes.modifier(is_device);
+  auto pure_local_ids_modifier = pure_local_ids_array.modifier(is_device);
+  auto partial_indexes_modifier = partial_indexes_array.modifier(is_device);
   pure_local_ids_modifier.resize(nb);
   partial_indexes_modifier.resize(nb);
 
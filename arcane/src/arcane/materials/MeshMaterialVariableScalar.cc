@@ -163,6 +163,8 @@ ItemMaterialVariableScalar<DataType>::
 fillFromArray(IMeshMaterial* mat,ConstArrayView<DataType> values)
 {
   // TODO: faire une version avec IMeshComponent
+  if (this->isAllocatePartialValuesOnDemand())
+    this->allocatePartialValues(mat);
   Integer index = 0;
   ENUMERATE_COMPONENTITEM(MatCell,imatcell,mat){
     MatCell mc = *imatcell;
@@ -191,6 +193,8 @@ ItemMaterialVariableScalar<DataType>::
 fillFromArray(IMeshMaterial* mat,ConstArrayView<DataType> values,
               Int32ConstArrayView indexes)
 {
+  if (this->isAllocatePartialValuesOnDemand())
+    this->allocatePartialValues(mat);
   ConstArrayView<MatVarIndex> mat_indexes = mat->_internalApi()->variableIndexer()->matvarIndexes();
   Integer nb_index = indexes.size();
   for( Integer i=0; i<nb_index; ++i ){
@@ -292,7 +296,9 @@ _copyToBufferLegacy(SmallSpan<const MatVarIndex> matvar_indexes,Span<std::byte>
   const Integer value_size = arcaneCheckArraySize(bytes.size() / sizeof(DataType));
   ArrayView<DataType> values(value_size,reinterpret_cast<DataType*>(bytes.data()));
   for( Integer z=0; z<value_size; ++z ){
-    values[z] = this->operator[](matvar_indexes[z]);
+    MatVarIndex mvi = matvar_indexes[z];
+    if (this->_isAllocated(mvi.arrayIndex()))
+      values[z] = this->operator[](mvi);
   }
 }
 
@@ -319,7 +325,9 @@ _copyFromBufferLegacy(SmallSpan<const MatVarIndex> matvar_indexes,Span<const std
   const Int32 value_size = CheckedConvert::toInt32(bytes.size() / sizeof(DataType));
   ConstArrayView<DataType> values(value_size,reinterpret_cast<const DataType*>(bytes.data()));
   for( Integer z=0; z<value_size; ++z ){
-    setValue(matvar_indexes[z],values[z]);
+    MatVarIndex mvi = matvar_indexes[z];
+    if (this->_isAllocated(mvi.arrayIndex()))
+      setValue(mvi,values[z]);
   }
 }
 
@@ -451,7 +459,8 @@ _synchronizeV1()
           MatCell mc = *imatcell;
           Cell c = mc.globalCell();
           MatVarIndex mvi = mc._varIndex();
-          var_values[c.localId()] = this->operator[](mvi);
+          if (this->_isAllocated(mvi.arrayIndex()))
+            var_values[c.localId()] = this->operator[](mvi);
         }
       }
       m_global_variable->synchronize();
@@ -462,7 +471,8 @@ _synchronizeV1()
           MatCell mc = *imatcell;
           Cell c = mc.globalCell();
           MatVarIndex mvi = mc._varIndex();
-          setValue(mvi,var_values[c.localId()]);
+          if (this->_isAllocated(mvi.arrayIndex()))
+            setValue(mvi,var_values[c.localId()]);
         }
       }
 
@@ -476,7 +486,8 @@ _synchronizeV1()
         EnvCell ec = *ienvcell;
         Cell c = ec.globalCell();
         MatVarIndex mvi = ec._varIndex();
-        var_values[c.localId()] = this->operator[](mvi);
+        if (this->_isAllocated(mvi.arrayIndex()))
+          var_values[c.localId()] = this->operator[](mvi);
       }
     }
     m_global_variable->synchronize();
@@ -487,7 +498,8 @@ _synchronizeV1()
         EnvCell ec = *ienvcell;
         Cell c = ec.globalCell();
         MatVarIndex mvi = ec._varIndex();
-        setValue(mvi,var_values[c.localId()]);
+        if (this->_isAllocated(mvi.arrayIndex()))
+          setValue(mvi,var_values[c.localId()]);
       }
     }
   }
@@ -553,6 +565,8 @@ _synchronizeV2()
 
   // Recopie les valeurs partielles dans le tableau.
   for( MeshMaterialVariableIndexer* indexer : indexers ){
+    if (!this->_hasPartialValues(indexer->index()))
+      continue;
     ConstArrayView<MatVarIndex> matvar_indexes = indexer->matvarIndexes();
     ConstArrayView<Int32> local_ids = indexer->localIds();
     for( Integer j=0, n=matvar_indexes.size(); j<n; ++j ){
@@ -564,6 +578,8 @@ _synchronizeV2()
 
   // Recopie du tableau synchronisé dans les valeurs partielles.
   for( MeshMaterialVariableIndexer* indexer : indexers ){
+    if (!this->_hasPartialValues(indexer->index()))
+      continue;
     ConstArrayView<MatVarIndex> matvar_indexes = indexer->matvarIndexes();
     ConstArrayView<Int32> local_ids = indexer->localIds();
     for( Integer j=0, n=matvar_indexes.size(); j<n; ++j ){
@@ -634,7 +650,9 @@ _synchronizeV5()
       shared_values[i].resize(total);
       ArrayView<DataType> values(shared_values[i]);
       for( Integer z=0; z<total; ++z ){
-        values[z] = this->operator[](shared_matcells[z]);
+        MatVarIndex mvi = shared_matcells[z];
+        if (this->_isAllocated(mvi.arrayIndex()))
+          values[z] = this->operator[](mvi);
       }
       Integer total_byte = CheckedConvert::multiply(total,data_type_size);
       ByteArrayView bytes(total_byte,(Byte*)(values.unguardedBasePointer()));
@@ -649,10 +667,15 @@ _synchronizeV5()
       Integer total = ghost_matcells.size();
       ConstArrayView<DataType> values(ghost_values[i].constView());
       for( Integer z=0; z<total; ++z ){
-        setValue(ghost_matcells[z],values[z]);
+        MatVarIndex mvi = ghost_matcells[z];
+        if (this->_isAllocated(mvi.arrayIndex()))
+          setValue(mvi,values[z]);
       }
     }
   }
+  // Les valeurs des mailles pures ne sont pas échangées dans ce cas.
+  if (mmvs->isMixedCellsOnly())
+    m_global_variable->synchronize();
 }
 
 /*---------------------------------------------------------------------------*/
@@ -668,9 +691,12 @@ dumpValues(std::ostream& ostr,AllEnvCellVectorView view)
     ostr << "Cell uid=" << ItemPrinter(all_env_cell.globalCell()) << " v=" << value(all_env_cell._varIndex()) << '\n';
     for( CellComponentCellEnumerator ienvcell(all_env_cell); ienvcell.hasNext(); ++ienvcell ){
       MatVarIndex evi = ienvcell._varIndex();
-      ostr << "env_value=" << value(evi) << ", mvi=" << evi << '\n';
+      if (this->_isAllocated(evi.arrayIndex()))
+        ostr << "env_value=" << value(evi) << ", mvi=" << evi << '\n';
       for( CellComponentCellEnumerator imatcell(*ienvcell); imatcell.hasNext(); ++imatcell ){
         MatVarIndex mvi = imatcell._varIndex();
+        if (!this->_isAllocated(mvi.arrayIndex()))
+          continue;
         ostr << "mat_value=" << value(mvi) << ", mvi=" << mvi << '\n';
       }
     }
@@ -729,12 +755,20 @@ serialize(ISerializer* sbuf,Int32ConstArrayView ids)
   case ISerializer::ModePut:
     {
       UniqueArray<DataType> values;
+      // Pour les composants dont les valeurs ne sont pas allouées,
+      // envoie la valeur globale.
+      auto add_value = [&](MatVarIndex mvi,Int32 local_id){
+        if (!this->_isAllocated(mvi.arrayIndex()))
+          mvi = MatVarIndex(0,local_id);
+        values.add(value(mvi));
+      };
       ENUMERATE_ALLENVCELL(iallenvcell,mat_mng,ids_view){
+        Int32 local_id = (*iallenvcell).globalCell().localId();
         ENUMERATE_CELL_ENVCELL(ienvcell,(*iallenvcell)){
-          values.add(value(ienvcell._varIndex()));
+          add_value(ienvcell._varIndex(),local_id);
           if (has_mat){
             ENUMERATE_CELL_MATCELL(imatcell,(*ienvcell)){
-              values.add(value(imatcell._varIndex()));
+              add_value(imatcell._varIndex(),local_id);
             }
           }
         }
@@ -757,11 +791,15 @@ serialize(ISerializer* sbuf,Int32ConstArrayView ids)
       ENUMERATE_ALLENVCELL(iallenvcell,mat_mng,ids_view){
         ENUMERATE_CELL_ENVCELL(ienvcell,(*iallenvcell)){
           EnvCell envcell = *ienvcell;
-          setValue(ienvcell._varIndex(),data_values[index]);
+          MatVarIndex evi = ienvcell._varIndex();
+          if (this->_isAllocated(evi.arrayIndex()))
+            setValue(evi,data_values[index]);
           ++index;
           if (has_mat){
             ENUMERATE_CELL_MATCELL(imatcell,envcell){
-              setValue(imatcell._varIndex(),data_values[index]);
+              MatVarIndex mvi = imatcell._varIndex();
+              if (this->_isAllocated(mvi.arrayIndex()))
+                setValue(mvi,data_values[index]);
               ++index;
             }
           }
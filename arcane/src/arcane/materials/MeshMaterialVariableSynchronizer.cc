@@ -1,11 +1,11 @@
 ﻿// -*- tab-width: 2; indent-tabs-mode: nil; coding: utf-8-with-signature -*-
 //-----------------------------------------------------------------------------
-// Copyright 2000-2023 CEA (www.cea.fr) IFPEN (www.ifpenergiesnouvelles.com)
+// Copyright 2000-2024 CEA (www.cea.fr) IFPEN (www.ifpenergiesnouvelles.com)
 // See the top-level COPYRIGHT file for details.
 // SPDX-License-Identifier: Apache-2.0
 //-----------------------------------------------------------------------------
 /*---------------------------------------------------------------------------*/
-/* MeshMaterialVariableSynchronizer.cc                         (C) 2000-2023 */
+/* MeshMaterialVariableSynchronizer.cc                         (C) 2000-2024 */
 /*                                                                           */
 /* Synchroniseur de variables matériaux.                                     */
 /*---------------------------------------------------------------------------*/
@@ -14,6 +14,7 @@
 #include "arcane/materials/internal/MeshMaterialVariableSynchronizer.h"
 
 #include "arcane/utils/PlatformUtils.h"
+#include "arcane/utils/ValueConvert.h"
 
 #include "arcane/core/IMesh.h"
 #include "arcane/core/IVariableSynchronizer.h"
@@ -87,16 +88,36 @@ ghostItems(Int32 index)
   return m_ghost_items[index];
 }
 
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+void MeshMaterialVariableSynchronizer::
+setMixedCellsOnly(bool v)
+{
+  if (v==m_is_mixed_cells_only)
+    return;
+  m_is_mixed_cells_only = v;
+  // Force le recalcul des listes lors de la prochaine synchronisation.
+  m_timestamp = -1;
+}
+
 /*---------------------------------------------------------------------------*/
 /*---------------------------------------------------------------------------*/
 /*!
  * \brief Remplit \a items avec la liste de tous les MatVarIndex des
  * mailles de \a view.
+ *
+ * Si isMixedCellsOnly() est vrai, seules les valeurs partielles sont
+ * conservées. Les valeurs des mailles pures sont celles de la variable
+ * globale et sont donc transférées par la synchronisation de cette dernière.
  */
 void MeshMaterialVariableSynchronizer::
 _fillCells(Array<MatVarIndex>& items,AllEnvCellVectorView view)
 {
   bool has_mat = m_var_space==MatVarSpace::MaterialAndEnvironment;
+  if (m_is_mixed_cells_only){
+    _fillMixedCells(items,view);
+    return;
+  }
   // NOTE: il est possible d'optimiser en regardant les milieux qui n'ont
   // qu'un seul matériau car dans ce cas la valeur milieu et la valeur
   // matériau est la même. De la même manière, s'il n'y a qu'un milieu
@@ -120,6 +141,38 @@ _fillCells(Array<MatVarIndex>& items,AllEnvCellVectorView view)
   }
 }
 
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+/*!
+ * \brief Remplit \a items avec la liste des MatVarIndex des valeurs
+ * partielles des mailles de \a view.
+ *
+ * Les MatVarIndex dont arrayIndex() vaut 0 correspondent à la valeur
+ * globale et ne sont pas ajoutés.
+ */
+void MeshMaterialVariableSynchronizer::
+_fillMixedCells(Array<MatVarIndex>& items,AllEnvCellVectorView view)
+{
+  bool has_mat = m_var_space==MatVarSpace::MaterialAndEnvironment;
+  items.clear();
+  ENUMERATE_ALLENVCELL(iallenvcell,view){
+    AllEnvCell all_env_cell = *iallenvcell;
+    ENUMERATE_CELL_ENVCELL(ienvcell,all_env_cell){
+      EnvCell env_cell = *ienvcell;
+      MatVarIndex env_mvi = ienvcell._varIndex();
+      if (env_mvi.arrayIndex()!=0)
+        items.add(env_mvi);
+      if (has_mat){
+        ENUMERATE_CELL_MATCELL(imatcell,env_cell){
+          MatVarIndex mat_mvi = imatcell._varIndex();
+          if (mat_mvi.arrayIndex()!=0)
+            items.add(mat_mvi);
+        }
+      }
+    }
+  }
+}
+
 /*---------------------------------------------------------------------------*/
 /*---------------------------------------------------------------------------*/
 
@@ -188,6 +241,16 @@ recompute()
       info(4) << "SIZE GHOST FOR rank=" << ranks[i] << " n=" << items.size();
     }
   }
+  if (m_is_mixed_cells_only){
+    Int64 nb_shared = 0;
+    Int64 nb_ghost = 0;
+    for( Integer i=0; i<nb_rank; ++i ){
+      nb_shared += m_shared_items[i].size();
+      nb_ghost += m_ghost_items[i].size();
+    }
+    info(4) << "MeshMaterialVariableSynchronizer: mixed cells only nb_shared=" << nb_shared
+            << " nb_ghost=" << nb_ghost;
+  }
 }
 
 /*---------------------------------------------------------------------------*/
@@ -202,6 +265,12 @@ _initialize()
     info() << "MeshMaterialVariableSynchronizer: Using device memory for buffer";
   }
   m_common_buffer = impl::makeOneBufferMeshMaterialSynchronizeBufferRef(m_buffer_memory_ressource);
+
+  // N'échange que les valeurs partielles des mailles mixtes.
+  if (auto v = Convert::Type<Int32>::tryParseFromEnvironment("ARCANE_MATSYNCHRONIZE_MIXED_ONLY", true)){
+    m_is_mixed_cells_only = (v.value()!=0);
+    info() << "MeshMaterialVariableSynchronizer: mixed cells only=" << m_is_mixed_cells_only;
+  }
 }
 
 /*---------------------------------------------------------------------------*/
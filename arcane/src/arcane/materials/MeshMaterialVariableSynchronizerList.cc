@@ -1,11 +1,11 @@
 ﻿// -*- tab-width: 2; indent-tabs-mode: nil; coding: utf-8-with-signature -*-
 //-----------------------------------------------------------------------------
-// Copyright 2000-2023 CEA (www.cea.fr) IFPEN (www.ifpenergiesnouvelles.com)
+// Copyright 2000-2024 CEA (www.cea.fr) IFPEN (www.ifpenergiesnouvelles.com)
 // See the top-level COPYRIGHT file for details.
 // SPDX-License-Identifier: Apache-2.0
 //-----------------------------------------------------------------------------
 /*---------------------------------------------------------------------------*/
-/* MeshMaterialVariableSynchronizerList.cc                     (C) 2000-2023 */
+/* MeshMaterialVariableSynchronizerList.cc                     (C) 2000-2024 */
 /*                                                                           */
 /* Synchroniseur de variables matériaux.                                     */
 /*---------------------------------------------------------------------------*/
@@ -21,6 +21,8 @@
 
 #include "arcane/core/IParallelMng.h"
 #include "arcane/core/IVariableSynchronizer.h"
+#include "arcane/core/IVariable.h"
+#include "arcane/core/VariableCollection.h"
 #include "arcane/core/internal/IParallelMngInternal.h"
 #include "arcane/core/materials/IMeshMaterialMng.h"
 #include "arcane/core/materials/internal/IMeshMaterialVariableInternal.h"
@@ -86,6 +88,10 @@ class MeshMaterialVariableSynchronizerList::Impl
   SyncInfo m_mat_env_sync_info;
   SyncInfo m_env_only_sync_info;
   bool m_is_in_sync = false;
+  //! Synchroniseur des variables globales si une synchronisation est en cours
+  IVariableSynchronizer* m_global_var_syncer = nullptr;
+  //! Taille des messages de la synchronisation des variables globales
+  Int64 m_global_message_size = 0;
 };
 
 /*---------------------------------------------------------------------------*/
@@ -169,6 +175,10 @@ _beginSynchronize(bool is_blocking)
   m_p->m_mat_env_sync_info = SyncInfo();
   m_p->m_env_only_sync_info = SyncInfo();
 
+  _beginSynchronizeGlobalVariables();
+  if (is_blocking)
+    _endSynchronizeGlobalVariables();
+
   {
     SyncInfo& sync_info = m_p->m_mat_env_sync_info;
     _fillSyncInfo(sync_info);
@@ -204,6 +214,9 @@ _endSynchronize(bool is_blocking)
   if (!m_p->m_is_in_sync)
     ARCANE_FATAL("beginSynchronize() has to be called before endSynchronize()");
 
+  if (!is_blocking)
+    _endSynchronizeGlobalVariables();
+  m_p->m_total_size += m_p->m_global_message_size;
   {
     SyncInfo& sync_info = m_p->m_mat_env_sync_info;
     if (!sync_info.variables.empty() && !is_blocking)
@@ -239,6 +252,81 @@ add(MeshMaterialVariable* var)
 /*---------------------------------------------------------------------------*/
 /*---------------------------------------------------------------------------*/
 
+/*!
+ * \brief Commence la synchronisation des variables globales si seules
+ * les valeurs des mailles mixtes sont échangées.
+ *
+ * Toutes les variables globales sont synchronisées en une seule fois. La
+ * synchronisation est non bloquante pour que ses messages soient en cours
+ * en même temps que ceux des valeurs partielles. Elle est bloquante si
+ * une synchronisation non bloquante est déjà en cours pour le synchroniseur
+ * des variables globales.
+ */
+void MeshMaterialVariableSynchronizerList::
+_beginSynchronizeGlobalVariables()
+{
+  m_p->m_global_var_syncer = nullptr;
+  m_p->m_global_message_size = 0;
+
+  IMeshMaterialMng* mm = m_p->m_material_mng;
+  IMeshMaterialVariableSynchronizer* mat_env_syncer = mm->_internalApi()->allCellsMatEnvSynchronizer();
+  IMeshMaterialVariableSynchronizer* env_only_syncer = mm->_internalApi()->allCellsEnvOnlySynchronizer();
+  VariableList global_vars;
+  if (mat_env_syncer->isMixedCellsOnly())
+    for (MeshMaterialVariable* v : m_p->m_mat_env_vars)
+      global_vars.add(v->globalVariable());
+  if (env_only_syncer->isMixedCellsOnly())
+    for (MeshMaterialVariable* v : m_p->m_env_only_vars)
+      global_vars.add(v->globalVariable());
+  if (global_vars.empty())
+    return;
+  IVariableSynchronizer* var_syncer = mat_env_syncer->variableSynchronizer();
+  if (!var_syncer->parallelMng()->isParallel())
+    return;
+
+  // Taille des messages envoyés et reçus, calculée comme pour les
+  // valeurs partielles (IMeshMaterialSynchronizeBuffer::totalSize()).
+  Int64 item_data_size = 0;
+  if (mat_env_syncer->isMixedCellsOnly())
+    for (MeshMaterialVariable* v : m_p->m_mat_env_vars)
+      item_data_size += v->dataTypeSize();
+  if (env_only_syncer->isMixedCellsOnly())
+    for (MeshMaterialVariable* v : m_p->m_env_only_vars)
+      item_data_size += v->dataTypeSize();
+  Int64 nb_item = 0;
+  for (Integer i = 0, n = var_syncer->communicatingRanks().size(); i < n; ++i)
+    nb_item += var_syncer->sharedItems(i).size() + var_syncer->ghostItems(i).size();
+  m_p->m_global_message_size = nb_item * item_data_size;
+
+  mm->traceMng()->info(4) << "MAT_SYNCHRONIZE global variables n=" << global_vars.count()
+                          << " message_size=" << m_p->m_global_message_size;
+  if (var_syncer->hasPendingSynchronize()) {
+    var_syncer->synchronize(global_vars);
+    return;
+  }
+  var_syncer->beginSynchronize(global_vars);
+  m_p->m_global_var_syncer = var_syncer;
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+/*!
+ * \brief Termine la synchronisation des variables globales commencée
+ * par _beginSynchronizeGlobalVariables().
+ */
+void MeshMaterialVariableSynchronizerList::
+_endSynchronizeGlobalVariables()
+{
+  IVariableSynchronizer* var_syncer = m_p->m_global_var_syncer;
+  if (!var_syncer)
+    return;
+  m_p->m_global_var_syncer = nullptr;
+  var_syncer->endSynchronize();
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
 void MeshMaterialVariableSynchronizerList::
 _fillSyncInfo(SyncInfo& sync_info)
 {
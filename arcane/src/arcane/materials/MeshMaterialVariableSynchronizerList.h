@@ -1,11 +1,11 @@
 ﻿// -*- tab-width: 2; indent-tabs-mode: nil; coding: utf-8-with-signature -*-
 //-----------------------------------------------------------------------------
-// Copyright 2000-2023 CEA (www.cea.fr) IFPEN (www.ifpenergiesnouvelles.com)
+// Copyright 2000-2024 CEA (www.cea.fr) IFPEN (www.ifpenergiesnouvelles.com)
 // See the top-level COPYRIGHT file for details.
 // SPDX-License-Identifier: Apache-2.0
 //-----------------------------------------------------------------------------
 /*---------------------------------------------------------------------------*/
-/* MeshMaterialVariableSynchronizerList.h                      (C) 2000-2023 */
+/* MeshMaterialVariableSynchronizerList.h                      (C) 2000-2024 */
 /*                                                                           */
 /* Liste de variables à synchroniser.                                        */
 /*---------------------------------------------------------------------------*/
@@ -34,6 +34,14 @@ namespace Arcane::Materials
  * Il faut ensuite appeler apply() pour effectuer la synchronisation.
  *
  * Une instance de ce cette classe peut-être utilisée plusieurs fois.
+ *
+ * Les valeurs de toutes les variables ajoutées sont regroupées dans un
+ * seul message par rang communiquant (un pour les variables matériaux et
+ * un pour les variables milieux). Si le synchroniseur n'échange que les
+ * valeurs des mailles mixtes (IMeshMaterialVariableSynchronizer::isMixedCellsOnly()),
+ * les variables globales associées sont aussi synchronisées en une seule
+ * opération. Les valeurs des mailles pures, qui sont stockées dans la
+ * variable globale, sont ainsi mises à jour sans être envoyées plusieurs fois.
  */
 class ARCANE_MATERIALS_EXPORT MeshMaterialVariableSynchronizerList
 {
@@ -62,7 +70,10 @@ class ARCANE_MATERIALS_EXPORT MeshMaterialVariableSynchronizerList
   //! Ajoute la variable \a var à la liste des variables à synchroniser
   void add(MeshMaterialVariable* var);
 
-  //! Après appel à apply(), contient la taille des messages envoyés
+  /*!
+   * \brief Après appel à apply(), contient la taille des messages envoyés
+   * et reçus, y compris ceux de la synchronisation des variables globales.
+   */
   Int64 totalMessageSize() const;
 
   /*!
@@ -89,6 +100,8 @@ class ARCANE_MATERIALS_EXPORT MeshMaterialVariableSynchronizerList
   static void _beginSynchronizeMultiple2(SyncInfo& sync_info);
   static void _endSynchronizeMultiple2(SyncInfo& sync_info);
   void _fillSyncInfo(SyncInfo& sync_info);
+  void _beginSynchronizeGlobalVariables();
+  void _endSynchronizeGlobalVariables();
   void _beginSynchronize(bool is_blocking);
   void _endSynchronize(bool is_blocking);
 };
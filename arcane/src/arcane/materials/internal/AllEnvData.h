@@ -53,6 +53,7 @@ class AllEnvData
 
   void forceRecompute(bool compute_all);
   void recomputeIncremental();
+  Int32 defragmentPartialValues(Real threshold);
 
  public:
 
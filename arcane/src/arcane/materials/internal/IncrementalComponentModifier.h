@@ -22,6 +22,9 @@
 
 #include "arcane/accelerator/core/RunQueue.h"
 
+#include <memory>
+#include <vector>
+
 /*---------------------------------------------------------------------------*/
 /*---------------------------------------------------------------------------*/
 
@@ -35,6 +38,14 @@ namespace Arcane::Materials
  *
  * Il faut appeler initialize() pour initialiser l'instance puis appeler
  * apply() pour chaque opération.
+ *
+ * Si setUseMultiThread() est activé et que la file n'est pas associée
+ * à un accélérateur, les transformations des indexeurs des différents
+ * constituants et les mises à jour des valeurs de chaque variable sont
+ * effectuées en parallèle par des tâches. Le résultat est identique
+ * à celui de l'exécution séquentielle car chaque tâche ne modifie que
+ * les données d'un indexeur ou d'une variable et que pour une variable
+ * donnée les constituants sont traités dans le même ordre.
  */
 class ARCANE_MATERIALS_EXPORT IncrementalComponentModifier
 : public TraceAccessor
@@ -52,6 +63,20 @@ class ARCANE_MATERIALS_EXPORT IncrementalComponentModifier
   void finalize();
   void setDoCopyBetweenPartialAndPure(bool v) { m_do_copy_between_partial_and_pure = v; }
   void setDoInitNewItems(bool v) { m_do_init_new_items = v; }
+  void setUseMultiThread(bool v) { m_use_multi_thread = v; }
+  //! Indique si le mode multi-thread est actif (valide après initialize())
+  bool isMultiThreadActive() const { return m_is_multi_thread_active; }
+
+ private:
+
+  //! Mailles transformées (pure <-> partielle) pour un indexeur
+  class TransformedCellsInfo
+  {
+   public:
+
+    DualUniqueArray<Int32> pure_local_ids;
+    DualUniqueArray<Int32> partial_indexes;
+  };
 
  private:
 
@@ -61,6 +86,12 @@ class ARCANE_MATERIALS_EXPORT IncrementalComponentModifier
   RunQueue m_queue;
   bool m_do_copy_between_partial_and_pure = true;
   bool m_do_init_new_items = true;
+  bool m_use_multi_thread = false;
+  bool m_is_multi_thread_active = false;
+  //! Files utilisées par les tâches en mode multi-thread (une par bloc)
+  UniqueArray<RunQueue> m_thread_queues;
+  //! Mailles transformées de chaque indexeur en mode multi-thread
+  std::vector<std::unique_ptr<TransformedCellsInfo>> m_transformed_cells_infos;
 
  public:
 
@@ -85,6 +116,16 @@ class ARCANE_MATERIALS_EXPORT IncrementalComponentModifier
                                    SmallSpan<const Int32> local_ids, bool update_env_indexer);
   void _addItemsToEnvironment(MeshEnvironment* env, MeshMaterial* mat,
                               SmallSpan<const Int32> local_ids, bool update_env_indexer);
+
+  void _switchCellsForMaterialsMultiThread(const MeshMaterial* modified_mat,
+                                           SmallSpan<const Int32> ids);
+  void _switchCellsForEnvironmentsMultiThread(const IMeshEnvironment* modified_env,
+                                              SmallSpan<const Int32> ids, bool is_copy);
+  void _transformIndexersMultiThread(ConstArrayView<MeshMaterialVariableIndexer*> indexers,
+                                     Int32 first_info_index);
+  void _copyBetweenPartialsAndGlobalsMultiThread(ConstArrayView<MeshMaterialVariableIndexer*> indexers);
+  UniqueArray<IMeshMaterialVariable*> _materialVariables() const;
+  template <typename Lambda> void _parallelFor(Int32 n, const Lambda& func);
 };
 
 /*---------------------------------------------------------------------------*/
@@ -202,6 +202,7 @@ class MeshMaterialMng
   void checkValid() override;
 
   void forceRecompute() override;
+  void defragmentPartialValues() override;
 
   Mutex* variableLock() override
   {
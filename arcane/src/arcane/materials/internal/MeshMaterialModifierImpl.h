@@ -63,6 +63,12 @@ class MeshMaterialModifierImpl
   void setDoCopyBetweenPartialAndPure(bool v) { m_do_copy_between_partial_and_pure = v; }
   void setDoInitNewItems(bool v) { m_do_init_new_items = v; }
   void setPersistantWorkBuffer(bool v) { m_is_keep_work_buffer = v; }
+  void setUseMultiThread(bool v) { m_use_multi_thread = v; }
+  void setDefragmentThreshold(Real v) { m_defragment_threshold = v; }
+  Real defragmentThreshold() const { return m_defragment_threshold; }
+
+  //! Nombre d'opérations effectuées avec le mode multi-thread
+  Int32 nbOptimizeMultiThread() const { return nb_optimize_multi_thread; }
 
  public:
 
@@ -72,6 +78,7 @@ class MeshMaterialModifierImpl
   void endUpdate();
   void beginUpdate();
   void dumpStats();
+  void defragmentPartialValues(Real threshold);
 
  private:
 
@@ -93,6 +100,9 @@ class MeshMaterialModifierImpl
   Int32 nb_save_restore = 0;
   Int32 nb_optimize_add = 0;
   Int32 nb_optimize_remove = 0;
+  Int32 nb_optimize_multi_thread = 0;
+  Int32 nb_defragment = 0;
+  Int32 nb_defragmented_indexer = 0;
   Int32 m_modification_id = 0;
 
   bool m_allow_optimization = false;
@@ -104,6 +114,9 @@ class MeshMaterialModifierImpl
   bool m_do_copy_between_partial_and_pure = true;
   bool m_do_init_new_items = true;
   bool m_is_keep_work_buffer = true;
+  bool m_use_multi_thread = false;
+  //! Taux de fragmentation à partir duquel les valeurs partielles sont défragmentées (0 si inactif)
+  Real m_defragment_threshold = 0.0;
 
  private:
 
@@ -17,6 +17,7 @@
 #include "arcane/utils/String.h"
 #include "arcane/utils/Array.h"
 #include "arcane/utils/TraceAccessor.h"
+#include "arcane/utils/DualUniqueArray.h"
 
 #include "arcane/core/ItemTypes.h"
 #include "arcane/core/ItemGroup.h"
@@ -58,6 +59,46 @@ class ARCANE_MATERIALS_EXPORT MeshMaterialVariableIndexer
   friend class MeshMaterialMng;
   friend class IncrementalComponentModifier;
   template <typename DataType> friend class ItemMaterialVariableScalar;
+  template <typename Traits> friend class ItemMaterialVariableBase;
+
+ public:
+
+  /*!
+   * \brief Informations sur la fragmentation des valeurs partielles.
+   *
+   * Après des ajouts et suppressions successifs de mailles, les valeurs
+   * partielles contiennent des trous (indices non utilisés) et les
+   * entités ne sont plus rangées suivant leur localId().
+   */
+  class FragmentationInfo
+  {
+   public:
+
+    //! Proportion d'indices non utilisés dans les valeurs partielles
+    Real holeRatio() const
+    {
+      Int32 n = nb_partial + nb_hole;
+      return (n > 0) ? static_cast<Real>(nb_hole) / static_cast<Real>(n) : 0.0;
+    }
+    //! Proportion d'entités non rangées suivant leur localId()
+    Real unorderedRatio() const
+    {
+      return (nb_item > 0) ? static_cast<Real>(nb_unordered) / static_cast<Real>(nb_item) : 0.0;
+    }
+    //! Taux de fragmentation (maximum de holeRatio() et unorderedRatio())
+    Real ratio() const { return math::max(holeRatio(), unorderedRatio()); }
+
+   public:
+
+    //! Nombre d'entités
+    Int32 nb_item = 0;
+    //! Nombre d'entités partielles
+    Int32 nb_partial = 0;
+    //! Nombre d'indices non utilisés dans les valeurs partielles
+    Int32 nb_hole = 0;
+    //! Nombre d'entités dont le localId() est inférieur à celui de l'entité précédente
+    Int32 nb_unordered = 0;
+  };
 
  public:
 
@@ -82,6 +123,8 @@ class ARCANE_MATERIALS_EXPORT MeshMaterialVariableIndexer
   void checkValid();
   //! Vrai si cet indexeur est celui d'un milieu.
   bool isEnvironment() const { return m_is_environment; }
+  //! Calcule les informations sur la fragmentation des valeurs partielles
+  FragmentationInfo fragmentationInfo() const;
 
  public:
 
@@ -102,12 +145,17 @@ class ARCANE_MATERIALS_EXPORT MeshMaterialVariableIndexer
   ConstArrayView<Int32> localIds() const { return m_local_ids; }
 
   void changeLocalIds(Int32ConstArrayView old_to_new_ids);
+  void defragment(Array<Int32>& old_partial_indexes);
   void endUpdateRemove(ConstituentModifierWorkInfo& args, Integer nb_remove, RunQueue& queue);
   //@}
 
  private:
 
   void transformCellsV2(ConstituentModifierWorkInfo& args, RunQueue& queue);
+  void transformCellsV2(ConstituentModifierWorkInfo& args,
+                        DualUniqueArray<Int32>& pure_local_ids,
+                        DualUniqueArray<Int32>& partial_indexes,
+                        RunQueue& queue);
 
  private:
 
@@ -148,6 +196,8 @@ class ARCANE_MATERIALS_EXPORT MeshMaterialVariableIndexer
  public:
 
   void _switchBetweenPureAndPartial(ConstituentModifierWorkInfo& work_info,
+                                    DualUniqueArray<Int32>& pure_local_ids,
+                                    DualUniqueArray<Int32>& partial_indexes,
                                     RunQueue& queue,
                                     bool is_pure_to_partial);
 };
@@ -18,6 +18,7 @@
 #include "arcane/utils/ScopedPtr.h"
 
 #include "arcane/core/VariableDependInfo.h"
+#include "arcane/core/ObserverPool.h"
 #include "arcane/core/materials/internal/IMeshMaterialVariableInternal.h"
 
 #include "arcane/materials/MeshMaterialVariableDependInfo.h"
@@ -84,6 +85,8 @@ class MeshMaterialVariablePrivate
   }
   void syncReferences(bool check_resize) override;
   void resizeForIndexer(Int32 index, RunQueue& queue) override;
+  void defragmentForIndexer(Int32 index, SmallSpan<const Int32> old_partial_indexes,
+                            RunQueue& queue) override;
 
  public:
 
@@ -106,6 +109,15 @@ class MeshMaterialVariablePrivate
   UniqueArray<VariableRef*> m_refs;
 
   bool m_keep_on_change = true;
+  //! Indique si les valeurs partielles sont allouées à la demande
+  bool m_is_allocate_on_demand = false;
+  /*!
+   * \brief Indique pour chaque indexeur si les valeurs partielles ont été
+   * relues lors d'une reprise.
+   */
+  UniqueArray<bool> m_is_partial_values_read;
+  //! Observateurs sur la lecture des valeurs partielles en reprise
+  ObserverPool m_partial_values_read_observers;
   IObserver* m_global_variable_changed_observer = nullptr;
 
   //! Liste des dépendances de cette variable
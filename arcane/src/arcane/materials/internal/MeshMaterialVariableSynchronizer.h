@@ -1,11 +1,11 @@
 ﻿// -*- tab-width: 2; indent-tabs-mode: nil; coding: utf-8-with-signature -*-
 //-----------------------------------------------------------------------------
-// Copyright 2000-2023 CEA (www.cea.fr) IFPEN (www.ifpenergiesnouvelles.com)
+// Copyright 2000-2024 CEA (www.cea.fr) IFPEN (www.ifpenergiesnouvelles.com)
 // See the top-level COPYRIGHT file for details.
 // SPDX-License-Identifier: Apache-2.0
 //-----------------------------------------------------------------------------
 /*---------------------------------------------------------------------------*/
-/* MeshMaterialVariableSynchronizer.h                          (C) 2000-2023 */
+/* MeshMaterialVariableSynchronizer.h                          (C) 2000-2024 */
 /*                                                                           */
 /* Synchroniseur de variables matériaux.                                     */
 /*---------------------------------------------------------------------------*/
@@ -60,6 +60,16 @@ class ARCANE_MATERIALS_EXPORT MeshMaterialVariableSynchronizer
   void checkRecompute() override;
   Ref<IMeshMaterialSynchronizeBuffer> commonBuffer() override { return m_common_buffer; }
   eMemoryRessource bufferMemoryRessource() const override { return m_buffer_memory_ressource; }
+  bool isMixedCellsOnly() const override { return m_is_mixed_cells_only; }
+
+ public:
+
+  /*!
+   * \brief Positionne le mode d'échange des valeurs des mailles mixtes uniquement.
+   *
+   * Le changement est pris en compte lors du prochain appel à checkRecompute().
+   */
+  void setMixedCellsOnly(bool v);
 
  private:
 
@@ -71,10 +81,12 @@ class ARCANE_MATERIALS_EXPORT MeshMaterialVariableSynchronizer
   MatVarSpace m_var_space;
   Ref<IMeshMaterialSynchronizeBuffer> m_common_buffer;
   eMemoryRessource m_buffer_memory_ressource = eMemoryRessource::UnifiedMemory;
+  bool m_is_mixed_cells_only = false;
 
  private:
 
   void _fillCells(Array<MatVarIndex>& items, AllEnvCellVectorView view);
+  void _fillMixedCells(Array<MatVarIndex>& items, AllEnvCellVectorView view);
   void _initialize();
 };
 
@@ -2,6 +2,9 @@ set(ARCANE_SOURCES
   AllCellToAllEnvCellConverter.cc
   AllCellToAllEnvCellConverter.h
   AllEnvData.cc
+  CellCentricMaterialIndex.cc
+  CellCentricMaterialIndex.h
+  CellCentricMaterialVariable.h
   ComponentItemInternal.h
   ComponentItem.h
   ComponentItemListBuilder.cc
@@ -92,6 +92,7 @@
 #include "arcane/mesh/MeshRefinement.h"
 #include "arcane/mesh/FaceReorienter.h"
 #include "arcane/mesh/NewItemOwnerBuilder.h"
+#include "arcane/mesh/SpaceFillingCurveItemSorter.h"
 
 #include "arcane/mesh/IncrementalItemConnectivity.h"
 
@@ -301,6 +302,14 @@ DynamicMesh(ISubDomain* sub_domain,const MeshBuildInfo& mbi, bool is_submesh)
   // de Arcane (juin 2023). A supprimer avant fin 2023.
   if (auto v = Convert::Type<Int32>::tryParseFromEnvironment("ARCANE_NO_SAVE_NEED_COMPACT", true))
     m_do_not_save_need_compact = v.value();
+
+  // Permet de trier les entités suivant une courbe remplissant l'espace
+  // lors des compactages avec tri (valeurs possibles: 'Hilbert' ou 'Morton').
+  {
+    String s = platform::getEnvironmentVariable("ARCANE_MESH_SORT_CURVE");
+    if (!s.null())
+      m_properties->setString("sort-curve",s);
+  }
 }
 
 /*---------------------------------------------------------------------------*/
@@ -332,6 +341,7 @@ DynamicMesh::
   delete m_mesh_refinement;
   delete m_submesh_tools;
   delete m_new_item_owner_builder;
+  delete m_sfc_item_sorter;
 
   // Détruit les familles allouées dynamiquement.
   for( IItemFamily* family : m_item_families ){
@@ -2730,6 +2740,21 @@ _compactItems(bool do_sort,bool compact_variables_and_groups)
   else
     info(4) << "Compress the mesh entities " << name() << ".";
 
+  // Si demandé, calcule les clés pour trier les entités suivant
+  // une courbe remplissant l'espace.
+  bool use_sort_curve = false;
+  if (do_sort && !parentMesh()){
+    String curve_name = m_properties->getStringWithDefault("sort-curve",String());
+    auto curve = SpaceFillingCurveItemSorter::curveFromName(curve_name);
+    if (curve!=SpaceFillingCurveItemSorter::eCurve::None){
+      Timer::Action ts_action(m_sub_domain,"CompactItemComputeSortCurve");
+      if (!m_sfc_item_sorter)
+        m_sfc_item_sorter = new SpaceFillingCurveItemSorter(this);
+      m_sfc_item_sorter->computeSortKeys(curve);
+      use_sort_curve = true;
+    }
+  }
+
   IMeshCompacter* compacter = m_mesh_compact_mng->beginCompact();
 
   try{
@@ -2740,9 +2765,14 @@ _compactItems(bool do_sort,bool compact_variables_and_groups)
   }
   catch(...){
     m_mesh_compact_mng->endCompact();
+    if (use_sort_curve)
+      m_sfc_item_sorter->clearSortKeys();
     throw;
   }
   m_mesh_compact_mng->endCompact();
+  // Les clés ne sont plus valides après le compactage.
+  if (use_sort_curve)
+    m_sfc_item_sorter->clearSortKeys();
 
   if (do_sort){
     Timer::Action ts_action(m_sub_domain,"CompactItemSortReferences");
@@ -73,6 +73,7 @@ class NodeFamily;
 class EdgeFamily;
 class FaceFamily;
 class CellFamily;
+class SpaceFillingCurveItemSorter;
 class DulaNodeFamily;
 //! AMR
 class MeshRefinement;
@@ -599,6 +600,7 @@ public:
   IMeshUniqueIdMng* m_mesh_unique_id_mng = nullptr;
   IMeshExchangeMng* m_mesh_exchange_mng = nullptr;
   IMeshCompactMng* m_mesh_compact_mng = nullptr;
+  SpaceFillingCurveItemSorter* m_sfc_item_sorter = nullptr;
 
 #ifdef ACTIVATE_PERF_COUNTER
   PerfCounterMng<PerfCounter> m_perf_counter;
@@ -1,6 +1,6 @@
 ﻿// -*- tab-width: 2; indent-tabs-mode: nil; coding: utf-8-with-signature -*-
 //-----------------------------------------------------------------------------
-// Copyright 2000-2022 CEA (www.cea.fr) IFPEN (www.ifpenergiesnouvelles.com)
+// Copyright 2000-2024 CEA (www.cea.fr) IFPEN (www.ifpenergiesnouvelles.com)
 // See the top-level COPYRIGHT file for details.
 // SPDX-License-Identifier: Apache-2.0
 //-----------------------------------------------------------------------------
@@ -28,11 +28,13 @@
 #include "arcane/ItemFamilyCompactInfos.h"
 #include "arcane/IMeshCompacter.h"
 #include "arcane/MeshPartInfo.h"
+#include "arcane/Concurrency.h"
 
 #include "arcane/mesh/DynamicMeshKindInfos.h"
 #include "arcane/mesh/ItemFamily.h"
 
 #include <algorithm>
+#include <atomic>
 #include <set>
 
 // #define ARCANE_DEBUG_MESH
@@ -236,17 +238,13 @@ itemsUniqueIdToLocalId(Int32ArrayView local_ids,
   if (!m_has_unique_id_map)
     _badUniqueIdMap();
   if (!arcaneIsCheck()){
-    if (do_fatal){
+    Int64 nb_not_found = _findLocalIds(local_ids,unique_ids);
+    if (do_fatal && nb_not_found!=0){
+      // Génère l'erreur pour la première entité non trouvée.
       for( Integer i=0, s=unique_ids.size(); i<s; ++i ){
         Int64 unique_id = unique_ids[i];
-        local_ids[i] = (unique_id==NULL_ITEM_UNIQUE_ID) ? NULL_ITEM_LOCAL_ID : m_items_map.lookupValue(unique_id)->localId();
-      }
-    }
-    else{
-      for( Integer i=0, s=unique_ids.size(); i<s; ++i ){
-        Int64 unique_id = unique_ids[i];
-        const ItemInternalMap::Data* data = m_items_map.lookup(unique_id);
-        local_ids[i] = (data) ? data->value()->localId() : NULL_ITEM_LOCAL_ID;
+        if (local_ids[i]==NULL_ITEM_LOCAL_ID && unique_id!=NULL_ITEM_UNIQUE_ID)
+          m_items_map.lookupValue(unique_id);
       }
     }
   }
@@ -275,6 +273,57 @@ itemsUniqueIdToLocalId(Int32ArrayView local_ids,
 /*---------------------------------------------------------------------------*/
 /*---------------------------------------------------------------------------*/
 
+void DynamicMeshKindInfos::
+itemsUniqueIdToLocalId(Int32ArrayView local_ids,Int64ConstArrayView unique_ids,
+                       Array<Int32>& not_found_indexes) const
+{
+  if (!m_has_unique_id_map)
+    _badUniqueIdMap();
+  Int64 nb_not_found = _findLocalIds(local_ids,unique_ids);
+  if (nb_not_found==0)
+    return;
+  for( Integer i=0, s=unique_ids.size(); i<s; ++i ){
+    if (local_ids[i]==NULL_ITEM_LOCAL_ID && unique_ids[i]!=NULL_ITEM_UNIQUE_ID)
+      not_found_indexes.add(i);
+  }
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+/*!
+ * \brief Conversion des uniqueId en localId.
+ *
+ * Au delà d'une certaine taille, la conversion est découpée en paquets
+ * traités en concurrence. Les recherches dans la table de hachage
+ * sont en lecture seule et peuvent donc être faites en parallèle.
+ *
+ * Retourne le nombre d'entités non trouvées (y compris celles dont le
+ * uniqueId vaut NULL_ITEM_UNIQUE_ID).
+ */
+Int64 DynamicMeshKindInfos::
+_findLocalIds(Int32ArrayView local_ids,Int64ConstArrayView unique_ids) const
+{
+  const Integer nb_item = unique_ids.size();
+  // En dessous de cette taille, le coût de lancement des tâches est
+  // supérieur au gain.
+  const Integer min_parallel_size = 50000;
+  if (nb_item<min_parallel_size || TaskFactory::nbAllowedThread()<=1)
+    return m_items_map.findLocalIds(unique_ids,local_ids);
+
+  std::atomic<Int64> nb_not_found = 0;
+  ParallelLoopOptions options;
+  options.setGrainSize(min_parallel_size/4);
+  arcaneParallelFor(0,nb_item,options,[&](Integer begin,Integer size){
+    Int64 n = m_items_map.findLocalIds(unique_ids.subView(begin,size),local_ids.subView(begin,size));
+    if (n!=0)
+      nb_not_found += n;
+  });
+  return nb_not_found.load();
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
 void DynamicMeshKindInfos::
 itemsUniqueIdToLocalId(Int32ArrayView local_ids,
                        ConstArrayView<ItemUniqueId> unique_ids,bool do_fatal) const
@@ -1,6 +1,6 @@
 ﻿// -*- tab-width: 2; indent-tabs-mode: nil; coding: utf-8-with-signature -*-
 //-----------------------------------------------------------------------------
-// Copyright 2000-2022 CEA (www.cea.fr) IFPEN (www.ifpenergiesnouvelles.com)
+// Copyright 2000-2024 CEA (www.cea.fr) IFPEN (www.ifpenergiesnouvelles.com)
 // See the top-level COPYRIGHT file for details.
 // SPDX-License-Identifier: Apache-2.0
 //-----------------------------------------------------------------------------
@@ -248,6 +248,9 @@ class ARCANE_MESH_EXPORT DynamicMeshKindInfos
   void itemsUniqueIdToLocalId(Int32ArrayView local_ids,
                               ConstArrayView<ItemUniqueId> unique_ids,
                               bool do_fatal) const;
+  void itemsUniqueIdToLocalId(Int32ArrayView local_ids,
+                              Int64ConstArrayView unique_ids,
+                              Array<Int32>& not_found_indexes) const;
 
   ItemFamily* itemFamily() const
   {
@@ -358,6 +361,7 @@ class ARCANE_MESH_EXPORT DynamicMeshKindInfos
   void _dumpList();
   void _badSameUniqueId(Int64 unique_id) const;
   void _badUniqueIdMap() const;
+  Int64 _findLocalIds(Int32ArrayView local_ids,Int64ConstArrayView unique_ids) const;
   void _updateItemSharedInfoInternalView();
 };
 
@@ -715,6 +715,17 @@ itemsUniqueIdToLocalId(Int32ArrayView local_ids,
 /*---------------------------------------------------------------------------*/
 /*---------------------------------------------------------------------------*/
 
+void ItemFamily::
+itemsUniqueIdToLocalId(Int32ArrayView local_ids,
+                       Int64ConstArrayView unique_ids,
+                       Array<Int32>& not_found_indexes) const
+{
+  m_infos.itemsUniqueIdToLocalId(local_ids,unique_ids,not_found_indexes);
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
 ISubDomain* ItemFamily::
 subDomain() const
 {
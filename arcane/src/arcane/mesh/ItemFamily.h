@@ -1,6 +1,6 @@
 ﻿// -*- tab-width: 2; indent-tabs-mode: nil; coding: utf-8-with-signature -*-
 //-----------------------------------------------------------------------------
-// Copyright 2000-2022 CEA (www.cea.fr) IFPEN (www.ifpenergiesnouvelles.com)
+// Copyright 2000-2024 CEA (www.cea.fr) IFPEN (www.ifpenergiesnouvelles.com)
 // See the top-level COPYRIGHT file for details.
 // SPDX-License-Identifier: Apache-2.0
 //-----------------------------------------------------------------------------
@@ -163,6 +163,9 @@ class ARCANE_MESH_EXPORT ItemFamily
   void itemsUniqueIdToLocalId(Int32ArrayView local_ids,
                               ConstArrayView<ItemUniqueId> unique_ids,
                               bool do_fatal) const override;
+  void itemsUniqueIdToLocalId(Int32ArrayView local_ids,
+                              Int64ConstArrayView unique_ids,
+                              Array<Int32>& not_found_indexes) const override;
 
  public:
 
@@ -1,11 +1,11 @@
 ﻿// -*- tab-width: 2; indent-tabs-mode: nil; coding: utf-8-with-signature -*-
 //-----------------------------------------------------------------------------
-// Copyright 2000-2022 CEA (www.cea.fr) IFPEN (www.ifpenergiesnouvelles.com)
+// Copyright 2000-2024 CEA (www.cea.fr) IFPEN (www.ifpenergiesnouvelles.com)
 // See the top-level COPYRIGHT file for details.
 // SPDX-License-Identifier: Apache-2.0
 //-----------------------------------------------------------------------------
 /*---------------------------------------------------------------------------*/
-/* ItemInternalMap.cc                                          (C) 2000-2021 */
+/* ItemInternalMap.cc                                          (C) 2000-2024 */
 /*                                                                           */
 /* Tableau associatif de ItemInternal.                                       */
 /*---------------------------------------------------------------------------*/
@@ -16,6 +16,7 @@
 #include "arcane/utils/ArrayView.h"
 #include "arcane/utils/Iterator.h"
 #include "arcane/utils/FatalErrorException.h"
+#include "arcane/utils/ValueConvert.h"
 
 #include "arcane/ItemInternal.h"
 
@@ -34,6 +35,236 @@ ItemInternalMap::
 ItemInternalMap()
 : BaseClass(5000,false)
 {
+  if (auto v = Convert::Type<Int32>::tryParseFromEnvironment("ARCANE_ITEMINTERNALMAP_USE_FLAT_INDEX", true))
+    setUseFlatIndex(v.value()!=0);
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+void ItemInternalMap::
+setUseFlatIndex(bool v)
+{
+  if (v==m_use_flat_index)
+    return;
+  m_use_flat_index = v;
+  _rebuildFlatIndex();
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+Int64 ItemInternalMap::
+findLocalIds(Span<const Int64> unique_ids,Span<Int32> local_ids) const
+{
+  Int64 nb_not_found = 0;
+  if (m_use_flat_index){
+    m_flat_index.lookupMany(unique_ids,[&](Int64 i,Data* const* d){
+      if (d)
+        local_ids[i] = (*d)->value()->localId();
+      else{
+        local_ids[i] = NULL_ITEM_LOCAL_ID;
+        ++nb_not_found;
+      }
+    });
+    return nb_not_found;
+  }
+  for( Int64 i=0, n=unique_ids.size(); i<n; ++i ){
+    const Data* d = BaseClass::lookup(unique_ids[i]);
+    if (d)
+      local_ids[i] = d->value()->localId();
+    else{
+      local_ids[i] = NULL_ITEM_LOCAL_ID;
+      ++nb_not_found;
+    }
+  }
+  return nb_not_found;
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+void ItemInternalMap::
+clear()
+{
+  BaseClass::clear();
+  if (m_use_flat_index)
+    m_flat_index.clear();
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+bool ItemInternalMap::
+add(Int64 key,ItemInternal* value)
+{
+  Integer old_nb_bucket = m_nb_bucket;
+  bool is_add = BaseClass::add(key,value);
+  if (is_add && m_use_flat_index)
+    _addToFlatIndex(key,BaseClass::lookup(key),old_nb_bucket);
+  return is_add;
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+void ItemInternalMap::
+remove(Int64 key)
+{
+  BaseClass::remove(key);
+  if (m_use_flat_index)
+    m_flat_index.remove(key);
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+ItemInternalMap::Data* ItemInternalMap::
+lookupAdd(Int64 key,ItemInternal* value,bool& is_add)
+{
+  if (m_use_flat_index){
+    Data* d = _lookup(key);
+    if (d){
+      is_add = false;
+      return d;
+    }
+  }
+  Integer old_nb_bucket = m_nb_bucket;
+  Data* d = BaseClass::lookupAdd(key,value,is_add);
+  if (is_add && m_use_flat_index)
+    _addToFlatIndex(key,d,old_nb_bucket);
+  return d;
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+ItemInternalMap::Data* ItemInternalMap::
+lookupAdd(Int64 key)
+{
+  bool is_add = false;
+  return lookupAdd(key,nullptr,is_add);
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+void ItemInternalMap::
+nocheckAdd(Int64 key,ItemInternal* value)
+{
+  Integer old_nb_bucket = m_nb_bucket;
+  BaseClass::nocheckAdd(key,value);
+  if (m_use_flat_index)
+    _addToFlatIndex(key,BaseClass::lookup(key),old_nb_bucket);
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+void ItemInternalMap::
+resize(Integer new_size,bool use_prime)
+{
+  Integer old_nb_bucket = m_nb_bucket;
+  BaseClass::resize(new_size,use_prime);
+  if (m_use_flat_index){
+    // Une taille nulle vide la table chaînée: il faut aussi vider l'index.
+    if (m_nb_bucket==0){
+      m_flat_index.clear();
+      return;
+    }
+    m_flat_index.reserve(new_size);
+    if (old_nb_bucket!=m_nb_bucket)
+      _updateFlatIndex();
+  }
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+void ItemInternalMap::
+rehash()
+{
+  BaseClass::rehash();
+  _rebuildFlatIndex();
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+ItemInternalMap::Data* ItemInternalMap::
+_lookupValue(Int64 key) const
+{
+  Data* d = _lookup(key);
+  if (!d){
+    // Génère l'exception de la classe de base.
+    const BaseClass& base = *this;
+    base.lookupValue(key);
+    ARCANE_FATAL("Can not find key '{0}'",key);
+  }
+  return d;
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+/*!
+ * \brief Ajoute \a d à l'index.
+ *
+ * Si le nombre de buckets de la table chaînée a changé, les instances
+ * de Data ont été réallouées et il faut mettre à jour les pointeurs de
+ * l'index. Comme le nombre de buckets croît géométriquement, cela
+ * n'arrive qu'un nombre logarithmique de fois.
+ */
+void ItemInternalMap::
+_addToFlatIndex(Int64 key,Data* d,Integer old_nb_bucket)
+{
+  if (old_nb_bucket!=m_nb_bucket)
+    _updateFlatIndex();
+  else
+    m_flat_index.add(key,d);
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+/*!
+ * \brief Met à jour l'index après réallocation des instances de Data.
+ *
+ * Les clés n'ont pas changé : on se contente de remplacer sur place
+ * les pointeurs sans réallouer l'index. Les clés absentes de l'index
+ * (par exemple celle qui vient d'être ajoutée) y sont ajoutées.
+ */
+void ItemInternalMap::
+_updateFlatIndex()
+{
+  m_flat_index.reserve(count());
+  for( Data* bucket : buckets() )
+    for( Data* d = bucket; d; d = d->next() ){
+      Data** v = m_flat_index.lookup(d->key());
+      if (v)
+        *v = d;
+      else
+        m_flat_index.add(d->key(),d);
+    }
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+/*!
+ * \brief Reconstruit l'index (après changement des clés).
+ *
+ * La capacité de l'index est conservée.
+ */
+void ItemInternalMap::
+_rebuildFlatIndex()
+{
+  if (!m_use_flat_index){
+    m_flat_index = impl::Int64OpenAddressingHashMapT<Data*>();
+    return;
+  }
+  m_flat_index.clear();
+  m_flat_index.reserve(count());
+  for( Data* bucket : buckets() )
+    for( Data* d = bucket; d; d = d->next() )
+      m_flat_index.add(d->key(),d);
 }
 
 /*---------------------------------------------------------------------------*/
@@ -1,11 +1,11 @@
 ﻿// -*- tab-width: 2; indent-tabs-mode: nil; coding: utf-8-with-signature -*-
 //-----------------------------------------------------------------------------
-// Copyright 2000-2023 CEA (www.cea.fr) IFPEN (www.ifpenergiesnouvelles.com)
+// Copyright 2000-2024 CEA (www.cea.fr) IFPEN (www.ifpenergiesnouvelles.com)
 // See the top-level COPYRIGHT file for details.
 // SPDX-License-Identifier: Apache-2.0
 //-----------------------------------------------------------------------------
 /*---------------------------------------------------------------------------*/
-/* ItemInternalMap.h                                           (C) 2000-2023 */
+/* ItemInternalMap.h                                           (C) 2000-2024 */
 /*                                                                           */
 /* Tableau associatif de ItemInternal.                                       */
 /*---------------------------------------------------------------------------*/
@@ -15,6 +15,7 @@
 /*---------------------------------------------------------------------------*/
 
 #include "arcane/utils/HashTableMap.h"
+#include "arcane/utils/internal/Int64OpenAddressingHashMap.h"
 
 #include "arcane/mesh/MeshGlobal.h"
 
@@ -40,16 +41,101 @@ namespace Arcane::mesh
  * La clé de ce tableau associatif est le UniqueId des entités.
  * S'il change, il faut appeler notifyUniqueIdsChanged() pour remettre
  * à jour le tableau associatif.
+ *
+ * Il est possible d'ajouter à la table chaînée un index à adressage ouvert
+ * (impl::Int64OpenAddressingHashMapT) qui est alors utilisé pour les
+ * recherches. Cet index est activé si la variable d'environnement
+ * ARCANE_ITEMINTERNALMAP_USE_FLAT_INDEX vaut 1 ou via setUseFlatIndex().
+ * Il est maintenu à jour par les méthodes de cette classe. Les
+ * modifications de clé effectuées directement via les instances de
+ * \a Data doivent être suivies d'un appel à rehash().
+ *
+ * L'index conserve un pointeur vers chaque instance de \a Data de la table
+ * chaînée et occupe donc environ 16 octets supplémentaires par entité
+ * (plus le taux de remplissage maximal de 7/8).
+ *
+ * Pour garantir que l'index reste cohérent, la classe de base est privée
+ * et seules les méthodes qui ne modifient pas la table sont accessibles
+ * directement.
  */
 class ItemInternalMap
-: public HashTableMapT<Int64,ItemInternal*>
+: private HashTableMapT<Int64,ItemInternal*>
 {
  private:
+
   typedef HashTableMapT<Int64,ItemInternal*> BaseClass;
+
+ public:
+
+  using BaseClass::Data;
+  using BaseClass::count;
+  using BaseClass::buckets;
+  using BaseClass::each;
+  using BaseClass::eachValue;
+
  public:
+
   ItemInternalMap();
+  ItemInternalMap(const ItemInternalMap&) = delete;
+  ItemInternalMap& operator=(const ItemInternalMap&) = delete;
+
  public:
+
   void notifyUniqueIdsChanged();
+
+  //! Indique si l'index à adressage ouvert est utilisé
+  bool isUseFlatIndex() const { return m_use_flat_index; }
+
+  //! Active ou désactive l'index à adressage ouvert
+  void setUseFlatIndex(bool v);
+
+  /*!
+   * \brief Conversion des uniqueId() \a unique_ids en localId() \a local_ids.
+   *
+   * Les entités non trouvées ont pour localId() NULL_ITEM_LOCAL_ID.
+   * Retourne le nombre d'entités non trouvées.
+   */
+  Int64 findLocalIds(Span<const Int64> unique_ids, Span<Int32> local_ids) const;
+
+ public:
+
+  // Méthodes de HashTableMapT qui maintiennent l'index.
+
+  bool hasKey(Int64 key) { return _lookup(key) != nullptr; }
+  void clear();
+  Data* lookup(Int64 key) { return _lookup(key); }
+  const Data* lookup(Int64 key) const { return _lookup(key); }
+  ItemInternal*& lookupValue(Int64 key) { return _lookupValue(key)->value(); }
+  ItemInternal* const& lookupValue(Int64 key) const { return _lookupValue(key)->value(); }
+  ItemInternal*& operator[](Int64 key) { return lookupValue(key); }
+  ItemInternal* const& operator[](Int64 key) const { return lookupValue(key); }
+  bool add(Int64 key, ItemInternal* value);
+  void remove(Int64 key);
+  Data* lookupAdd(Int64 key, ItemInternal* value, bool& is_add);
+  Data* lookupAdd(Int64 key);
+  void nocheckAdd(Int64 key, ItemInternal* value);
+  void resize(Integer new_size, bool use_prime = false);
+  void rehash();
+
+ private:
+
+  bool m_use_flat_index = false;
+  impl::Int64OpenAddressingHashMapT<Data*> m_flat_index;
+
+ private:
+
+  Data* _lookup(Int64 key) const
+  {
+    if (m_use_flat_index) {
+      Data* const* d = m_flat_index.lookup(key);
+      return (d) ? *d : nullptr;
+    }
+    return const_cast<Data*>(BaseClass::lookup(key));
+  }
+  Data* _lookupValue(Int64 key) const;
+  void _addToFlatIndex(Int64 key, Data* d, Integer old_nb_bucket);
+  void _updateFlatIndex();
+  void _rebuildFlatIndex();
 };
 
 /*---------------------------------------------------------------------------*/
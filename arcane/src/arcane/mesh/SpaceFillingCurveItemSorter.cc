@@ -0,0 +1,319 @@
+﻿// -*- tab-width: 2; indent-tabs-mode: nil; coding: utf-8-with-signature -*-
+//-----------------------------------------------------------------------------
+// Copyright 2000-2024 CEA (www.cea.fr) IFPEN (www.ifpenergiesnouvelles.com)
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: Apache-2.0
+//-----------------------------------------------------------------------------
+/*---------------------------------------------------------------------------*/
+/* SpaceFillingCurveItemSorter.cc                              (C) 2000-2024 */
+/*                                                                           */
+/* Tri des entités du maillage suivant une courbe remplissant l'espace.      */
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+#include "arcane/mesh/SpaceFillingCurveItemSorter.h"
+
+#include "arcane/utils/ArgumentException.h"
+#include "arcane/utils/Real3.h"
+#include "arcane/utils/PlatformUtils.h"
+
+#include "arcane/core/IMesh.h"
+#include "arcane/core/IItemFamily.h"
+#include "arcane/core/Item.h"
+#include "arcane/core/ItemGroup.h"
+#include "arcane/core/ItemInternal.h"
+#include "arcane/core/MeshVariableScalarRef.h"
+#include "arcane/core/VariableTypes.h"
+
+#include <algorithm>
+#include <limits>
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+namespace Arcane::mesh
+{
+
+namespace
+{
+  //! Nombre de bits par dimension pour les coordonnées entières
+  constexpr Int32 NB_BIT_PER_DIM = 21;
+} // namespace
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+SpaceFillingCurveItemSortFunction::
+SpaceFillingCurveItemSortFunction()
+: m_name("ArcaneSpaceFillingCurve")
+{
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+void SpaceFillingCurveItemSortFunction::
+sortItems(ItemInternalMutableArrayView items)
+{
+  const Int64 nb_key = m_keys.largeSize();
+  Int64ConstArrayView keys = m_keys.constView();
+  auto get_key = [&](const ItemInternal* item) -> Int64 {
+    Int32 lid = item->localId();
+    Int64 k = (lid >= 0 && lid < nb_key) ? keys[lid] : -1;
+    return (k >= 0) ? k : std::numeric_limits<Int64>::max();
+  };
+  auto compare = [&](const ItemInternal* item1, const ItemInternal* item2) {
+    // Il faut mettre les entités détruites en fin de liste
+    bool s1 = item1->isSuppressed();
+    bool s2 = item2->isSuppressed();
+    if (s1 != s2)
+      return s2;
+    if (!s1) {
+      Int64 k1 = get_key(item1);
+      Int64 k2 = get_key(item2);
+      if (k1 != k2)
+        return k1 < k2;
+    }
+    return item1->uniqueId() < item2->uniqueId();
+  };
+  std::sort(std::begin(items), std::end(items), compare);
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+SpaceFillingCurveItemSorter::
+SpaceFillingCurveItemSorter(IMesh* mesh)
+: TraceAccessor(mesh->traceMng())
+, m_mesh(mesh)
+{
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+SpaceFillingCurveItemSorter::eCurve SpaceFillingCurveItemSorter::
+curveFromName(const String& name)
+{
+  if (name.empty() || name == "None")
+    return eCurve::None;
+  if (name == "Hilbert")
+    return eCurve::Hilbert;
+  if (name == "Morton")
+    return eCurve::Morton;
+  ARCANE_THROW(ArgumentException, "Bad value '{0}' for space filling curve. Valid values are 'Hilbert', 'Morton' or 'None'", name);
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+/*!
+ * \brief Indice sur la courbe de Hilbert.
+ *
+ * Utilise l'algorithme de J. Skilling ("Programming the Hilbert curve",
+ * AIP Conference Proceedings 707, 2004) qui transforme les coordonnées en
+ * la représentation transposée de l'indice de Hilbert. Les bits de cette
+ * représentation sont ensuite entrelacés.
+ */
+Int64 SpaceFillingCurveItemSorter::
+hilbertIndex(UInt32 x, UInt32 y, UInt32 z)
+{
+  UInt32 v[3] = { x, y, z };
+  const UInt32 m = 1U << (NB_BIT_PER_DIM - 1);
+
+  // Annule les inversions
+  for (UInt32 q = m; q > 1; q >>= 1) {
+    UInt32 p = q - 1;
+    for (int i = 0; i < 3; ++i) {
+      if (v[i] & q)
+        v[0] ^= p;
+      else {
+        UInt32 t = (v[0] ^ v[i]) & p;
+        v[0] ^= t;
+        v[i] ^= t;
+      }
+    }
+  }
+
+  // Code de Gray
+  v[1] ^= v[0];
+  v[2] ^= v[1];
+  UInt32 t = 0;
+  for (UInt32 q = m; q > 1; q >>= 1)
+    if (v[2] & q)
+      t ^= q - 1;
+  for (int i = 0; i < 3; ++i)
+    v[i] ^= t;
+
+  UInt64 h = 0;
+  for (int b = NB_BIT_PER_DIM - 1; b >= 0; --b)
+    for (int i = 0; i < 3; ++i)
+      h = (h << 1) | ((v[i] >> b) & 1);
+  return static_cast<Int64>(h);
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+Int64 SpaceFillingCurveItemSorter::
+mortonIndex(UInt32 x, UInt32 y, UInt32 z)
+{
+  UInt32 v[3] = { x, y, z };
+  UInt64 h = 0;
+  for (int b = NB_BIT_PER_DIM - 1; b >= 0; --b)
+    for (int i = 0; i < 3; ++i)
+      h = (h << 1) | ((v[i] >> b) & 1);
+  return static_cast<Int64>(h);
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+/*!
+ * \brief Retourne la fonction de tri de \a family.
+ *
+ * Si \a install est vrai et que la famille utilise le tri par défaut, le
+ * remplace par une instance de SpaceFillingCurveItemSortFunction.
+ * Retourne \a nullptr si la famille utilise une autre fonction de tri.
+ */
+SpaceFillingCurveItemSortFunction* SpaceFillingCurveItemSorter::
+_sortFunction(IItemFamily* family, bool install)
+{
+  IItemInternalSortFunction* sf = family->itemSortFunction();
+  auto* sfc_sf = dynamic_cast<SpaceFillingCurveItemSortFunction*>(sf);
+  if (!sfc_sf && install && sf && sf->name() == "ArcaneUniqueId") {
+    sfc_sf = new SpaceFillingCurveItemSortFunction();
+    family->setItemSortFunction(sfc_sf);
+  }
+  return sfc_sf;
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+void SpaceFillingCurveItemSorter::
+computeSortKeys(eCurve curve)
+{
+  if (curve == eCurve::None)
+    return;
+
+  IItemFamily* cell_family = m_mesh->cellFamily();
+  IItemFamily* face_family = m_mesh->faceFamily();
+  IItemFamily* edge_family = m_mesh->edgeFamily();
+  IItemFamily* node_family = m_mesh->nodeFamily();
+
+  Real time_begin = platform::getRealTime();
+  VariableNodeReal3& nodes_coord(m_mesh->nodesCoordinates());
+
+  // Calcule la boîte englobante des noeuds (y compris les noeuds fantômes)
+  const Real max_real = std::numeric_limits<Real>::max();
+  Real3 min_box(max_real, max_real, max_real);
+  Real3 max_box(-max_real, -max_real, -max_real);
+  ENUMERATE_ (Node, inode, node_family->allItems()) {
+    Real3 c = nodes_coord[inode];
+    min_box = math::min(min_box, c);
+    max_box = math::max(max_box, c);
+  }
+  // Utilise la même échelle pour toutes les directions pour conserver
+  // les proportions du maillage.
+  Real3 box_size = max_box - min_box;
+  Real max_size = math::max(box_size.x, math::max(box_size.y, box_size.z));
+  const Real max_coord = static_cast<Real>((1 << NB_BIT_PER_DIM) - 1);
+  const Real scale = (max_size > 0.0) ? (max_coord / max_size) : 0.0;
+  auto to_int = [&](Real v) -> UInt32 {
+    Real x = (v * scale);
+    x = math::min(math::max(x, 0.0), max_coord);
+    return static_cast<UInt32>(x);
+  };
+
+  // Calcule l'indice sur la courbe du centre de chaque maille.
+  struct CellKey
+  {
+    Int64 key;
+    Int64 uid;
+    Int32 lid;
+  };
+  UniqueArray<CellKey> cell_keys;
+  cell_keys.reserve(cell_family->nbItem());
+  ENUMERATE_ (Cell, icell, cell_family->allItems()) {
+    Cell cell = *icell;
+    Real3 center;
+    Int32 nb_node = cell.nbNode();
+    for (Node node : cell.nodes())
+      center += nodes_coord[node];
+    if (nb_node > 0)
+      center /= static_cast<Real>(nb_node);
+    center -= min_box;
+    UInt32 x = to_int(center.x);
+    UInt32 y = to_int(center.y);
+    UInt32 z = to_int(center.z);
+    Int64 key = (curve == eCurve::Hilbert) ? hilbertIndex(x, y, z) : mortonIndex(x, y, z);
+    cell_keys.add(CellKey{ key, cell.uniqueId().asInt64(), cell.localId() });
+  }
+  std::sort(cell_keys.begin(), cell_keys.end(), [](const CellKey& a, const CellKey& b) {
+    if (a.key != b.key)
+      return a.key < b.key;
+    return a.uid < b.uid;
+  });
+
+  // Les clés des mailles sont leur rang dans le tri. Les noeuds, arêtes et
+  // faces sont numérotés dans l'ordre de leur première apparition lors
+  // du parcours des mailles triées.
+  UniqueArray<Int64> cell_ranks(cell_family->maxLocalId(), -1);
+  UniqueArray<Int64> node_ranks(node_family->maxLocalId(), -1);
+  UniqueArray<Int64> edge_ranks(edge_family->maxLocalId(), -1);
+  UniqueArray<Int64> face_ranks(face_family->maxLocalId(), -1);
+  Int64 node_rank = 0;
+  Int64 edge_rank = 0;
+  Int64 face_rank = 0;
+  CellInfoListView cells(cell_family);
+  for (Int64 i = 0, n = cell_keys.largeSize(); i < n; ++i) {
+    Int32 lid = cell_keys[i].lid;
+    cell_ranks[lid] = i;
+    Cell cell = cells[lid];
+    for (NodeLocalId node : cell.nodeIds())
+      if (node_ranks[node] < 0)
+        node_ranks[node] = node_rank++;
+    for (EdgeLocalId edge : cell.edgeIds())
+      if (edge_ranks[edge] < 0)
+        edge_ranks[edge] = edge_rank++;
+    for (FaceLocalId face : cell.faceIds())
+      if (face_ranks[face] < 0)
+        face_ranks[face] = face_rank++;
+  }
+
+  auto set_keys = [&](IItemFamily* family, UniqueArray<Int64>& keys) {
+    SpaceFillingCurveItemSortFunction* sf = _sortFunction(family, true);
+    if (sf)
+      sf->setKeys(std::move(keys));
+  };
+  set_keys(cell_family, cell_ranks);
+  set_keys(node_family, node_ranks);
+  set_keys(edge_family, edge_ranks);
+  set_keys(face_family, face_ranks);
+
+  Real time_end = platform::getRealTime();
+  info(4) << "SpaceFillingCurveItemSorter: computed sort keys curve=" << (int)curve
+          << " nb_cell=" << cell_keys.largeSize() << " time=" << (time_end - time_begin);
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+void SpaceFillingCurveItemSorter::
+clearSortKeys()
+{
+  IItemFamily* families[4] = { m_mesh->nodeFamily(), m_mesh->edgeFamily(),
+                               m_mesh->faceFamily(), m_mesh->cellFamily() };
+  for (IItemFamily* family : families) {
+    SpaceFillingCurveItemSortFunction* sf = _sortFunction(family, false);
+    if (sf)
+      sf->clearKeys();
+  }
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+} // End namespace Arcane::mesh
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
@@ -0,0 +1,152 @@
+﻿// -*- tab-width: 2; indent-tabs-mode: nil; coding: utf-8-with-signature -*-
+//-----------------------------------------------------------------------------
+// Copyright 2000-2024 CEA (www.cea.fr) IFPEN (www.ifpenergiesnouvelles.com)
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: Apache-2.0
+//-----------------------------------------------------------------------------
+/*---------------------------------------------------------------------------*/
+/* SpaceFillingCurveItemSorter.h                               (C) 2000-2024 */
+/*                                                                           */
+/* Tri des entités du maillage suivant une courbe remplissant l'espace.      */
+/*---------------------------------------------------------------------------*/
+#ifndef ARCANE_MESH_SPACEFILLINGCURVEITEMSORTER_H
+#define ARCANE_MESH_SPACEFILLINGCURVEITEMSORTER_H
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+#include "arcane/utils/TraceAccessor.h"
+#include "arcane/utils/Array.h"
+#include "arcane/utils/String.h"
+
+#include "arcane/core/ItemTypes.h"
+#include "arcane/core/IItemInternalSortFunction.h"
+
+#include "arcane/mesh/MeshGlobal.h"
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+namespace Arcane::mesh
+{
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+/*!
+ * \brief Fonction de tri des entités suivant une clé associée à leur localId().
+ *
+ * Les entités sont triées suivant la clé positionnée par setKeys() puis
+ * suivant leur uniqueId(). Les entités sans clé (clé négative) sont placées
+ * après celles qui en ont une. Comme pour le tri par défaut, les entités
+ * détruites sont placées en fin de liste.
+ *
+ * Si aucune clé n'est positionnée, le tri est le même que le tri par défaut
+ * (suivant le uniqueId()).
+ */
+class ARCANE_MESH_EXPORT SpaceFillingCurveItemSortFunction
+: public IItemInternalSortFunction
+{
+ public:
+
+  SpaceFillingCurveItemSortFunction();
+
+ public:
+
+  const String& name() const override { return m_name; }
+  void sortItems(ItemInternalMutableArrayView items) override;
+
+ public:
+
+  //! Positionne les clés de tri. \a keys est indexé par le localId() des entités.
+  void setKeys(UniqueArray<Int64>&& keys) { m_keys = std::move(keys); }
+  //! Supprime les clés de tri
+  void clearKeys() { m_keys.clear(); }
+
+ private:
+
+  String m_name;
+  UniqueArray<Int64> m_keys;
+};
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+/*!
+ * \brief Tri des entités d'un maillage suivant une courbe remplissant l'espace.
+ *
+ * Les mailles sont ordonnées suivant la position de leur centre sur une
+ * courbe de Hilbert ou de Morton calculée à partir des coordonnées des noeuds.
+ * Les noeuds, arêtes et faces sont ensuite ordonnés dans l'ordre de leur
+ * première apparition lors du parcours des mailles triées. Cela permet
+ * d'améliorer la localité mémoire des accès aux entités connectées dans
+ * les boucles sur les mailles.
+ *
+ * Cette classe calcule uniquement les clés de tri. Les localId() sont
+ * modifiés lors du compactage avec tri du maillage par l'intermédiaire de
+ * SpaceFillingCurveItemSortFunction. Les uniqueId() ne sont pas modifiés.
+ */
+class ARCANE_MESH_EXPORT SpaceFillingCurveItemSorter
+: public TraceAccessor
+{
+ public:
+
+  //! Type de courbe
+  enum class eCurve
+  {
+    None,
+    Morton,
+    Hilbert
+  };
+
+ public:
+
+  explicit SpaceFillingCurveItemSorter(IMesh* mesh);
+
+ public:
+
+  /*!
+   * \brief Convertit \a name en type de courbe.
+   *
+   * Les valeurs valides sont 'Hilbert', 'Morton' et 'None' (ou une chaîne
+   * vide). Lève une exception si \a name n'est pas valide.
+   */
+  static eCurve curveFromName(const String& name);
+
+  /*!
+   * \brief Calcule les clés de tri pour la courbe \a curve.
+   *
+   * Les fonctions de tri des familles de noeuds, d'arêtes, de faces et
+   * de mailles sont remplacées par SpaceFillingCurveItemSortFunction si
+   * elles utilisent le tri par défaut. Les familles ayant une fonction de
+   * tri spécifique ne sont pas modifiées.
+   *
+   * Cette méthode doit être appelée juste avant un compactage avec tri.
+   */
+  void computeSortKeys(eCurve curve);
+
+  //! Supprime les clés calculées par computeSortKeys().
+  void clearSortKeys();
+
+ public:
+
+  //! Indice sur la courbe de Hilbert 3D du point de coordonnées entières (\a x, \a y, \a z) sur 21 bits
+  static Int64 hilbertIndex(UInt32 x, UInt32 y, UInt32 z);
+  //! Indice sur la courbe de Morton 3D du point de coordonnées entières (\a x, \a y, \a z) sur 21 bits
+  static Int64 mortonIndex(UInt32 x, UInt32 y, UInt32 z);
+
+ private:
+
+  IMesh* m_mesh = nullptr;
+
+ private:
+
+  SpaceFillingCurveItemSortFunction* _sortFunction(IItemFamily* family, bool install);
+};
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+} // End namespace Arcane::mesh
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+#endif
@@ -140,6 +140,8 @@ set( ARCANE_SOURCES
   ParallelAMRConsistency.h
   SubMeshTools.cc
   SubMeshTools.h
+  SpaceFillingCurveItemSorter.cc
+  SpaceFillingCurveItemSorter.h
   ItemFamilyNetwork.cc
   ItemFamilyNetwork.h
   ItemFamilySerializer.cc
@@ -0,0 +1,177 @@
+﻿// -*- tab-width: 2; indent-tabs-mode: nil; coding: utf-8-with-signature -*-
+//-----------------------------------------------------------------------------
+// Copyright 2000-2024 CEA (www.cea.fr) IFPEN (www.ifpenergiesnouvelles.com)
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: Apache-2.0
+//-----------------------------------------------------------------------------
+
+#include <gtest/gtest.h>
+
+#include "arcane/utils/Array.h"
+
+#include "arcane/mesh/SpaceFillingCurveItemSorter.h"
+
+#include <algorithm>
+#include <cstdlib>
+#include <iostream>
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+using namespace Arcane;
+using namespace Arcane::mesh;
+
+namespace
+{
+using CurveFunc = Int64 (*)(UInt32, UInt32, UInt32);
+
+//! Numéro de la maille (x,y,z) d'une grille de \a n mailles par direction
+Int32 _cellIndex(Int32 n, Int32 x, Int32 y, Int32 z)
+{
+  return (x * n + y) * n + z;
+}
+
+/*!
+ * \brief Calcule pour chaque indice de la courbe la maille associée.
+ *
+ * Vérifie que la courbe est une bijection entre les mailles d'une grille de
+ * 2^nb_bit mailles par direction et les indices [0,8^nb_bit[.
+ */
+UniqueArray<Int32> _computeCurveCells(CurveFunc func, Int32 nb_bit)
+{
+  const Int32 n = 1 << nb_bit;
+  const Int32 nb_cell = n * n * n;
+  UniqueArray<Int32> cells(nb_cell, -1);
+  for (Int32 x = 0; x < n; ++x)
+    for (Int32 y = 0; y < n; ++y)
+      for (Int32 z = 0; z < n; ++z) {
+        Int64 index = func(x, y, z);
+        EXPECT_TRUE(index >= 0 && index < nb_cell) << "Bad index " << index << " x=" << x << " y=" << y << " z=" << z;
+        if (index < 0 || index >= nb_cell)
+          continue;
+        EXPECT_EQ(cells[index], -1) << "Duplicated index " << index;
+        cells[index] = _cellIndex(n, x, y, z);
+      }
+  return cells;
+}
+
+//! Distance de Manhattan entre deux mailles
+Int32 _distance(Int32 n, Int32 c1, Int32 c2)
+{
+  Int32 dx = std::abs(c1 / (n * n) - c2 / (n * n));
+  Int32 dy = std::abs((c1 / n) % n - (c2 / n) % n);
+  Int32 dz = std::abs(c1 % n - c2 % n);
+  return dx + dy + dz;
+}
+
+/*!
+ * \brief Découpe la grille en \a nb_part parties de même taille suivant
+ * l'ordre \a sorted_cells et retourne le nombre de faces entre deux parties.
+ */
+Int32 _computeCut(Int32 n, ConstArrayView<Int32> sorted_cells, Int32 nb_part)
+{
+  const Int32 nb_cell = sorted_cells.size();
+  UniqueArray<Int32> parts(nb_cell);
+  UniqueArray<Int32> part_sizes(nb_part, 0);
+  for (Int32 i = 0; i < nb_cell; ++i) {
+    Int32 part = static_cast<Int32>((static_cast<Int64>(i) * nb_part) / nb_cell);
+    parts[sorted_cells[i]] = part;
+    ++part_sizes[part];
+  }
+  auto [min_size, max_size] = std::minmax_element(part_sizes.begin(), part_sizes.end());
+  EXPECT_LE(*max_size - *min_size, 1) << "Unbalanced partition nb_part=" << nb_part;
+
+  Int32 nb_cut = 0;
+  for (Int32 x = 0; x < n; ++x)
+    for (Int32 y = 0; y < n; ++y)
+      for (Int32 z = 0; z < n; ++z) {
+        Int32 p = parts[_cellIndex(n, x, y, z)];
+        if (x + 1 < n && p != parts[_cellIndex(n, x + 1, y, z)])
+          ++nb_cut;
+        if (y + 1 < n && p != parts[_cellIndex(n, x, y + 1, z)])
+          ++nb_cut;
+        if (z + 1 < n && p != parts[_cellIndex(n, x, y, z + 1)])
+          ++nb_cut;
+      }
+  return nb_cut;
+}
+} // namespace
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+TEST(TestSpaceFillingCurve, Hilbert)
+{
+  for (Int32 nb_bit = 1; nb_bit <= 4; ++nb_bit) {
+    const Int32 n = 1 << nb_bit;
+    UniqueArray<Int32> cells = _computeCurveCells(&SpaceFillingCurveItemSorter::hilbertIndex, nb_bit);
+    ASSERT_EQ(cells[0], 0) << "The curve has to start at the origin";
+    // Deux indices consécutifs correspondent à deux mailles voisines.
+    for (Int32 i = 0, nb_cell = cells.size(); (i + 1) < nb_cell; ++i)
+      ASSERT_EQ(_distance(n, cells[i], cells[i + 1]), 1) << "Non adjacent cells nb_bit=" << nb_bit << " index=" << i;
+  }
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+TEST(TestSpaceFillingCurve, Morton)
+{
+  ASSERT_EQ(SpaceFillingCurveItemSorter::mortonIndex(0, 0, 0), 0);
+  ASSERT_EQ(SpaceFillingCurveItemSorter::mortonIndex(0, 0, 1), 1);
+  ASSERT_EQ(SpaceFillingCurveItemSorter::mortonIndex(0, 1, 0), 2);
+  ASSERT_EQ(SpaceFillingCurveItemSorter::mortonIndex(1, 0, 0), 4);
+  ASSERT_EQ(SpaceFillingCurveItemSorter::mortonIndex(1, 1, 1), 7);
+  for (Int32 nb_bit = 1; nb_bit <= 4; ++nb_bit) {
+    const Int32 n = 1 << nb_bit;
+    UniqueArray<Int32> cells = _computeCurveCells(&SpaceFillingCurveItemSorter::mortonIndex, nb_bit);
+    // Chaque bloc aligné de 2x2x2 mailles correspond à 8 indices consécutifs.
+    for (Int32 i = 0, nb_cell = cells.size(); i < nb_cell; i += 8) {
+      Int32 c0 = cells[i];
+      for (Int32 j = 1; j < 8; ++j) {
+        Int32 c = cells[i + j];
+        ASSERT_EQ(c / (n * n) / 2, c0 / (n * n) / 2);
+        ASSERT_EQ((c / n) % n / 2, (c0 / n) % n / 2);
+        ASSERT_EQ(c % n / 2, c0 % n / 2);
+      }
+    }
+  }
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+/*!
+ * \brief Vérifie qu'un découpage de la courbe en parties de même taille
+ * donne des parties équilibrées et compactes.
+ *
+ * Le nombre de faces entre les parties doit être inférieur à celui obtenu
+ * avec l'ordre lexicographique et avec 8 parties on doit obtenir 8 cubes.
+ */
+TEST(TestSpaceFillingCurve, PartitionBalance)
+{
+  const Int32 nb_bit = 4;
+  const Int32 n = 1 << nb_bit;
+  const Int32 nb_cell = n * n * n;
+  UniqueArray<Int32> lexicographic_cells(nb_cell);
+  for (Int32 i = 0; i < nb_cell; ++i)
+    lexicographic_cells[i] = i;
+  UniqueArray<Int32> hilbert_cells = _computeCurveCells(&SpaceFillingCurveItemSorter::hilbertIndex, nb_bit);
+  UniqueArray<Int32> morton_cells = _computeCurveCells(&SpaceFillingCurveItemSorter::mortonIndex, nb_bit);
+
+  for (Int32 nb_part : { 6, 7, 8, 12 }) {
+    Int32 lexicographic_cut = _computeCut(n, lexicographic_cells, nb_part);
+    Int32 hilbert_cut = _computeCut(n, hilbert_cells, nb_part);
+    Int32 morton_cut = _computeCut(n, morton_cells, nb_part);
+    std::cout << "nb_part=" << nb_part << " cut: lexicographic=" << lexicographic_cut
+              << " hilbert=" << hilbert_cut << " morton=" << morton_cut << "\n";
+    ASSERT_LT(hilbert_cut, lexicographic_cut) << "nb_part=" << nb_part;
+    ASSERT_LT(morton_cut, lexicographic_cut) << "nb_part=" << nb_part;
+    if (nb_part == 8) {
+      ASSERT_EQ(hilbert_cut, 3 * n * n);
+      ASSERT_EQ(morton_cut, 3 * n * n);
+    }
+  }
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
@@ -81,6 +81,13 @@ extern "C++" Ref<IDataSynchronizeImplementationFactory>
 arcaneCreateMpiDirectSendrecvVariableSynchronizerFactory(MpiParallelMng* mpi_pm);
 extern "C++" Ref<IDataSynchronizeImplementationFactory>
 arcaneCreateMpiLegacyVariableSynchronizerFactory(MpiParallelMng* mpi_pm);
+// Défini dans MpiPersistentVariableSynchronizeDispatcher
+extern "C++" Ref<IDataSynchronizeImplementationFactory>
+arcaneCreateMpiPersistentVariableSynchronizerFactory(MpiParallelMng* mpi_pm,
+                                                     Ref<IVariableSynchronizerMpiCommunicator> synchronizer_communicator,
+                                                     bool use_neighbor_collective);
+extern "C++" bool
+arcaneHasMpiPersistentNeighborCollective();
 
 /*---------------------------------------------------------------------------*/
 /*---------------------------------------------------------------------------*/
@@ -265,6 +272,13 @@ class MpiParallelMngUtilsFactory
     }
     if (platform::getEnvironmentVariable("ARCANE_SYNCHRONIZE_VERSION")=="5")
       m_synchronizer_version = 5;
+    if (platform::getEnvironmentVariable("ARCANE_SYNCHRONIZE_VERSION")=="6"){
+      m_synchronizer_version = 6;
+      // Par défaut, utilise MPI_Neighbor_alltoallv_init() si disponible.
+      m_use_persistent_neighbor = arcaneHasMpiPersistentNeighborCollective();
+      if (platform::getEnvironmentVariable("ARCANE_SYNCHRONIZE_PERSISTENT_NEIGHBOR")=="0")
+        m_use_persistent_neighbor = false;
+    }
   }
  public:
 
@@ -315,6 +329,12 @@ class MpiParallelMngUtilsFactory
       throw NotSupportedException(A_FUNCINFO,"Synchronize implementation V5 is not supported with this version of MPI");
 #endif
     }
+    else if (m_synchronizer_version == 6){
+      if (do_print)
+        tm->info() << "Using MpiSynchronizer V6 (persistent requests) use_neighbor_collective=" << m_use_persistent_neighbor;
+      topology_info = createRef<VariableSynchronizerMpiCommunicator>(mpi_pm);
+      generic_factory = arcaneCreateMpiPersistentVariableSynchronizerFactory(mpi_pm,topology_info,m_use_persistent_neighbor);
+    }
     else{
       if (do_print)
         tm->info() << "Using MpiSynchronizer V1";
@@ -330,6 +350,7 @@ class MpiParallelMngUtilsFactory
   Integer m_synchronizer_version = 1;
   Int32 m_synchronize_block_size = 32000;
   Int32 m_synchronize_nb_sequence = 1;
+  bool m_use_persistent_neighbor = false;
 };
 
 /*---------------------------------------------------------------------------*/
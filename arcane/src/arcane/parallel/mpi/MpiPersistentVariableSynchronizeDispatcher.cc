@@ -0,0 +1,404 @@
+﻿// -*- tab-width: 2; indent-tabs-mode: nil; coding: utf-8-with-signature -*-
+//-----------------------------------------------------------------------------
+// Copyright 2000-2024 CEA (www.cea.fr) IFPEN (www.ifpenergiesnouvelles.com)
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: Apache-2.0
+//-----------------------------------------------------------------------------
+/*---------------------------------------------------------------------------*/
+/* MpiPersistentVariableSynchronizeDispatcher.cc               (C) 2000-2024 */
+/*                                                                           */
+/* Synchronisations des variables via des requêtes MPI persistantes.         */
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+#include "arcane/utils/FatalErrorException.h"
+#include "arcane/utils/NotSupportedException.h"
+#include "arcane/utils/CheckedConvert.h"
+#include "arcane/utils/MemoryView.h"
+
+#include "arcane/parallel/mpi/MpiParallelMng.h"
+#include "arcane/parallel/mpi/MpiAdapter.h"
+#include "arcane/parallel/mpi/MpiTimeInterval.h"
+#include "arcane/parallel/mpi/IVariableSynchronizerMpiCommunicator.h"
+#include "arcane/parallel/IStat.h"
+
+#include "arcane/impl/IDataSynchronizeBuffer.h"
+#include "arcane/impl/IDataSynchronizeImplementation.h"
+
+#include <algorithm>
+#include <memory>
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+/*
+ * Cette implémentation crée une seule fois les requêtes MPI pour un
+ * ensemble de buffers donnés et se contente ensuite d'appeler MPI_Startall()
+ * et MPI_Waitall() à chaque synchronisation.
+ *
+ * Si la version de MPI est au moins la 4.0, on utilise la collective
+ * persistante MPI_Neighbor_alltoallv_init() sur le communicateur de la
+ * topologie. Sinon, on utilise des requêtes point à point persistantes
+ * (MPI_Send_init() et MPI_Recv_init()). Dans les deux cas, le communicateur
+ * utilisé est celui créé par IVariableSynchronizerMpiCommunicator ce qui
+ * garantit que les messages ne peuvent pas être confondus avec ceux d'un
+ * autre synchroniseur.
+ *
+ * Les requêtes dépendent des adresses et des tailles des buffers. Comme
+ * ces derniers sont conservés entre deux synchronisations, on garde
+ * un petit nombre de jeux de requêtes (un par type de donnée synchronisé
+ * en pratique) et on les recrée uniquement si les buffers changent.
+ */
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+namespace Arcane
+{
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+/*!
+ * \brief Implémentation de la synchronisation via des requêtes MPI persistantes.
+ */
+class MpiPersistentVariableSynchronizerDispatcher
+: public AbstractDataSynchronizeImplementation
+{
+ public:
+
+  class Factory;
+  class PersistentRequest;
+  explicit MpiPersistentVariableSynchronizerDispatcher(Factory* f);
+  ~MpiPersistentVariableSynchronizerDispatcher() override;
+
+ public:
+
+  void compute() override;
+  void beginSynchronize(IDataSynchronizeBuffer* buf) override;
+  void endSynchronize(IDataSynchronizeBuffer* buf) override;
+
+ private:
+
+  //! Nombre maximum de jeux de requêtes conservés
+  static constexpr Int32 MAX_NB_PERSISTENT_REQUEST = 4;
+
+  MpiParallelMng* m_mpi_parallel_mng = nullptr;
+  Ref<IVariableSynchronizerMpiCommunicator> m_synchronizer_communicator;
+  bool m_use_neighbor_collective = false;
+  //! Jeux de requêtes, le plus récemment utilisé en premier
+  std::vector<std::unique_ptr<PersistentRequest>> m_requests;
+  PersistentRequest* m_current_request = nullptr;
+
+ private:
+
+  PersistentRequest* _findOrCreateRequest(IDataSynchronizeBuffer* buf);
+};
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+/*!
+ * \brief Jeu de requêtes persistantes associé à un ensemble de buffers.
+ */
+class MpiPersistentVariableSynchronizerDispatcher::PersistentRequest
+{
+ public:
+
+  PersistentRequest(IDataSynchronizeBuffer* buf, MPI_Comm comm, bool use_neighbor)
+  {
+    _computeSignature(buf, m_signature);
+    const MPI_Datatype mpi_dt = MP::Mpi::MpiBuiltIn::datatype(Byte());
+    const Int32 nb_message = buf->nbRank();
+    if (use_neighbor) {
+#if defined(ARCANE_HAS_MPI_NEIGHBOR) && defined(MPI_VERSION) && (MPI_VERSION >= 4)
+      if (!buf->hasGlobalBuffer())
+        ARCANE_THROW(NotSupportedException, "Can not use MPI_Neighbor_alltoallv_init when hasGlobalBufer() is false");
+      // Les tableaux ne doivent pas être modifiés tant que la requête existe.
+      // Certaines versions de MPI n'acceptent pas de tableaux vides.
+      Int32 size = (nb_message == 0) ? 1 : nb_message;
+      m_send_counts.resize(size);
+      m_receive_counts.resize(size);
+      m_send_displacements.resize(size);
+      m_receive_displacements.resize(size);
+      m_send_counts.fill(0);
+      m_receive_counts.fill(0);
+      m_send_displacements.fill(0);
+      m_receive_displacements.fill(0);
+      for (Int32 i = 0; i < nb_message; ++i) {
+        m_send_counts[i] = CheckedConvert::toInt32(buf->sendBuffer(i).bytes().size());
+        m_receive_counts[i] = CheckedConvert::toInt32(buf->receiveBuffer(i).bytes().size());
+        m_send_displacements[i] = CheckedConvert::toInt32(buf->sendDisplacement(i));
+        m_receive_displacements[i] = CheckedConvert::toInt32(buf->receiveDisplacement(i));
+      }
+      m_requests.resize(1);
+      auto send_buf = buf->globalSendBuffer();
+      auto receive_buf = buf->globalReceiveBuffer();
+      int r = MPI_Neighbor_alltoallv_init(send_buf.data(), m_send_counts.data(), m_send_displacements.data(), mpi_dt,
+                                          receive_buf.data(), m_receive_counts.data(), m_receive_displacements.data(), mpi_dt,
+                                          comm, MPI_INFO_NULL, &m_requests[0]);
+      if (r != MPI_SUCCESS)
+        ARCANE_FATAL("Error '{0}' in MPI_Neighbor_alltoallv_init", r);
+      return;
+#else
+      ARCANE_FATAL("MPI_Neighbor_alltoallv_init() is not available with this version of MPI");
+#endif
+    }
+
+    constexpr int sync_tag = 525;
+    m_requests.resize(nb_message * 2);
+    for (Int32 i = 0; i < nb_message; ++i) {
+      Int32 target_rank = buf->targetRank(i);
+      auto rbuf = buf->receiveBuffer(i).bytes();
+      int r = MPI_Recv_init(rbuf.data(), CheckedConvert::toInt32(rbuf.size()), mpi_dt, target_rank,
+                            sync_tag, comm, &m_requests[i]);
+      if (r != MPI_SUCCESS)
+        ARCANE_FATAL("Error '{0}' in MPI_Recv_init", r);
+    }
+    for (Int32 i = 0; i < nb_message; ++i) {
+      Int32 target_rank = buf->targetRank(i);
+      auto sbuf = buf->sendBuffer(i).bytes();
+      int r = MPI_Send_init(sbuf.data(), CheckedConvert::toInt32(sbuf.size()), mpi_dt, target_rank,
+                            sync_tag, comm, &m_requests[nb_message + i]);
+      if (r != MPI_SUCCESS)
+        ARCANE_FATAL("Error '{0}' in MPI_Send_init", r);
+    }
+  }
+
+  ~PersistentRequest()
+  {
+    for (MPI_Request& r : m_requests)
+      if (r != MPI_REQUEST_NULL)
+        MPI_Request_free(&r);
+  }
+
+ public:
+
+  //! Indique si les requêtes correspondent aux buffers de \a buf
+  bool isMatching(IDataSynchronizeBuffer* buf, UniqueArray<Int64>& work_signature) const
+  {
+    _computeSignature(buf, work_signature);
+    return work_signature == m_signature;
+  }
+
+  void start()
+  {
+    if (!m_requests.empty())
+      MPI_Startall(m_requests.size(), m_requests.data());
+  }
+
+  void wait()
+  {
+    if (!m_requests.empty())
+      MPI_Waitall(m_requests.size(), m_requests.data(), MPI_STATUSES_IGNORE);
+  }
+
+ private:
+
+  UniqueArray<Int64> m_signature;
+  UniqueArray<MPI_Request> m_requests;
+  UniqueArray<int> m_send_counts;
+  UniqueArray<int> m_receive_counts;
+  UniqueArray<int> m_send_displacements;
+  UniqueArray<int> m_receive_displacements;
+
+ private:
+
+  //! Calcule les valeurs (adresses et tailles) dont dépendent les requêtes
+  static void _computeSignature(IDataSynchronizeBuffer* buf, UniqueArray<Int64>& signature)
+  {
+    const Int32 nb_message = buf->nbRank();
+    signature.clear();
+    signature.reserve(1 + 4 * nb_message);
+    signature.add(nb_message);
+    for (Int32 i = 0; i < nb_message; ++i) {
+      auto sbuf = buf->sendBuffer(i).bytes();
+      auto rbuf = buf->receiveBuffer(i).bytes();
+      signature.add(reinterpret_cast<Int64>(sbuf.data()));
+      signature.add(sbuf.size());
+      signature.add(reinterpret_cast<Int64>(rbuf.data()));
+      signature.add(rbuf.size());
+    }
+  }
+};
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+class MpiPersistentVariableSynchronizerDispatcher::Factory
+: public IDataSynchronizeImplementationFactory
+{
+ public:
+
+  Factory(MpiParallelMng* mpi_pm, Ref<IVariableSynchronizerMpiCommunicator> synchronizer_communicator,
+          bool use_neighbor_collective)
+  : m_mpi_parallel_mng(mpi_pm)
+  , m_synchronizer_communicator(synchronizer_communicator)
+  , m_use_neighbor_collective(use_neighbor_collective)
+  {}
+
+  Ref<IDataSynchronizeImplementation> createInstance() override
+  {
+    auto* x = new MpiPersistentVariableSynchronizerDispatcher(this);
+    return makeRef<IDataSynchronizeImplementation>(x);
+  }
+
+ public:
+
+  MpiParallelMng* m_mpi_parallel_mng = nullptr;
+  Ref<IVariableSynchronizerMpiCommunicator> m_synchronizer_communicator;
+  bool m_use_neighbor_collective = false;
+};
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+/*!
+ * \brief Indique si MPI_Neighbor_alltoallv_init() est disponible.
+ */
+extern "C++" bool
+arcaneHasMpiPersistentNeighborCollective()
+{
+#if defined(ARCANE_HAS_MPI_NEIGHBOR) && defined(MPI_VERSION) && (MPI_VERSION >= 4)
+  return true;
+#else
+  return false;
+#endif
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+extern "C++" Ref<IDataSynchronizeImplementationFactory>
+arcaneCreateMpiPersistentVariableSynchronizerFactory(MpiParallelMng* mpi_pm,
+                                                     Ref<IVariableSynchronizerMpiCommunicator> sync_communicator,
+                                                     bool use_neighbor_collective)
+{
+  if (use_neighbor_collective && !arcaneHasMpiPersistentNeighborCollective())
+    ARCANE_FATAL("MPI_Neighbor_alltoallv_init() is not available with this version of MPI");
+  auto* x = new MpiPersistentVariableSynchronizerDispatcher::Factory(mpi_pm, sync_communicator, use_neighbor_collective);
+  return makeRef<IDataSynchronizeImplementationFactory>(x);
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+MpiPersistentVariableSynchronizerDispatcher::
+MpiPersistentVariableSynchronizerDispatcher(Factory* f)
+: m_mpi_parallel_mng(f->m_mpi_parallel_mng)
+, m_synchronizer_communicator(f->m_synchronizer_communicator)
+, m_use_neighbor_collective(f->m_use_neighbor_collective)
+{
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+MpiPersistentVariableSynchronizerDispatcher::
+~MpiPersistentVariableSynchronizerDispatcher()
+{
+  // Les requêtes doivent être libérées avant le communicateur.
+  m_requests.clear();
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+/*!
+ * \brief Libère les requêtes existantes.
+ *
+ * Cette méthode est appelée lorsque les informations de synchronisation
+ * changent et avant que le communicateur de la topologie ne soit recalculé.
+ */
+void MpiPersistentVariableSynchronizerDispatcher::
+compute()
+{
+  if (m_current_request)
+    ARCANE_FATAL("Can not call compute() during a synchronization");
+  m_requests.clear();
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+MpiPersistentVariableSynchronizerDispatcher::PersistentRequest*
+MpiPersistentVariableSynchronizerDispatcher::
+_findOrCreateRequest(IDataSynchronizeBuffer* buf)
+{
+  UniqueArray<Int64> signature;
+  const Int32 nb_request = static_cast<Int32>(m_requests.size());
+  for (Int32 i = 0; i < nb_request; ++i) {
+    if (m_requests[i]->isMatching(buf, signature)) {
+      // Place en tête la requête trouvée.
+      if (i != 0)
+        std::rotate(m_requests.begin(), m_requests.begin() + i, m_requests.begin() + i + 1);
+      return m_requests[0].get();
+    }
+  }
+
+  auto* sync_communicator = m_synchronizer_communicator.get();
+  ARCANE_CHECK_POINTER(sync_communicator);
+  MPI_Comm communicator = sync_communicator->communicator();
+  if (communicator == MPI_COMM_NULL)
+    ARCANE_FATAL("Invalid null communicator");
+
+  if (nb_request >= MAX_NB_PERSISTENT_REQUEST)
+    m_requests.pop_back();
+  m_requests.insert(m_requests.begin(), std::make_unique<PersistentRequest>(buf, communicator, m_use_neighbor_collective));
+  m_mpi_parallel_mng->stat()->add("SyncPersistentCreate", 0.0, 1);
+  return m_requests[0].get();
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+void MpiPersistentVariableSynchronizerDispatcher::
+beginSynchronize(IDataSynchronizeBuffer* buf)
+{
+  if (m_current_request)
+    ARCANE_FATAL("beginSynchronize() has already been called");
+
+  double send_copy_time = 0.0;
+  {
+    MpiTimeInterval tit(&send_copy_time);
+    buf->copyAllSend();
+  }
+
+  m_current_request = _findOrCreateRequest(buf);
+  m_current_request->start();
+
+  Int64 total_share_size = buf->totalSendSize();
+  m_mpi_parallel_mng->stat()->add("SyncSendCopy", send_copy_time, total_share_size);
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+void MpiPersistentVariableSynchronizerDispatcher::
+endSynchronize(IDataSynchronizeBuffer* buf)
+{
+  if (!m_current_request)
+    ARCANE_FATAL("No pending synchronize(). You need to call beginSynchronize() before");
+
+  double copy_time = 0.0;
+  double wait_time = 0.0;
+  {
+    MpiTimeInterval tit(&wait_time);
+    m_current_request->wait();
+  }
+  m_current_request = nullptr;
+
+  {
+    MpiTimeInterval tit(&copy_time);
+    buf->copyAllReceive();
+  }
+
+  Int64 total_ghost_size = buf->totalReceiveSize();
+  Int64 total_share_size = buf->totalSendSize();
+  Int64 total_size = total_ghost_size + total_share_size;
+  MpiParallelMng* pm = m_mpi_parallel_mng;
+  pm->stat()->add("SyncCopy", copy_time, total_ghost_size);
+  pm->stat()->add("SyncWait", wait_time, total_size);
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+} // End namespace Arcane
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
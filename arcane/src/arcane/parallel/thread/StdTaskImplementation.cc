@@ -0,0 +1,1393 @@
+﻿// -*- tab-width: 2; indent-tabs-mode: nil; coding: utf-8-with-signature -*-
+//-----------------------------------------------------------------------------
+// Copyright 2000-2024 CEA (www.cea.fr) IFPEN (www.ifpenergiesnouvelles.com)
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: Apache-2.0
+//-----------------------------------------------------------------------------
+/*---------------------------------------------------------------------------*/
+/* StdTaskImplementation.cc                                    (C) 2000-2024 */
+/*                                                                           */
+/* Implémentation des tâches utilisant std::thread et le vol de tâches.      */
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+#include "arcane/utils/ConcurrencyUtils.h"
+#include "arcane/utils/NotImplementedException.h"
+#include "arcane/utils/FatalErrorException.h"
+#include "arcane/utils/ForLoopRanges.h"
+#include "arcane/utils/IObservable.h"
+#include "arcane/utils/IProcessorAffinityService.h"
+#include "arcane/utils/PlatformUtils.h"
+#include "arcane/utils/Profiling.h"
+#include "arcane/utils/ValueConvert.h"
+
+#include "arcane/FactoryService.h"
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <condition_variable>
+#include <exception>
+#include <functional>
+#include <iostream>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+namespace Arcane
+{
+
+namespace
+{
+
+// Positif si on récupère les statistiques d'exécution
+bool isStatActive()
+{
+  return ProfilingRegistry::hasProfiling();
+}
+
+/*!
+ * \brief Classe permettant de garantir qu'on enregistre les statistiques
+ * d'exécution même en cas d'exception.
+ */
+class ScopedExecInfo
+{
+ public:
+
+  explicit ScopedExecInfo(const ForLoopRunInfo& run_info)
+  : m_run_info(run_info)
+  {
+    ForLoopOneExecStat* ptr = run_info.execStat();
+    if (ptr) {
+      m_stat_info_ptr = ptr;
+      m_use_own_run_info = false;
+    }
+    else
+      m_stat_info_ptr = isStatActive() ? &m_stat_info : nullptr;
+  }
+  ~ScopedExecInfo()
+  {
+    if (m_stat_info_ptr && m_use_own_run_info)
+      ProfilingRegistry::_threadLocalForLoopInstance()->merge(*m_stat_info_ptr, m_run_info.traceInfo());
+  }
+
+ public:
+
+  ForLoopOneExecStat* statInfo() const { return m_stat_info_ptr; }
+  bool isOwn() const { return m_use_own_run_info; }
+
+ private:
+
+  ForLoopOneExecStat m_stat_info;
+  ForLoopOneExecStat* m_stat_info_ptr = nullptr;
+  ForLoopRunInfo m_run_info;
+  //! Indique si on utilise m_stat_info
+  bool m_use_own_run_info = true;
+};
+
+} // namespace
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+namespace StdTask
+{
+class Worker;
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+/*!
+ * \brief Groupe de travaux dont on attend la fin.
+ *
+ * Conserve aussi la première exception levée par un des travaux
+ * pour la relancer dans le thread qui attend le groupe.
+ */
+class JobGroup
+{
+ public:
+
+  void add() { m_nb_pending.fetch_add(1, std::memory_order_relaxed); }
+  void done() { m_nb_pending.fetch_sub(1, std::memory_order_release); }
+  bool isDone() const { return m_nb_pending.load(std::memory_order_acquire) == 0; }
+
+  void setException(std::exception_ptr e)
+  {
+    std::scoped_lock sl(m_exception_mutex);
+    if (!m_exception)
+      m_exception = e;
+  }
+  void rethrowIfNeeded()
+  {
+    if (m_exception)
+      std::rethrow_exception(m_exception);
+  }
+
+ private:
+
+  std::atomic<Int64> m_nb_pending = 0;
+  std::mutex m_exception_mutex;
+  std::exception_ptr m_exception;
+};
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+/*!
+ * \brief Travail élémentaire pouvant être volé par un autre thread.
+ *
+ * Les instances sont allouées par new et détruites après leur exécution.
+ */
+class Job
+{
+ public:
+
+  explicit Job(JobGroup* group)
+  : m_group(group)
+  {}
+  virtual ~Job() = default;
+
+ public:
+
+  virtual void execute(Worker& w) = 0;
+  JobGroup* group() const { return m_group; }
+
+ private:
+
+  JobGroup* m_group = nullptr;
+};
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+/*!
+ * \brief File double de travaux de Chase-Lev.
+ *
+ * Seul le thread propriétaire ajoute (push()) et retire (pop()) des
+ * éléments à la fin de la file. Les autres threads volent (steal()) au début
+ * de la file. L'implémentation suit l'article "Correct and Efficient
+ * Work-Stealing for Weak Memory Models" (Lê et al., PPoPP 2013).
+ *
+ * Lorsque le tableau circulaire est plein, on en alloue un deux fois plus
+ * grand. Les anciens tableaux sont conservés jusqu'à la destruction de
+ * l'instance car un voleur peut encore les lire.
+ */
+class WorkStealingDeque
+{
+  class Buffer
+  {
+   public:
+
+    explicit Buffer(Int64 capacity)
+    : m_capacity(capacity)
+    , m_mask(capacity - 1)
+    , m_items(new std::atomic<Job*>[capacity])
+    {}
+
+   public:
+
+    Int64 capacity() const { return m_capacity; }
+    Job* get(Int64 i) const { return m_items[i & m_mask].load(std::memory_order_relaxed); }
+    void put(Int64 i, Job* j) { m_items[i & m_mask].store(j, std::memory_order_relaxed); }
+
+   private:
+
+    Int64 m_capacity;
+    Int64 m_mask;
+    std::unique_ptr<std::atomic<Job*>[]> m_items;
+  };
+
+ public:
+
+  WorkStealingDeque()
+  {
+    m_buffers.emplace_back(std::make_unique<Buffer>(256));
+    m_buffer.store(m_buffers.back().get(), std::memory_order_relaxed);
+  }
+
+ public:
+
+  void push(Job* job)
+  {
+    Int64 b = m_bottom.load(std::memory_order_relaxed);
+    Int64 t = m_top.load(std::memory_order_acquire);
+    Buffer* a = m_buffer.load(std::memory_order_relaxed);
+    if ((b - t) > (a->capacity() - 1))
+      a = _grow(a, b, t);
+    a->put(b, job);
+    std::atomic_thread_fence(std::memory_order_release);
+    m_bottom.store(b + 1, std::memory_order_relaxed);
+  }
+
+  Job* pop()
+  {
+    Int64 b = m_bottom.load(std::memory_order_relaxed) - 1;
+    Buffer* a = m_buffer.load(std::memory_order_relaxed);
+    m_bottom.store(b, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    Int64 t = m_top.load(std::memory_order_relaxed);
+    Job* job = nullptr;
+    if (t <= b) {
+      job = a->get(b);
+      if (t == b) {
+        // Dernier élément: il faut être en concurrence avec les voleurs.
+        if (!m_top.compare_exchange_strong(t, t + 1, std::memory_order_seq_cst, std::memory_order_relaxed))
+          job = nullptr;
+        m_bottom.store(b + 1, std::memory_order_relaxed);
+      }
+    }
+    else
+      m_bottom.store(b + 1, std::memory_order_relaxed);
+    return job;
+  }
+
+  Job* steal()
+  {
+    Int64 t = m_top.load(std::memory_order_acquire);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    Int64 b = m_bottom.load(std::memory_order_acquire);
+    if (t < b) {
+      Buffer* a = m_buffer.load(std::memory_order_acquire);
+      Job* job = a->get(t);
+      if (!m_top.compare_exchange_strong(t, t + 1, std::memory_order_seq_cst, std::memory_order_relaxed))
+        return nullptr;
+      return job;
+    }
+    return nullptr;
+  }
+
+  bool isEmpty() const
+  {
+    Int64 b = m_bottom.load(std::memory_order_relaxed);
+    Int64 t = m_top.load(std::memory_order_relaxed);
+    return b <= t;
+  }
+
+ private:
+
+  alignas(64) std::atomic<Int64> m_top = 0;
+  alignas(64) std::atomic<Int64> m_bottom = 0;
+  std::atomic<Buffer*> m_buffer = nullptr;
+  std::vector<std::unique_ptr<Buffer>> m_buffers;
+
+ private:
+
+  Buffer* _grow(Buffer* a, Int64 b, Int64 t)
+  {
+    auto new_buffer = std::make_unique<Buffer>(a->capacity() * 2);
+    for (Int64 i = t; i < b; ++i)
+      new_buffer->put(i, a->get(i));
+    Buffer* na = new_buffer.get();
+    m_buffers.emplace_back(std::move(new_buffer));
+    m_buffer.store(na, std::memory_order_release);
+    return na;
+  }
+};
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+/*!
+ * \brief Informations d'un thread de l'implémentation.
+ *
+ * Le thread d'indice 0 n'est pas créé par l'implémentation: il s'agit
+ * du thread externe qui lance les boucles ou les tâches.
+ */
+class alignas(64) Worker
+{
+ public:
+
+  Worker(Int32 index, Int32 locality_group_begin, Int32 locality_group_size)
+  : m_index(index)
+  , m_locality_group_begin(locality_group_begin)
+  , m_locality_group_size(locality_group_size)
+  , m_random_state(static_cast<UInt32>(index) * 2654435761U + 1)
+  {}
+
+ public:
+
+  Int32 index() const { return m_index; }
+  WorkStealingDeque& deque() { return m_deque; }
+  Int32 taskIndex() const { return m_task_index; }
+  void setTaskIndex(Int32 v) { m_task_index = v; }
+  Int32 localityGroupBegin() const { return m_locality_group_begin; }
+  Int32 localityGroupSize() const { return m_locality_group_size; }
+
+  //! Générateur pseudo-aléatoire (xorshift) pour choisir les victimes.
+  UInt32 nextRandom()
+  {
+    UInt32 x = m_random_state;
+    x ^= x << 13;
+    x ^= x >> 17;
+    x ^= x << 5;
+    m_random_state = x;
+    return x;
+  }
+
+ private:
+
+  Int32 m_index = 0;
+  Int32 m_locality_group_begin = 0;
+  Int32 m_locality_group_size = 1;
+  UInt32 m_random_state = 1;
+  Int32 m_task_index = -1;
+  WorkStealingDeque m_deque;
+};
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+//! Worker associé au thread courant (nul si aucun)
+thread_local Worker* t_current_worker = nullptr;
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+/*!
+ * \brief Classe pour positionner Worker::taskIndex().
+ *
+ * Permet de positionner la valeur de Worker::taskIndex() lors de la
+ * construction et de remettre la valeur d'avant dans le destructeur.
+ */
+class TaskIndexGuard
+{
+ public:
+
+  TaskIndexGuard(Worker* w, Int32 task_index)
+  : m_worker(w)
+  {
+    if (w) {
+      m_old_task_index = w->taskIndex();
+      w->setTaskIndex(task_index);
+    }
+  }
+  ~TaskIndexGuard()
+  {
+    if (m_worker)
+      m_worker->setTaskIndex(m_old_task_index);
+  }
+
+ private:
+
+  Worker* m_worker = nullptr;
+  Int32 m_old_task_index = -1;
+};
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+/*!
+ * \brief Intervalle 1D pour le découpage récursif des boucles.
+ */
+class Range1D
+{
+ public:
+
+  Range1D(Int32 begin, Int32 size, Int32 grain_size)
+  : m_begin(begin)
+  , m_size(size)
+  , m_grain_size(grain_size)
+  {}
+
+ public:
+
+  bool isDivisible() const { return m_size > m_grain_size; }
+  //! Coupe l'intervalle en deux. L'instance garde la première moitié.
+  Range1D split()
+  {
+    Int32 half = m_size / 2;
+    Range1D r(m_begin + half, m_size - half, m_grain_size);
+    m_size = half;
+    return r;
+  }
+  Int32 begin() const { return m_begin; }
+  Int32 size() const { return m_size; }
+
+ private:
+
+  Int32 m_begin;
+  Int32 m_size;
+  Int32 m_grain_size;
+};
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+/*!
+ * \brief Intervalle multi-dimensionnel pour le découpage récursif des boucles.
+ *
+ * Si \a grain_size est positif, on ne découpe que suivant la première
+ * dimension jusqu'à atteindre \a grain_size. Sinon, on découpe suivant
+ * la plus grande dimension tant que le nombre d'éléments est supérieur
+ * à \a min_nb_element.
+ */
+template <int N>
+class RangeND
+{
+ public:
+
+  using BoundsType = ArrayBounds<typename MDDimType<N>::DimType>;
+
+ public:
+
+  RangeND(const ComplexForLoopRanges<N>& r, Int32 grain_size, Int64 min_nb_element)
+  : m_grain_size(grain_size)
+  , m_min_nb_element(min_nb_element)
+  {
+    _setBounds<0>(r);
+  }
+
+ public:
+
+  bool isDivisible() const
+  {
+    if (m_grain_size > 0)
+      return m_extents[0] > m_grain_size;
+    return _nbElement() > m_min_nb_element && m_extents[_splitDim()] > 1;
+  }
+  RangeND split()
+  {
+    Int32 dim = (m_grain_size > 0) ? 0 : _splitDim();
+    Int32 half = m_extents[dim] / 2;
+    RangeND r(*this);
+    r.m_lower[dim] += half;
+    r.m_extents[dim] -= half;
+    m_extents[dim] = half;
+    return r;
+  }
+  ComplexForLoopRanges<N> toLoopRanges() const
+  {
+    std::array<Int32, N> lower(m_lower);
+    std::array<Int32, N> extents(m_extents);
+    return { BoundsType(lower), BoundsType(extents) };
+  }
+
+ private:
+
+  std::array<Int32, N> m_lower = {};
+  std::array<Int32, N> m_extents = {};
+  Int32 m_grain_size = 0;
+  Int64 m_min_nb_element = 1;
+
+ private:
+
+  template <int I> void _setBounds(const ComplexForLoopRanges<N>& r)
+  {
+    if constexpr (I < N) {
+      m_lower[I] = r.template lowerBound<I>();
+      m_extents[I] = r.template upperBound<I>() - r.template lowerBound<I>();
+      _setBounds<I + 1>(r);
+    }
+  }
+  Int64 _nbElement() const
+  {
+    Int64 n = 1;
+    for (Int32 i = 0; i < N; ++i)
+      n *= m_extents[i];
+    return n;
+  }
+  Int32 _splitDim() const
+  {
+    Int32 dim = 0;
+    for (Int32 i = 1; i < N; ++i)
+      if (m_extents[i] > m_extents[dim])
+        dim = i;
+    return dim;
+  }
+};
+
+} // namespace StdTask
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+/*!
+ * \brief Implémentation des tâches utilisant std::thread.
+ *
+ * Cette implémentation ne dépend d'aucune bibliothèque externe et permet
+ * d'avoir des boucles parallèles et des tâches lorsque Arcane n'est pas
+ * compilé avec les TBB.
+ *
+ * Chaque thread possède une file double de Chase-Lev. Les boucles sont
+ * découpées récursivement : le thread qui exécute un intervalle en place
+ * la seconde moitié dans sa file et continue avec la première. Les threads
+ * inactifs volent les travaux au début de la file des autres threads.
+ * Un thread qui attend la fin d'un groupe de travaux (fin de boucle ou de
+ * tâches filles) exécute des travaux en attendant ce qui permet
+ * d'imbriquer les boucles et les tâches.
+ *
+ * Les threads sont créés dans l'ordre de leur indice et notifient
+ * TaskFactory::createThreadObservable() dans cet ordre. Avec
+ * ThreadBindingMng, le thread d'indice \a i est donc punaisé sur le
+ * i-ème coeur. Si le service d'affinité indique plusieurs sockets, les
+ * threads d'un même socket forment un groupe et les vols sont d'abord
+ * tentés dans le groupe du thread avant les autres groupes.
+ *
+ * Le thread d'indice 0 est le thread externe qui lance une boucle ou une
+ * tâche. Un seul thread externe peut utiliser les threads à la fois : si
+ * un autre thread externe lance une boucle pendant ce temps (par exemple
+ * avec plusieurs sous-domaines en mémoire partagée), elle est exécutée
+ * séquentiellement.
+ */
+class StdTaskImplementation
+: public ITaskImplementation
+{
+  friend class StdTaskImplementationTask;
+  class ScopedExternalWorker;
+  template <typename RangeType, typename Functor> class RangeJob;
+  class FunctorJob;
+
+  //! Nombre d'itérations d'attente active avant de s'endormir
+  static constexpr Int32 NB_SPIN_BEFORE_SLEEP = 2000;
+
+ public:
+
+  explicit StdTaskImplementation(const ServiceBuildInfo& sbi)
+  {
+    ARCANE_UNUSED(sbi);
+  }
+  ~StdTaskImplementation() override;
+
+ public:
+
+  void build() {}
+  void initialize(Int32 nb_thread) override;
+  void terminate() override;
+
+  ITask* createRootTask(ITaskFunctor* f) override;
+
+  void executeParallelFor(Int32 begin, Int32 size, const ParallelLoopOptions& options, IRangeFunctor* f) final;
+  void executeParallelFor(Int32 begin, Int32 size, Integer grain_size, IRangeFunctor* f) final;
+  void executeParallelFor(Int32 begin, Int32 size, IRangeFunctor* f) final
+  {
+    executeParallelFor(begin, size, TaskFactory::defaultParallelLoopOptions(), f);
+  }
+  void executeParallelFor(const ParallelFor1DLoopInfo& loop_info) override;
+
+  void executeParallelFor(const ComplexForLoopRanges<1>& loop_ranges,
+                          const ParallelLoopOptions& options,
+                          IMDRangeFunctor<1>* functor) final
+  {
+    _executeMDParallelFor<1>(loop_ranges, functor, options);
+  }
+  void executeParallelFor(const ComplexForLoopRanges<2>& loop_ranges,
+                          const ParallelLoopOptions& options,
+                          IMDRangeFunctor<2>* functor) final
+  {
+    _executeMDParallelFor<2>(loop_ranges, functor, options);
+  }
+  void executeParallelFor(const ComplexForLoopRanges<3>& loop_ranges,
+                          const ParallelLoopOptions& options,
+                          IMDRangeFunctor<3>* functor) final
+  {
+    _executeMDParallelFor<3>(loop_ranges, functor, options);
+  }
+  void executeParallelFor(const ComplexForLoopRanges<4>& loop_ranges,
+                          const ParallelLoopOptions& options,
+                          IMDRangeFunctor<4>* functor) final
+  {
+    _executeMDParallelFor<4>(loop_ranges, functor, options);
+  }
+
+  bool isActive() const final { return m_is_active; }
+
+  Int32 nbAllowedThread() const final { return m_nb_allowed_thread; }
+
+  Int32 currentTaskThreadIndex() const final
+  {
+    StdTask::Worker* w = StdTask::t_current_worker;
+    return (w) ? w->index() : 0;
+  }
+
+  Int32 currentTaskIndex() const final
+  {
+    StdTask::Worker* w = StdTask::t_current_worker;
+    if (!w)
+      return 0;
+    Int32 task_index = w->taskIndex();
+    return (task_index >= 0) ? task_index : w->index();
+  }
+
+  void printInfos(std::ostream& o) const final;
+
+ private:
+
+  bool m_is_active = false;
+  bool m_is_initialized = false;
+  Int32 m_nb_allowed_thread = 1;
+  Int32 m_locality_group_size = 1;
+  std::vector<std::unique_ptr<StdTask::Worker>> m_workers;
+  std::vector<std::thread> m_threads;
+  //! Verrou pour le thread externe qui utilise le worker d'indice 0
+  std::mutex m_external_mutex;
+
+  // Gestion de l'endormissement des threads inactifs
+  std::mutex m_sleep_mutex;
+  std::condition_variable m_sleep_condition;
+  std::atomic<Int32> m_nb_sleeping = 0;
+  bool m_is_terminating = false;
+
+  // Pour créer les threads dans l'ordre de leur indice
+  std::mutex m_start_mutex;
+  std::condition_variable m_start_condition;
+  Int32 m_nb_started = 0;
+
+ private:
+
+  void _threadMain(Int32 index);
+  void _notifyThreadCreated(Int32 index);
+  void _push(StdTask::Worker& w, StdTask::Job* job);
+  void _runJob(StdTask::Worker& w, StdTask::Job* job);
+  StdTask::Job* _steal(StdTask::Worker& w);
+  bool _hasPendingJob() const;
+  void _wait(StdTask::Worker& w, StdTask::JobGroup& group);
+  void _computeLocalityGroupSize();
+  template <typename RangeType, typename Functor> void
+  _executeRange(StdTask::Worker& w, StdTask::JobGroup& group, RangeType range, const Functor& func);
+  template <typename RangeType, typename Functor> void
+  _executeRangeAndWait(StdTask::Worker& w, RangeType range, const Functor& func);
+  template <typename Functor> void
+  _executeBlocks(StdTask::Worker& w, Int32 nb_block, const Functor& func);
+  void _executeParallelFor(const ParallelFor1DLoopInfo& loop_info);
+  template <int RankValue> void
+  _executeMDParallelFor(const ComplexForLoopRanges<RankValue>& loop_ranges,
+                        IMDRangeFunctor<RankValue>* functor,
+                        const ParallelLoopOptions& options);
+};
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+/*!
+ * \brief Positionne le thread courant comme le worker d'indice 0.
+ *
+ * Si le thread courant est déjà un worker, ne fait rien. Si un autre
+ * thread externe utilise déjà le worker d'indice 0, worker() est nul et
+ * l'appelant doit exécuter séquentiellement.
+ */
+class StdTaskImplementation::ScopedExternalWorker
+{
+ public:
+
+  explicit ScopedExternalWorker(StdTaskImplementation* impl)
+  : m_impl(impl)
+  {
+    m_worker = StdTask::t_current_worker;
+    if (m_worker || !impl->m_is_initialized)
+      return;
+    if (impl->m_external_mutex.try_lock()) {
+      m_worker = impl->m_workers[0].get();
+      StdTask::t_current_worker = m_worker;
+      m_is_locked = true;
+    }
+  }
+  ~ScopedExternalWorker()
+  {
+    if (m_is_locked) {
+      StdTask::t_current_worker = nullptr;
+      m_impl->m_external_mutex.unlock();
+    }
+  }
+
+ public:
+
+  StdTask::Worker* worker() const { return m_worker; }
+
+ private:
+
+  StdTaskImplementation* m_impl = nullptr;
+  StdTask::Worker* m_worker = nullptr;
+  bool m_is_locked = false;
+};
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+/*!
+ * \brief Travail exécutant une partie d'une boucle.
+ */
+template <typename RangeType, typename Functor>
+class StdTaskImplementation::RangeJob
+: public StdTask::Job
+{
+ public:
+
+  RangeJob(StdTaskImplementation* impl, StdTask::JobGroup* group, const RangeType& range, const Functor& func)
+  : StdTask::Job(group)
+  , m_impl(impl)
+  , m_range(range)
+  , m_functor(func)
+  {}
+
+ public:
+
+  void execute(StdTask::Worker& w) override
+  {
+    m_impl->_executeRange(w, *group(), m_range, m_functor);
+  }
+
+ private:
+
+  StdTaskImplementation* m_impl;
+  RangeType m_range;
+  const Functor& m_functor;
+};
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+/*!
+ * \brief Travail exécutant une fonction quelconque.
+ */
+class StdTaskImplementation::FunctorJob
+: public StdTask::Job
+{
+ public:
+
+  FunctorJob(StdTask::JobGroup* group, std::function<void()> func)
+  : StdTask::Job(group)
+  , m_functor(std::move(func))
+  {}
+
+ public:
+
+  void execute(StdTask::Worker&) override { m_functor(); }
+
+ private:
+
+  std::function<void()> m_functor;
+};
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+/*!
+ * \brief Tâche de l'implémentation StdTaskImplementation.
+ */
+class StdTaskImplementationTask
+: public ITask
+{
+ public:
+
+  static const int FUNCTOR_CLASS_SIZE = 32;
+
+ public:
+
+  StdTaskImplementationTask(StdTaskImplementation* impl, ITaskFunctor* f)
+  : m_impl(impl)
+  {
+    m_functor = f->clone(m_functor_buf, FUNCTOR_CLASS_SIZE);
+  }
+  ~StdTaskImplementationTask() override
+  {
+    m_functor->~ITaskFunctor();
+  }
+
+ public:
+
+  void launchAndWait() override;
+  void launchAndWait(ConstArrayView<ITask*> tasks) override;
+  void execute()
+  {
+    TaskContext task_context(this);
+    m_functor->executeFunctor(task_context);
+  }
+
+ protected:
+
+  ITask* _createChildTask(ITaskFunctor* functor) override
+  {
+    return new StdTaskImplementationTask(m_impl, functor);
+  }
+
+ private:
+
+  StdTaskImplementation* m_impl = nullptr;
+  ITaskFunctor* m_functor = nullptr;
+  alignas(std::max_align_t) char m_functor_buf[FUNCTOR_CLASS_SIZE];
+};
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+StdTaskImplementation::
+~StdTaskImplementation()
+{
+  terminate();
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+void StdTaskImplementation::
+initialize(Int32 nb_thread)
+{
+  if (nb_thread <= 0)
+    nb_thread = static_cast<Int32>(std::thread::hardware_concurrency());
+  if (nb_thread <= 0)
+    nb_thread = 1;
+  m_nb_allowed_thread = nb_thread;
+  m_is_active = (nb_thread != 1);
+  _computeLocalityGroupSize();
+
+  if (TaskFactory::verboseLevel() >= 1)
+    std::cout << "StdTask: StdTaskImplementationInit nb_allowed_thread=" << m_nb_allowed_thread
+              << " locality_group_size=" << m_locality_group_size
+              << " id=" << std::this_thread::get_id() << "\n";
+
+  for (Int32 i = 0; i < nb_thread; ++i) {
+    Int32 group_begin = (i / m_locality_group_size) * m_locality_group_size;
+    Int32 group_size = std::min(m_locality_group_size, nb_thread - group_begin);
+    m_workers.emplace_back(std::make_unique<StdTask::Worker>(i, group_begin, group_size));
+  }
+
+  // Le thread courant correspond à l'indice 0. Les autres threads sont créés
+  // un par un pour que les notifications soient faites dans l'ordre des indices.
+  _notifyThreadCreated(0);
+  for (Int32 i = 1; i < nb_thread; ++i) {
+    m_threads.emplace_back([this, i]() { _threadMain(i); });
+    std::unique_lock lk(m_start_mutex);
+    m_start_condition.wait(lk, [&] { return m_nb_started == i; });
+  }
+  m_is_initialized = true;
+
+  ParallelLoopOptions opts = TaskFactory::defaultParallelLoopOptions();
+  opts.setMaxThread(nbAllowedThread());
+  TaskFactory::setDefaultParallelLoopOptions(opts);
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+void StdTaskImplementation::
+terminate()
+{
+  if (!m_is_initialized)
+    return;
+  {
+    std::scoped_lock sl(m_sleep_mutex);
+    m_is_terminating = true;
+  }
+  m_sleep_condition.notify_all();
+  for (std::thread& t : m_threads)
+    t.join();
+  m_threads.clear();
+  m_is_initialized = false;
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+/*!
+ * \brief Calcule la taille des groupes de threads pour le vol de tâches.
+ *
+ * Si le service d'affinité est disponible et indique plusieurs sockets, un
+ * groupe contient les threads d'un même socket. Sinon il n'y a qu'un seul
+ * groupe. La variable d'environnement ARCANE_STD_TASK_LOCALITY_GROUP_SIZE
+ * permet de spécifier la taille des groupes.
+ */
+void StdTaskImplementation::
+_computeLocalityGroupSize()
+{
+  Int32 group_size = m_nb_allowed_thread;
+  IProcessorAffinityService* pas = platform::getProcessorAffinityService();
+  if (pas) {
+    Int32 nb_socket = pas->numberOfSocket();
+    Int32 nb_pu = pas->numberOfProcessingUnit();
+    if (nb_socket > 1 && nb_pu >= nb_socket)
+      group_size = nb_pu / nb_socket;
+  }
+  if (auto v = Convert::Type<Int32>::tryParseFromEnvironment("ARCANE_STD_TASK_LOCALITY_GROUP_SIZE", true))
+    group_size = v.value();
+  m_locality_group_size = std::clamp(group_size, 1, m_nb_allowed_thread);
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+void StdTaskImplementation::
+_notifyThreadCreated(Int32 index)
+{
+  // Il faut toujours un verrou car on n'est pas certain que
+  // les méthodes appelées par l'observable soient thread-safe
+  // (et aussi TaskFactory::createThreadObservable() ne l'est pas)
+  std::scoped_lock sl(m_start_mutex);
+  if (TaskFactory::verboseLevel() >= 1)
+    std::cout << "StdTask: CREATE THREAD index=" << index
+              << " id=" << std::this_thread::get_id() << "\n";
+  TaskFactory::createThreadObservable()->notifyAllObservers();
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+void StdTaskImplementation::
+_threadMain(Int32 index)
+{
+  StdTask::Worker& w = *m_workers[index];
+  StdTask::t_current_worker = &w;
+  _notifyThreadCreated(index);
+  {
+    std::scoped_lock sl(m_start_mutex);
+    m_nb_started = index;
+  }
+  m_start_condition.notify_all();
+
+  Int32 nb_spin = 0;
+  for (;;) {
+    StdTask::Job* job = w.deque().pop();
+    if (!job)
+      job = _steal(w);
+    if (job) {
+      _runJob(w, job);
+      nb_spin = 0;
+      continue;
+    }
+    if (nb_spin < NB_SPIN_BEFORE_SLEEP) {
+      ++nb_spin;
+      std::this_thread::yield();
+      continue;
+    }
+    // Aucun travail disponible: s'endort jusqu'à ce qu'un travail soit ajouté.
+    // L'incrément de \a m_nb_sleeping avant la vérification et la lecture de
+    // \a m_nb_sleeping après l'ajout dans _push() garantissent qu'on ne
+    // manque pas de réveil.
+    {
+      std::unique_lock lk(m_sleep_mutex);
+      if (m_is_terminating)
+        break;
+      m_nb_sleeping.fetch_add(1, std::memory_order_seq_cst);
+      std::atomic_thread_fence(std::memory_order_seq_cst);
+      if (!_hasPendingJob())
+        m_sleep_condition.wait(lk);
+      m_nb_sleeping.fetch_sub(1, std::memory_order_relaxed);
+      if (m_is_terminating)
+        break;
+    }
+    nb_spin = 0;
+  }
+
+  {
+    std::scoped_lock sl(m_start_mutex);
+    TaskFactory::destroyThreadObservable()->notifyAllObservers();
+  }
+  StdTask::t_current_worker = nullptr;
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+void StdTaskImplementation::
+_push(StdTask::Worker& w, StdTask::Job* job)
+{
+  job->group()->add();
+  w.deque().push(job);
+  std::atomic_thread_fence(std::memory_order_seq_cst);
+  if (m_nb_sleeping.load(std::memory_order_relaxed) > 0) {
+    { std::scoped_lock sl(m_sleep_mutex); }
+    m_sleep_condition.notify_all();
+  }
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+void StdTaskImplementation::
+_runJob(StdTask::Worker& w, StdTask::Job* job)
+{
+  StdTask::JobGroup* group = job->group();
+  try {
+    job->execute(w);
+  }
+  catch (...) {
+    group->setException(std::current_exception());
+  }
+  delete job;
+  group->done();
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+/*!
+ * \brief Tente de voler un travail.
+ *
+ * Les victimes sont choisies aléatoirement, d'abord dans le groupe
+ * de localité du thread puis parmi tous les threads.
+ */
+StdTask::Job* StdTaskImplementation::
+_steal(StdTask::Worker& w)
+{
+  const Int32 nb_worker = m_nb_allowed_thread;
+  if (nb_worker <= 1)
+    return nullptr;
+  const Int32 group_size = w.localityGroupSize();
+  if (group_size > 1) {
+    const Int32 group_begin = w.localityGroupBegin();
+    for (Int32 i = 0; i < group_size; ++i) {
+      Int32 victim = group_begin + static_cast<Int32>(w.nextRandom() % group_size);
+      if (victim == w.index())
+        continue;
+      if (StdTask::Job* job = m_workers[victim]->deque().steal())
+        return job;
+    }
+  }
+  if (group_size < nb_worker) {
+    for (Int32 i = 0; i < nb_worker; ++i) {
+      Int32 victim = static_cast<Int32>(w.nextRandom() % nb_worker);
+      if (victim == w.index())
+        continue;
+      if (StdTask::Job* job = m_workers[victim]->deque().steal())
+        return job;
+    }
+  }
+  return nullptr;
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+bool StdTaskImplementation::
+_hasPendingJob() const
+{
+  for (const auto& w : m_workers)
+    if (!w->deque().isEmpty())
+      return true;
+  return false;
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+/*!
+ * \brief Attend la fin des travaux de \a group.
+ *
+ * En attendant, le thread exécute les travaux de sa file ou en vole
+ * aux autres threads.
+ */
+void StdTaskImplementation::
+_wait(StdTask::Worker& w, StdTask::JobGroup& group)
+{
+  while (!group.isDone()) {
+    StdTask::Job* job = w.deque().pop();
+    if (!job)
+      job = _steal(w);
+    if (job)
+      _runJob(w, job);
+    else
+      std::this_thread::yield();
+  }
+  group.rethrowIfNeeded();
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+/*!
+ * \brief Exécute \a range en le découpant récursivement.
+ *
+ * La seconde moitié de l'intervalle est mise dans la file de \a w pour
+ * pouvoir être volée par un autre thread.
+ */
+template <typename RangeType, typename Functor> void StdTaskImplementation::
+_executeRange(StdTask::Worker& w, StdTask::JobGroup& group, RangeType range, const Functor& func)
+{
+  while (range.isDivisible()) {
+    RangeType right = range.split();
+    _push(w, new RangeJob<RangeType, Functor>(this, &group, right, func));
+  }
+  func(range);
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+template <typename RangeType, typename Functor> void StdTaskImplementation::
+_executeRangeAndWait(StdTask::Worker& w, RangeType range, const Functor& func)
+{
+  StdTask::JobGroup group;
+  try {
+    _executeRange(w, group, range, func);
+  }
+  catch (...) {
+    group.setException(std::current_exception());
+  }
+  _wait(w, group);
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+/*!
+ * \brief Exécute \a func(i) pour i dans [0,nb_block[ avec un travail par bloc.
+ */
+template <typename Functor> void StdTaskImplementation::
+_executeBlocks(StdTask::Worker& w, Int32 nb_block, const Functor& func)
+{
+  StdTask::JobGroup group;
+  for (Int32 i = 1; i < nb_block; ++i)
+    _push(w, new FunctorJob(&group, [&func, i]() { func(i); }));
+  try {
+    func(0);
+  }
+  catch (...) {
+    group.setException(std::current_exception());
+  }
+  _wait(w, group);
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+void StdTaskImplementation::
+printInfos(std::ostream& o) const
+{
+  o << "StdTaskImplementation"
+    << " nb_thread=" << m_nb_allowed_thread
+    << " locality_group_size=" << m_locality_group_size;
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+ITask* StdTaskImplementation::
+createRootTask(ITaskFunctor* f)
+{
+  return new StdTaskImplementationTask(this, f);
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+void StdTaskImplementation::
+_executeParallelFor(const ParallelFor1DLoopInfo& loop_info)
+{
+  ScopedExecInfo sei(loop_info.runInfo());
+  ForLoopOneExecStat* stat_info = sei.statInfo();
+  impl::ScopedStatLoop scoped_loop(sei.isOwn() ? stat_info : nullptr);
+
+  Int32 begin = loop_info.beginIndex();
+  Int32 size = loop_info.size();
+  ParallelLoopOptions options = loop_info.runInfo().options().value_or(TaskFactory::defaultParallelLoopOptions());
+  IRangeFunctor* f = loop_info.functor();
+
+  Int32 max_thread = options.maxThread();
+  Int32 nb_allowed_thread = m_nb_allowed_thread;
+  if (max_thread < 0 || max_thread > nb_allowed_thread)
+    max_thread = nb_allowed_thread;
+
+  if (TaskFactory::verboseLevel() >= 1)
+    std::cout << "StdTask: executeParallelFor begin=" << begin
+              << " size=" << size << " max_thread=" << max_thread
+              << " grain_size=" << options.grainSize()
+              << " nb_allowed=" << nb_allowed_thread << '\n';
+
+  ScopedExternalWorker external_worker(this);
+  StdTask::Worker* w = external_worker.worker();
+
+  // En exécution séquentielle, appelle directement la méthode \a f.
+  if (max_thread <= 1 || size <= 1 || !w) {
+    f->executeFunctor(begin, size);
+    return;
+  }
+
+  // Remplace les valeurs non initialisées de \a options par celles de \a m_default_loop_options
+  ParallelLoopOptions true_options(options);
+  true_options.mergeUnsetValues(TaskFactory::defaultParallelLoopOptions());
+  Int32 grain_size = true_options.grainSize();
+  auto partitioner = true_options.partitioner();
+
+  auto exec_range = [=](const StdTask::Range1D& r) {
+    if (stat_info)
+      stat_info->incrementNbChunk();
+    f->executeFunctor(r.begin(), r.size());
+  };
+
+  if (partitioner == ParallelLoopOptions::Partitioner::Deterministic) {
+    // Le découpage ne dépend que de l'intervalle, du nombre de threads et de
+    // la taille du grain: chaque tâche \a task_id traite les blocs
+    // task_id + k * nb_thread (algorithme round-robin similaire à celui
+    // de TBBTaskImplementation).
+    Int32 nb_task = max_thread;
+    Int32 nb_block = nb_task;
+    Int32 block_size = 0;
+    if (grain_size > 0) {
+      block_size = grain_size;
+      nb_block = (size + block_size - 1) / block_size;
+    }
+    else
+      block_size = size / nb_block;
+    auto exec_task = [&](Int32 task_id) {
+      StdTask::TaskIndexGuard guard(StdTask::t_current_worker, task_id);
+      for (Int32 block_id = task_id; block_id < nb_block; block_id += nb_task) {
+        Int32 iter_begin = block_id * block_size;
+        Int32 iter_size = ((block_id + 1) == nb_block) ? (size - iter_begin) : block_size;
+        if (iter_size > 0)
+          exec_range(StdTask::Range1D(begin + iter_begin, iter_size, iter_size));
+      }
+    };
+    _executeBlocks(*w, nb_task, exec_task);
+    return;
+  }
+
+  if (partitioner == ParallelLoopOptions::Partitioner::Static || max_thread < nb_allowed_thread) {
+    // Un bloc par thread. Comme il n'y a que \a max_thread blocs, au plus
+    // \a max_thread threads exécutent la boucle.
+    Int32 nb_block = std::min(max_thread, size);
+    auto exec_block = [&](Int32 block_id) {
+      Int32 iter_begin = static_cast<Int32>((static_cast<Int64>(size) * block_id) / nb_block);
+      Int32 iter_end = static_cast<Int32>((static_cast<Int64>(size) * (block_id + 1)) / nb_block);
+      exec_range(StdTask::Range1D(begin + iter_begin, iter_end - iter_begin, size));
+    };
+    _executeBlocks(*w, nb_block, exec_block);
+    return;
+  }
+
+  // Partitionnement automatique. Si la taille du grain n'est pas spécifiée,
+  // on découpe en environ 4 fois plus de morceaux que de threads pour
+  // permettre l'équilibrage par vol de tâches.
+  if (grain_size <= 0)
+    grain_size = std::max(1, size / (4 * max_thread));
+  _executeRangeAndWait(*w, StdTask::Range1D(begin, size, grain_size), exec_range);
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+void StdTaskImplementation::
+executeParallelFor(const ParallelFor1DLoopInfo& loop_info)
+{
+  _executeParallelFor(loop_info);
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+void StdTaskImplementation::
+executeParallelFor(Integer begin, Integer size, Integer grain_size, IRangeFunctor* f)
+{
+  ParallelLoopOptions opts(TaskFactory::defaultParallelLoopOptions());
+  opts.setGrainSize(grain_size);
+  ForLoopRunInfo run_info(opts);
+  executeParallelFor(ParallelFor1DLoopInfo(begin, size, f, run_info));
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+void StdTaskImplementation::
+executeParallelFor(Integer begin, Integer size, const ParallelLoopOptions& options, IRangeFunctor* f)
+{
+  executeParallelFor(ParallelFor1DLoopInfo(begin, size, f, ForLoopRunInfo(options)));
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+/*!
+ * \brief Exécution d'une boucle N-dimensions.
+ *
+ * Si la taille du grain est spécifiée, elle s'applique à la première
+ * dimension comme pour TBBTaskImplementation.
+ */
+template <int RankValue> void StdTaskImplementation::
+_executeMDParallelFor(const ComplexForLoopRanges<RankValue>& loop_ranges,
+                      IMDRangeFunctor<RankValue>* functor,
+                      const ParallelLoopOptions& options)
+{
+  ScopedExecInfo sei(ForLoopRunInfo{});
+  ForLoopOneExecStat* stat_info = sei.statInfo();
+  impl::ScopedStatLoop scoped_loop(sei.isOwn() ? stat_info : nullptr);
+
+  if (TaskFactory::verboseLevel() >= 1)
+    std::cout << "StdTask: executeMDParallelFor nb_dim=" << RankValue << '\n';
+
+  // Pour la dimension 1, utilise l'implémentation 1D
+  if constexpr (RankValue == 1) {
+    auto x1 = [&](Integer begin, Integer size) {
+      functor->executeFunctor(makeLoopRanges(ForLoopRange(begin, size)));
+    };
+    LambdaRangeFunctorT<decltype(x1)> functor_1d(x1);
+    Integer begin1 = loop_ranges.template lowerBound<0>();
+    Integer size1 = loop_ranges.template upperBound<0>() - begin1;
+    ForLoopRunInfo run_info(options);
+    run_info.setExecStat(stat_info);
+    _executeParallelFor(ParallelFor1DLoopInfo(begin1, size1, &functor_1d, run_info));
+  }
+  else {
+    Int32 max_thread = options.maxThread();
+    if (max_thread < 0 || max_thread > m_nb_allowed_thread)
+      max_thread = m_nb_allowed_thread;
+
+    ScopedExternalWorker external_worker(this);
+    StdTask::Worker* w = external_worker.worker();
+
+    // En exécution séquentielle, appelle directement la méthode \a f.
+    Int64 nb_element = loop_ranges.nbElement();
+    if (max_thread <= 1 || nb_element <= 1 || !w) {
+      functor->executeFunctor(loop_ranges);
+      return;
+    }
+
+    ParallelLoopOptions true_options(options);
+    true_options.mergeUnsetValues(TaskFactory::defaultParallelLoopOptions());
+    if (true_options.partitioner() == ParallelLoopOptions::Partitioner::Deterministic)
+      ARCANE_THROW(NotImplementedException, "ParallelLoopOptions::Partitioner::Deterministic for multi-dimensionnal loops");
+
+    Int32 grain_size = true_options.grainSize();
+    Int64 min_nb_element = std::max(static_cast<Int64>(1), nb_element / (4 * max_thread));
+    if (true_options.partitioner() == ParallelLoopOptions::Partitioner::Static || max_thread < m_nb_allowed_thread) {
+      grain_size = 0;
+      min_nb_element = std::max(static_cast<Int64>(1), nb_element / max_thread);
+    }
+    auto exec_range = [=](const StdTask::RangeND<RankValue>& r) {
+      if (stat_info)
+        stat_info->incrementNbChunk();
+      functor->executeFunctor(r.toLoopRanges());
+    };
+    StdTask::RangeND<RankValue> range(loop_ranges, grain_size, min_nb_element);
+    _executeRangeAndWait(*w, range, exec_range);
+  }
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+void StdTaskImplementationTask::
+launchAndWait()
+{
+  std::unique_ptr<StdTaskImplementationTask> self(this);
+  StdTaskImplementation::ScopedExternalWorker external_worker(m_impl);
+  execute();
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+void StdTaskImplementationTask::
+launchAndWait(ConstArrayView<ITask*> tasks)
+{
+  Integer n = tasks.size();
+  if (n == 0)
+    return;
+
+  StdTaskImplementation::ScopedExternalWorker external_worker(m_impl);
+  StdTask::Worker* w = external_worker.worker();
+  auto exec_task = [&](Int32 i) {
+    static_cast<StdTaskImplementationTask*>(tasks[i])->execute();
+  };
+  try {
+    if (w)
+      m_impl->_executeBlocks(*w, n, exec_task);
+    else
+      for (Integer i = 0; i < n; ++i)
+        exec_task(i);
+  }
+  catch (...) {
+    for (Integer i = 0; i < n; ++i)
+      delete static_cast<StdTaskImplementationTask*>(tasks[i]);
+    throw;
+  }
+  for (Integer i = 0; i < n; ++i)
+    delete static_cast<StdTaskImplementationTask*>(tasks[i]);
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+ARCANE_REGISTER_APPLICATION_FACTORY(StdTaskImplementation, ITaskImplementation,
+                                    StdTaskImplementation);
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+} // End namespace Arcane
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
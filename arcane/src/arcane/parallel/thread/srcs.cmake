@@ -19,6 +19,7 @@ set(ARCANE_SOURCES
   SharedMemoryParallelMng.h
 
   StdThreadImplementationService.cc
+  StdTaskImplementation.cc
 
   # TODO: les fichiers suivants sont gardés pour des raisons
   # de compatibilité avec l'existant. Il faudra les supprimer
@@ -1,11 +1,11 @@
 ﻿// -*- tab-width: 2; indent-tabs-mode: nil; coding: utf-8-with-signature -*-
 //-----------------------------------------------------------------------------
-// Copyright 2000-2022 CEA (www.cea.fr) IFPEN (www.ifpenergiesnouvelles.com)
+// Copyright 2000-2024 CEA (www.cea.fr) IFPEN (www.ifpenergiesnouvelles.com)
 // See the top-level COPYRIGHT file for details.
 // SPDX-License-Identifier: Apache-2.0
 //-----------------------------------------------------------------------------
 /*---------------------------------------------------------------------------*/
-/* ArcaneCheckpointModule.cc                                   (C) 2000-2020 */
+/* ArcaneCheckpointModule.cc                                   (C) 2000-2024 */
 /*                                                                           */
 /* Module gérant les protections/reprises.                                   */
 /*---------------------------------------------------------------------------*/
@@ -175,11 +175,17 @@ checkpointStartInit()
 void ArcaneCheckpointModule::
 checkpointExit()
 {
+  // Attend la fin d'une éventuelle écriture asynchrone et met à jour
+  // les informations de relecture.
+  ICheckpointMng* checkpoint_mng = subDomain()->checkpointMng();
+  checkpoint_mng->waitDefaultCheckpoint();
+
   if (!options()->doDumpAtEnd())
     return;
 
   _doCheckpoint(false);
   _dumpStats();
+  checkpoint_mng->waitDefaultCheckpoint();
 
   if (m_checkpoint_writer)
     m_checkpoint_writer->close();
@@ -1,11 +1,11 @@
 ﻿// -*- tab-width: 2; indent-tabs-mode: nil; coding: utf-8-with-signature -*-
 //-----------------------------------------------------------------------------
-// Copyright 2000-2022 CEA (www.cea.fr) IFPEN (www.ifpenergiesnouvelles.com)
+// Copyright 2000-2024 CEA (www.cea.fr) IFPEN (www.ifpenergiesnouvelles.com)
 // See the top-level COPYRIGHT file for details.
 // SPDX-License-Identifier: Apache-2.0
 //-----------------------------------------------------------------------------
 /*---------------------------------------------------------------------------*/
-/* ArcaneLoadBalanceModule.cc                                  (C) 2000-2010 */
+/* ArcaneLoadBalanceModule.cc                                  (C) 2000-2024 */
 /*                                                                           */
 /* Module d'équilibrage de charge.                                           */
 /*---------------------------------------------------------------------------*/
@@ -27,6 +27,10 @@
 #include "arcane/IMeshModifier.h"
 #include "arcane/ItemPrinter.h"
 #include "arcane/IItemFamily.h"
+#include "arcane/ILoadBalanceMng.h"
+#include "arcane/core/materials/IMeshMaterialMng.h"
+#include "arcane/core/materials/CellToAllEnvCellConverter.h"
+#include "arcane/core/materials/MatItemEnumerator.h"
 
 #include "arcane/std/ArcaneLoadBalance_axl.h"
 
@@ -66,6 +70,16 @@ class ArcaneLoadBalanceModule
    * Note: cette valeur doit être synchronisée.
    */
   Real m_computation_time;
+  //! Temps de calcul des points d'entrée matériaux depuis le début de l'exécution
+  Real m_elapsed_material_time = 0.0;
+  //! Temps de calcul des points d'entrée matériaux depuis la dernière vérification
+  Real m_material_time = 0.0;
+  //! Temps de calcul depuis la dernière vérification
+  Real m_last_computation_time = 0.0;
+  //! Coefficients du modèle de coût des matériaux (coût maille, composant, maille mixte)
+  Real m_material_costs[3] = { 1.0, 0.0, 0.0 };
+  //! Déséquilibre du coût des matériaux avant le dernier repartitionnement (négatif si aucun)
+  Real m_material_cost_imbalance = -1.0;
 #ifdef OLD_LOADBALANCE
    Integer m_nb_weight;
   UniqueArray<float> m_cells_weight;
@@ -75,6 +89,11 @@ class ArcaneLoadBalanceModule
 
   void _checkInit();
   Real _computeImbalance();
+  Real _computeMaterialTime();
+  void _computeMaterialCost();
+  void _computeMaterialCounts(Real& nb_cell, Real& nb_component, Real& nb_mixed);
+  Real _computeMaterialCostImbalance();
+  void _checkMaterialCostImbalance();
 #ifdef OLD_LOADBALANCE
    void _computeWeights(RealConstArrayView compute_times,Real max_compute_time);
 #endif // OLD_LOADBALANCE
@@ -153,6 +172,7 @@ checkLoadBalance()
     return;
   if (global_iteration==0)
     return;
+  _checkMaterialCostImbalance();
   if ((global_iteration % period) != 0)
     return;
   
@@ -163,15 +183,19 @@ checkLoadBalance()
   if (imbalance<options()->maxImbalance())
     return;
   Real min_cpu_time = options()->minCpuTime();
-  if (min_cpu_time!=0 || m_computation_time<min_cpu_time)
+  if (min_cpu_time!=0 && m_computation_time<min_cpu_time)
     return;
 
   m_computation_time = 0;
   info() << "Programme un repartitionnement du maillage";
+  if (options()->materialCost())
+    _computeMaterialCost();
 #ifdef OLD_LOADBALANCE
-  IMeshPartitioner* p = options()->partitioner();
-  _computeWeights(p->computationTimes(),p->maximumComputationTime());
-  p->setCellsWeight(m_cells_weight,m_nb_weight);
+  else{
+    IMeshPartitioner* p = options()->partitioner();
+    _computeWeights(p->computationTimes(),p->maximumComputationTime());
+    p->setCellsWeight(m_cells_weight,m_nb_weight);
+  }
 #endif // OLD_LOADBALANCE
   subDomain()->timeLoopMng()->registerActionMeshPartition(options()->partitioner());
 }
@@ -283,6 +307,9 @@ _computeImbalance()
   Real computation_time = elapsed_computation_time - m_elapsed_computation_time();
 
   m_elapsed_computation_time = elapsed_computation_time;
+  m_last_computation_time = computation_time;
+  if (options()->materialCost())
+    m_material_time = _computeMaterialTime();
 
   if (options()->statistics()){
     // Optionnel:
@@ -336,6 +363,229 @@ _computeImbalance()
   return imbalance;
 }
 
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+/*!
+ * \brief Temps passé dans les points d'entrée matériaux depuis le dernier appel.
+ */
+Real ArcaneLoadBalanceModule::
+_computeMaterialTime()
+{
+  ITimeStats* time_stats = subDomain()->timeStats();
+  Real elapsed_time = 0.0;
+  for( Integer i=0, n=options()->materialEntryPoint.size(); i<n; ++i )
+    elapsed_time += time_stats->elapsedTime(TP_Computation,options()->materialEntryPoint[i]);
+  Real material_time = elapsed_time - m_elapsed_material_time;
+  m_elapsed_material_time = elapsed_time;
+  return material_time;
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+/*!
+ * \brief Calcule les coefficients du modèle de coût des matériaux.
+ *
+ * Le temps de calcul d'un sous-domaine est modélisé par
+ * T = a * nb_cell + b * nb_component avec nb_component la somme sur
+ * les mailles du nombre de milieux et de matériaux.
+ *
+ * Si des points d'entrée matériaux sont spécifiés, leur temps sert à
+ * calculer b et le reste du temps sert à calculer a. Sinon, a et b sont
+ * estimés par une régression aux moindres carrés sur l'ensemble des
+ * sous-domaines. Les coefficients sont ensuite normalisés pour que
+ * le poids moyen d'une maille vaille 1.
+ */
+void ArcaneLoadBalanceModule::
+_computeMaterialCost()
+{
+  IParallelMng* pm = subDomain()->parallelMng();
+  Real nb_cell = 0.0;
+  Real nb_component = 0.0;
+  Real nb_mixed = 0.0;
+  _computeMaterialCounts(nb_cell,nb_component,nb_mixed);
+
+  Real total_time = m_last_computation_time;
+  Real material_time = math::min(m_material_time,total_time);
+  bool has_material_time = options()->materialEntryPoint.size()!=0;
+
+  // Sommes sur tous les sous-domaines nécessaires au calcul des coefficients.
+  RealUniqueArray sums(10);
+  sums[0] = nb_cell;
+  sums[1] = nb_component;
+  sums[2] = nb_mixed;
+  sums[3] = total_time - material_time;
+  sums[4] = material_time;
+  sums[5] = nb_cell * nb_cell;
+  sums[6] = nb_cell * nb_component;
+  sums[7] = nb_component * nb_component;
+  sums[8] = nb_cell * total_time;
+  sums[9] = nb_component * total_time;
+  pm->reduce(Parallel::ReduceSum,sums);
+  Real total_nb_cell = sums[0];
+  Real total_nb_component = sums[1];
+  Real total_nb_mixed = sums[2];
+  Real total_time_sum = sums[3] + sums[4];
+
+  Real cell_cost = 1.0;
+  Real component_cost = 0.0;
+  if (total_nb_cell!=0.0 && total_nb_component!=0.0){
+    if (has_material_time){
+      cell_cost = sums[3] / total_nb_cell;
+      component_cost = sums[4] / total_nb_component;
+    }
+    else{
+      // Résolution des équations normales de la régression.
+      Real det = sums[5]*sums[7] - sums[6]*sums[6];
+      bool is_valid = false;
+      if (math::abs(det)>1.0e-12*sums[5]*sums[7]){
+        cell_cost = (sums[8]*sums[7] - sums[9]*sums[6]) / det;
+        component_cost = (sums[5]*sums[9] - sums[6]*sums[8]) / det;
+        is_valid = (cell_cost>=0.0 && component_cost>=0.0);
+      }
+      if (!is_valid){
+        // Les sous-domaines ont des proportions de mailles mixtes trop
+        // proches pour distinguer les deux coûts: on considère que le
+        // coût est proportionnel au nombre de milieux et matériaux.
+        cell_cost = 0.0;
+        component_cost = total_time_sum / total_nb_component;
+      }
+    }
+  }
+  Real mixed_cell_cost = options()->mixedCellCost() * component_cost;
+
+  // Normalise pour avoir un poids moyen de 1 par maille.
+  if (total_nb_cell!=0.0){
+    Real mean_cost = (cell_cost*total_nb_cell + component_cost*total_nb_component
+                      + mixed_cell_cost*total_nb_mixed) / total_nb_cell;
+    if (mean_cost>0.0){
+      cell_cost /= mean_cost;
+      component_cost /= mean_cost;
+      mixed_cell_cost /= mean_cost;
+    }
+    else{
+      cell_cost = 1.0;
+      component_cost = 0.0;
+      mixed_cell_cost = 0.0;
+    }
+  }
+
+  info() << "Material cost model: nb_cell=" << total_nb_cell
+         << " nb_component=" << total_nb_component
+         << " nb_mixed=" << total_nb_mixed
+         << " cell_cost=" << cell_cost
+         << " component_cost=" << component_cost
+         << " mixed_cell_cost=" << mixed_cell_cost;
+
+  m_material_costs[0] = cell_cost;
+  m_material_costs[1] = component_cost;
+  m_material_costs[2] = mixed_cell_cost;
+  m_material_cost_imbalance = _computeMaterialCostImbalance();
+  info() << "Material cost imbalance before partitioning=" << m_material_cost_imbalance;
+
+  // Le coût des matériaux est ajouté aux critères existants sauf si
+  // l'option 'material-cost-only' est active.
+  ILoadBalanceMng* lb_mng = subDomain()->loadBalanceMng();
+  if (options()->materialCostOnly()){
+    info() << "Material cost: the mass and number of cells criteria are disabled (option 'material-cost-only')";
+    lb_mng->setMassAsCriterion(false);
+    lb_mng->setNbCellsAsCriterion(false);
+  }
+  lb_mng->setMaterialCost(cell_cost,component_cost,mixed_cell_cost);
+  lb_mng->setMaterialCostAsCriterion(true);
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+/*!
+ * \brief Calcule pour le sous-domaine le nombre de mailles propres, la somme
+ * sur ces mailles du nombre de milieux et de matériaux et le nombre de
+ * mailles mixtes.
+ */
+void ArcaneLoadBalanceModule::
+_computeMaterialCounts(Real& nb_cell,Real& nb_component,Real& nb_mixed)
+{
+  using namespace Materials;
+  IMesh* mesh = defaultMesh();
+  nb_cell = mesh->ownCells().size();
+  nb_component = 0.0;
+  nb_mixed = 0.0;
+  IMeshMaterialMng* mm = IMeshMaterialMng::getReference(mesh,false);
+  if (!mm)
+    return;
+  CellToAllEnvCellConverter all_env_cell_converter(mm->cellToAllEnvCellConverter());
+  ENUMERATE_CELL(icell,mesh->ownCells()){
+    AllEnvCell all_env_cell = all_env_cell_converter[icell];
+    Int32 nb_env = all_env_cell.nbEnvironment();
+    bool is_mixed = (nb_env>1);
+    nb_component += nb_env;
+    ENUMERATE_CELL_ENVCELL(ienvcell,all_env_cell){
+      Int32 nb_mat = (*ienvcell).nbMaterial();
+      nb_component += nb_mat;
+      if (nb_mat>1)
+        is_mixed = true;
+    }
+    if (is_mixed)
+      nb_mixed += 1.0;
+  }
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+/*!
+ * \brief Calcule le déséquilibre du coût des matériaux entre les
+ * sous-domaines avec les coefficients courants.
+ *
+ * Le déséquilibre est le rapport entre le coût maximal d'un sous-domaine
+ * et le coût moyen, moins 1.
+ */
+Real ArcaneLoadBalanceModule::
+_computeMaterialCostImbalance()
+{
+  IParallelMng* pm = subDomain()->parallelMng();
+  Real nb_cell = 0.0;
+  Real nb_component = 0.0;
+  Real nb_mixed = 0.0;
+  _computeMaterialCounts(nb_cell,nb_component,nb_mixed);
+  Real cost = m_material_costs[0]*nb_cell + m_material_costs[1]*nb_component
+  + m_material_costs[2]*nb_mixed;
+  Real max_cost = pm->reduce(Parallel::ReduceMax,cost);
+  Real sum_cost = pm->reduce(Parallel::ReduceSum,cost);
+  if (sum_cost<=0.0)
+    return 0.0;
+  Real mean_cost = sum_cost / static_cast<Real>(pm->commSize());
+  return (max_cost / mean_cost) - 1.0;
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+/*!
+ * \brief Vérifie le déséquilibre du coût des matériaux après un
+ * repartitionnement.
+ *
+ * Le déséquilibre est calculé avec les coefficients utilisés pour le
+ * repartitionnement. Si l'option 'check-material-cost-imbalance' est
+ * active, une erreur fatale est levée s'il n'a pas diminué.
+ */
+void ArcaneLoadBalanceModule::
+_checkMaterialCostImbalance()
+{
+  Real imbalance_before = m_material_cost_imbalance;
+  if (imbalance_before<0.0)
+    return;
+  m_material_cost_imbalance = -1.0;
+  Real imbalance_after = _computeMaterialCostImbalance();
+  info() << "Material cost imbalance before=" << imbalance_before
+         << " after=" << imbalance_after;
+  if (!options()->checkMaterialCostImbalance())
+    return;
+  // Si le déséquilibre initial est très faible, il peut légèrement augmenter
+  // à cause de la granularité des mailles.
+  const Real tolerance = 0.02;
+  if (imbalance_after>imbalance_before && imbalance_after>tolerance)
+    ARCANE_FATAL("Material cost imbalance has not decreased after partitioning before={0} after={1}",
+                 imbalance_before,imbalance_after);
+}
+
 /*---------------------------------------------------------------------------*/
 /*---------------------------------------------------------------------------*/
 
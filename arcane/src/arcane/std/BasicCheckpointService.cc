@@ -13,10 +13,12 @@
 
 #include "arcane/std/internal/BasicReader.h"
 #include "arcane/std/internal/BasicWriter.h"
+#include "arcane/std/internal/IHashDatabase.h"
 
 #include "arcane/utils/StringBuilder.h"
 #include "arcane/utils/OStringStream.h"
 #include "arcane/utils/PlatformUtils.h"
+#include "arcane/utils/Exception.h"
 
 #include "arcane/core/IXmlDocumentHolder.h"
 #include "arcane/core/IParallelMng.h"
@@ -72,6 +74,12 @@ class ArcaneBasicCheckpointService
   , m_writer(nullptr)
   , m_reader(nullptr)
   {}
+  ~ArcaneBasicCheckpointService() override
+  {
+    if (m_async_writer)
+      arcaneCallFunctionAndTerminateIfThrow([&]() { m_async_writer->waitWrite(); });
+    delete m_async_writer;
+  }
   IDataWriter* dataWriter() override { return m_writer; }
   IDataReader* dataReader() override { return m_reader; }
 
@@ -79,7 +87,9 @@ class ArcaneBasicCheckpointService
   void notifyEndWrite() override;
   void notifyBeginRead() override;
   void notifyEndRead() override;
-  void close() override {}
+  void close() override { _waitAsyncWrite(); }
+  void waitCheckpoint() override { _waitAsyncWrite(); }
+  bool isWriteInProgress() const override { return m_async_writer != nullptr; }
   String readerServiceName() const override { return "ArcaneBasicCheckpointReader"; }
 
  private:
@@ -87,9 +97,17 @@ class ArcaneBasicCheckpointService
   Integer m_write_index;
   BasicWriter* m_writer;
   BasicReader* m_reader;
+  //! Ecrivain dont l'écriture asynchrone est en cours
+  BasicWriter* m_async_writer = nullptr;
+  //! Répertoire de la base de données de hash (vide si on ne l'utilise pas)
+  String m_hash_database_directory;
 
  private:
 
+  void _endWriteHashDatabase();
+  void _removeUnreferencedHashes();
+  void _waitAsyncWrite();
+
   String _defaultFileName()
   {
     info() << "USE DEFAULT FILE NAME index=" << currentIndex();
@@ -172,6 +190,9 @@ notifyEndRead()
 void ArcaneBasicCheckpointService::
 notifyBeginWrite()
 {
+  // Attend la fin de l'écriture précédente si elle est asynchrone.
+  _waitAsyncWrite();
+
   auto open_mode = BasicReaderWriterCommon::OpenModeAppend;
   Integer write_index = checkpointTimes().size();
   --write_index;
@@ -188,17 +209,29 @@ notifyBeginWrite()
 
   Int32 version = 2;
   Ref<IDataCompressor> data_compressor;
+  Int64 hash_database_chunk_size = 0;
+  Int64 data_compressor_chunk_size = 0;
+  bool is_asynchronous_write = false;
   if (options()) {
+    is_asynchronous_write = options()->asynchronousWrite();
     version = options()->formatVersion();
     // N'utilise la compression qu'à partir de la version 3 car cela est
     // incompatible avec les anciennes versions
     if (version >= 3) {
       data_compressor = options()->dataCompressor.instanceRef();
+      data_compressor_chunk_size = options()->dataCompressorChunkSize();
+    }
+    m_hash_database_directory = options()->hashDatabaseDirectory();
+    if (!m_hash_database_directory.empty()) {
+      if (version < 3)
+        ARCANE_FATAL("Option 'hash-database-directory' requires 'format-version' 3 or greater (version={0})", version);
+      hash_database_chunk_size = options()->hashDatabaseChunkSize();
     }
   }
 
   info() << "Writing checkpoint with 'ArcaneBasicCheckpointService'"
          << " version=" << version
+         << " asynchronous=" << is_asynchronous_write
          << " filename='" << filename << "'\n";
 
   platform::recursiveCreateDirectory(filename);
@@ -209,6 +242,10 @@ notifyBeginWrite()
   want_parallel = false;
   m_writer = new BasicWriter(app, pm, filename, open_mode, version, want_parallel);
   m_writer->setDataCompressor(data_compressor);
+  m_writer->setDataCompressorChunkSize(data_compressor_chunk_size);
+  if (!m_hash_database_directory.empty())
+    m_writer->setHashDatabase(m_hash_database_directory, hash_database_chunk_size);
+  m_writer->setAsynchronousWrite(is_asynchronous_write);
   m_writer->initialize();
 }
 
@@ -225,8 +262,106 @@ notifyEndWrite()
   ostr() << "/>\n";
   setReaderMetaData(ostr.str());
   ++m_write_index;
+  if (options() && options()->asynchronousWrite()) {
+    // L'écrivain sera détruit lorsque l'écriture sera terminée.
+    m_async_writer = m_writer;
+    m_writer = nullptr;
+    return;
+  }
   delete m_writer;
   m_writer = nullptr;
+  _endWriteHashDatabase();
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+/*!
+ * \brief Attend la fin de l'écriture asynchrone en cours s'il y en a une.
+ *
+ * Relance l'exception éventuelle survenue lors de l'écriture. Cette méthode
+ * est collective: si l'écriture a échoué sur un des rangs, tous les rangs
+ * lèvent une exception pour ne pas rester bloqués dans les opérations
+ * collectives qui suivent.
+ */
+void ArcaneBasicCheckpointService::
+_waitAsyncWrite()
+{
+  if (!m_async_writer)
+    return;
+  BasicWriter* writer = m_async_writer;
+  m_async_writer = nullptr;
+  Real begin_time = platform::getRealTime();
+  std::exception_ptr write_error;
+  try {
+    writer->waitWrite();
+  }
+  catch (...) {
+    write_error = std::current_exception();
+  }
+  delete writer;
+  IParallelMng* pm = subDomain()->parallelMng();
+  Int32 nb_error = pm->reduce(Parallel::ReduceSum, (write_error) ? 1 : 0);
+  if (write_error)
+    std::rethrow_exception(write_error);
+  if (nb_error != 0)
+    ARCANE_FATAL("Asynchronous checkpoint write failed on {0} other rank(s)", nb_error);
+  info() << "Waiting for asynchronous checkpoint write time=" << (platform::getRealTime() - begin_time) << " (s)";
+  _endWriteHashDatabase();
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+/*!
+ * \brief Opérations sur la base de données de hash après une écriture.
+ *
+ * Supprime les blocs non utilisés si l'option 'hash-database-garbage-collect'
+ * est active.
+ */
+void ArcaneBasicCheckpointService::
+_endWriteHashDatabase()
+{
+  if (m_hash_database_directory.empty())
+    return;
+  if (options()->hashDatabaseGarbageCollect())
+    _removeUnreferencedHashes();
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+/*!
+ * \brief Supprime de la base de données de hash les blocs non utilisés.
+ *
+ * Les blocs utilisés sont ceux présents dans les manifestes des protections
+ * existantes, c'est à dire celles dont l'indice est inférieur au nombre
+ * de protections. Les protections d'indice supérieur proviennent d'une
+ * exécution précédente qui a été reprise à partir d'une protection
+ * antérieure et seront écrasées.
+ *
+ * La base de données ne doit donc pas être partagée avec d'autres exécutions.
+ */
+void ArcaneBasicCheckpointService::
+_removeUnreferencedHashes()
+{
+  IParallelMng* pm = subDomain()->parallelMng();
+  // Avec la réplication, les réplicas partagent la base de données mais
+  // écrivent dans des protections différentes.
+  if (pm->replication()->hasReplication()) {
+    info() << "Removing unreferenced hashes is not available with replication";
+    return;
+  }
+  // Il faut que tous les rangs aient écrit leur manifeste.
+  pm->barrier();
+  if (pm->isMasterIO()) {
+    std::set<String> referenced_hashes;
+    Integer nb_checkpoint = checkpointTimes().size();
+    for (Integer i = 0; i < nb_checkpoint; ++i)
+      BasicWriter::readHashManifests(fileName() + "_n" + i, referenced_hashes);
+    info() << "Removing unreferenced hashes nb_checkpoint=" << nb_checkpoint
+           << " nb_referenced=" << referenced_hashes.size();
+    auto hash_database = createFileHashDatabase(traceMng(), m_hash_database_directory);
+    hash_database->removeUnreferencedValues(referenced_hashes);
+  }
+  pm->barrier();
 }
 
 /*---------------------------------------------------------------------------*/
@@ -16,6 +16,8 @@
 #include "arcane/utils/PlatformUtils.h"
 #include "arcane/utils/JSONReader.h"
 #include "arcane/utils/Ref.h"
+#include "arcane/utils/ValueConvert.h"
+#include "arcane/utils/FatalErrorException.h"
 
 #include "arcane/core/IParallelMng.h"
 #include "arcane/core/IIOMng.h"
@@ -25,6 +27,7 @@
 #include "arcane/core/SerializeBuffer.h"
 
 #include "arcane/std/internal/ParallelDataReader.h"
+#include "arcane/std/internal/IHashDatabase.h"
 
 /*---------------------------------------------------------------------------*/
 /*---------------------------------------------------------------------------*/
@@ -72,6 +75,9 @@ initialize()
   String data_compressor_name;
   String hash_algorithm_name;
   String comparison_hash_algorithm_name;
+  String hash_database_directory;
+  Int64 hash_database_chunk_size = 0;
+  Int64 data_compressor_chunk_size = 0;
   if (has_db_file) {
     UniqueArray<Byte> bytes;
     pm->ioMng()->collectiveRead(db_filename, bytes, false);
@@ -82,13 +88,27 @@ initialize()
     m_version = jv_arcane_db.expectedChild("Version").valueAsInt32();
     m_nb_written_part = jv_arcane_db.expectedChild("NbPart").valueAsInt32();
     data_compressor_name = jv_arcane_db.child("DataCompressor").value();
+    JSONValue jv_data_compressor_chunk_size = jv_arcane_db.child("DataCompressorChunkSize");
+    if (!jv_data_compressor_chunk_size.null())
+      data_compressor_chunk_size = jv_data_compressor_chunk_size.valueAsInt64();
     hash_algorithm_name = jv_arcane_db.child("HashAlgorithm").value();
     comparison_hash_algorithm_name = jv_arcane_db.child("ComparisonHashAlgorithm").value();
+    JSONValue jv_hash_database_directory = jv_arcane_db.child("HashDatabaseDirectory");
+    if (!jv_hash_database_directory.null()) {
+      hash_database_directory = jv_hash_database_directory.value();
+      hash_database_chunk_size = jv_arcane_db.expectedChild("HashDatabaseChunkSize").valueAsInt64();
+    }
     info() << "**--** Begin read using database version=" << m_version
            << " nb_part=" << m_nb_written_part
            << " compressor=" << data_compressor_name
+           << " compressor_chunk_size=" << data_compressor_chunk_size
            << " hash_algorithm=" << hash_algorithm_name
            << " comparison_hash_algorithm=" << comparison_hash_algorithm_name;
+    // Pour test, vérifie la taille des blocs de compression lue dans 'arcane_acr_db.json'.
+    if (auto v = Convert::Type<Int64>::tryParseFromEnvironment("ARCANE_TEST_CHECK_DATA_COMPRESSOR_CHUNK_SIZE", true)) {
+      if (data_compressor_chunk_size != v.value())
+        ARCANE_FATAL("Bad data compressor chunk size v={0} expected={1}", data_compressor_chunk_size, v.value());
+    }
   }
   else {
     // Ancien format
@@ -118,11 +138,18 @@ initialize()
     if (!data_compressor_name.empty()) {
       Ref<IDataCompressor> dc = _createDeflater(m_application, data_compressor_name);
       m_forced_rank_to_read_text_reader->setDataCompressor(dc);
+      m_forced_rank_to_read_text_reader->setCompressionChunkSize(data_compressor_chunk_size);
     }
     if (!hash_algorithm_name.empty()) {
       Ref<IHashAlgorithm> v = _createHashAlgorithm(m_application, hash_algorithm_name);
       m_forced_rank_to_read_text_reader->setHashAlgorithm(v);
     }
+    if (!hash_database_directory.empty()) {
+      info() << "Using hash database at location '" << hash_database_directory << "'"
+             << " chunk_size=" << hash_database_chunk_size;
+      auto hash_database = createFileHashDatabase(traceMng(), hash_database_directory);
+      m_forced_rank_to_read_text_reader->setHashDatabase(hash_database, hash_database_chunk_size);
+    }
     if (!comparison_hash_algorithm_name.empty()) {
       Ref<IHashAlgorithm> v = _createHashAlgorithm(m_application, comparison_hash_algorithm_name);
       m_comparison_hash_algorithm = v;
@@ -414,7 +441,11 @@ _readOwnMetaDataAndCreateReader(Int32 rank)
       // Il faut que ce lecteur ait le même gestionnaire de compression
       // que celui déjà créé
       text_reader->setDataCompressor(m_forced_rank_to_read_text_reader->dataCompressor());
+      text_reader->setCompressionChunkSize(m_forced_rank_to_read_text_reader->compressionChunkSize());
       text_reader->setHashAlgorithm(m_forced_rank_to_read_text_reader->hashAlgorithm());
+      if (m_forced_rank_to_read_text_reader->hashDatabase().get())
+        text_reader->setHashDatabase(m_forced_rank_to_read_text_reader->hashDatabase(),
+                                     m_forced_rank_to_read_text_reader->hashDatabaseChunkSize());
     }
   }
 
@@ -58,6 +58,16 @@ _getArcaneDBFile(const String& path, Int32 rank)
   return filename;
 }
 
+String BasicReaderWriterCommon::
+_getHashManifestFile(const String& path, Int32 rank)
+{
+  StringBuilder filename = path;
+  filename += "/arcane_hash_manifest_n";
+  filename += rank;
+  filename += ".txt";
+  return filename;
+}
+
 String BasicReaderWriterCommon::
 _getBasicVariableFile(Int32 version, const String& path, Int32 rank)
 {
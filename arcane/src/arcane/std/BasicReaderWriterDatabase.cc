@@ -24,14 +24,18 @@
 #include "arcane/utils/SmallArray.h"
 #include "arcane/utils/IHashAlgorithm.h"
 #include "arcane/utils/ITraceMng.h"
+#include "arcane/utils/Math.h"
+#include "arcane/utils/ParallelLoopOptions.h"
 
 #include "arcane/ArcaneException.h"
+#include "arcane/core/Concurrency.h"
 
 #include "arcane/std/internal/TextReader2.h"
 #include "arcane/std/internal/TextWriter2.h"
 #include "arcane/std/internal/IHashDatabase.h"
 
 #include <fstream>
+#include <cstring>
 #include <map>
 
 /*---------------------------------------------------------------------------*/
@@ -283,14 +287,132 @@ class BasicReaderWriterDatabaseCommon
     return x->second;
   }
 
+ protected:
+
+  void _compressChunks(Span<const std::byte> values, Array<std::byte>& compressed_values);
+  void _decompressChunks(const String& key, Span<const std::byte> compressed_values,
+                         Span<std::byte> values);
+
  public:
 
   std::map<String, DataInfo> m_data_infos;
   Ref<IDataCompressor> m_data_compressor;
   Ref<IHashAlgorithm> m_hash_algorithm;
   Ref<IHashDatabase> m_hash_database;
+  //! Taille des blocs pour la base de données de hash (0 si pas de découpage)
+  Int64 m_hash_chunk_size = 0;
+  //! Taille des blocs pour la compression (0 si pas de découpage)
+  Int64 m_compression_chunk_size = 0;
 };
 
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+/*!
+ * \brief Compresse \a values par blocs de m_compression_chunk_size octets.
+ *
+ * Chaque bloc est compressé indépendamment des autres et les blocs sont
+ * compressés en parallèle. Le résultat contient un index suivi des blocs
+ * compressés :
+ * - la taille d'un bloc non compressé (Int64),
+ * - le nombre de blocs (Int64),
+ * - la taille compressée de chaque bloc (Int64),
+ * - les valeurs compressées de chaque bloc.
+ *
+ * Toute modification de ce format doit être reportée dans _decompressChunks().
+ */
+void BasicReaderWriterDatabaseCommon::
+_compressChunks(Span<const std::byte> values, Array<std::byte>& compressed_values)
+{
+  IDataCompressor* d = m_data_compressor.get();
+  const Int64 chunk_size = m_compression_chunk_size;
+  const Int64 nb_value = values.size();
+  const Int32 nb_chunk = CheckedConvert::toInt32((nb_value + chunk_size - 1) / chunk_size);
+
+  UniqueArray<UniqueArray<std::byte>> compressed_chunks(nb_chunk);
+  ParallelLoopOptions options;
+  options.setGrainSize(1);
+  arcaneParallelFor(0, nb_chunk, options, [&](Int32 begin, Int32 size) {
+    for (Int32 i = begin; i < (begin + size); ++i) {
+      Int64 chunk_begin = i * chunk_size;
+      Span<const std::byte> chunk = values.subSpan(chunk_begin, math::min(chunk_size, nb_value - chunk_begin));
+      d->compress(chunk, compressed_chunks[i]);
+    }
+  });
+
+  UniqueArray<Int64> chunk_index(2 + nb_chunk);
+  chunk_index[0] = chunk_size;
+  chunk_index[1] = nb_chunk;
+  Int64 total_size = chunk_index.largeSize() * static_cast<Int64>(sizeof(Int64));
+  for (Int32 i = 0; i < nb_chunk; ++i) {
+    Int64 compressed_chunk_size = compressed_chunks[i].largeSize();
+    chunk_index[2 + i] = compressed_chunk_size;
+    total_size += compressed_chunk_size;
+  }
+
+  compressed_values.resize(total_size);
+  Span<std::byte> index_bytes = asWritableBytes(chunk_index.span());
+  std::memcpy(compressed_values.data(), index_bytes.data(), index_bytes.size());
+  Int64 offset = index_bytes.size();
+  for (Int32 i = 0; i < nb_chunk; ++i) {
+    Span<const std::byte> chunk = compressed_chunks[i];
+    std::memcpy(compressed_values.data() + offset, chunk.data(), chunk.size());
+    offset += chunk.size();
+  }
+  info(5) << "COMPRESS_CHUNKS nb_chunk=" << nb_chunk << " len=" << nb_value
+          << " compressed_len=" << total_size;
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+/*!
+ * \brief Décompresse en parallèle les blocs compressés par _compressChunks().
+ */
+void BasicReaderWriterDatabaseCommon::
+_decompressChunks(const String& key, Span<const std::byte> compressed_values, Span<std::byte> values)
+{
+  IDataCompressor* d = m_data_compressor.get();
+  const Int64 int64_size = static_cast<Int64>(sizeof(Int64));
+  const Int64 compressed_size = compressed_values.size();
+  const Int64 nb_value = values.size();
+
+  Int64 chunk_header[2] = { 0, 0 };
+  if (compressed_size < (2 * int64_size))
+    ARCANE_FATAL("Bad compressed chunk index for key '{0}' compressed_len={1}", key, compressed_size);
+  std::memcpy(chunk_header, compressed_values.data(), 2 * int64_size);
+  const Int64 chunk_size = chunk_header[0];
+  const Int64 nb_chunk = chunk_header[1];
+  if (chunk_size <= 0 || nb_chunk != ((nb_value + chunk_size - 1) / chunk_size))
+    ARCANE_FATAL("Bad compressed chunk information for key '{0}' chunk_size={1} nb_chunk={2} len={3}",
+                 key, chunk_size, nb_chunk, nb_value);
+
+  const Int64 index_size = (2 + nb_chunk) * int64_size;
+  if (compressed_size < index_size)
+    ARCANE_FATAL("Bad compressed chunk index for key '{0}' compressed_len={1}", key, compressed_size);
+  UniqueArray<Int64> chunk_sizes(nb_chunk);
+  std::memcpy(chunk_sizes.data(), compressed_values.data() + (2 * int64_size), nb_chunk * int64_size);
+
+  // Calcule la position de chaque bloc dans \a compressed_values
+  UniqueArray<Int64> chunk_offsets(nb_chunk);
+  Int64 offset = index_size;
+  for (Int64 i = 0; i < nb_chunk; ++i) {
+    chunk_offsets[i] = offset;
+    offset += chunk_sizes[i];
+  }
+  if (offset != compressed_size)
+    ARCANE_FATAL("Bad compressed size for key '{0}' expected={1} current={2}", key, compressed_size, offset);
+
+  ParallelLoopOptions options;
+  options.setGrainSize(1);
+  arcaneParallelFor(0, CheckedConvert::toInt32(nb_chunk), options, [&](Int32 begin, Int32 size) {
+    for (Int32 i = begin; i < (begin + size); ++i) {
+      Int64 chunk_begin = i * chunk_size;
+      Span<std::byte> chunk = values.subSpan(chunk_begin, math::min(chunk_size, nb_value - chunk_begin));
+      d->decompress(compressed_values.subSpan(chunk_offsets[i], chunk_sizes[i]), chunk);
+    }
+  });
+  info(5) << "DECOMPRESS_CHUNKS key=" << key << " nb_chunk=" << nb_chunk << " len=" << nb_value;
+}
+
 /*---------------------------------------------------------------------------*/
 /*---------------------------------------------------------------------------*/
 
@@ -336,10 +458,12 @@ class KeyValueTextWriter::Impl
   TextWriter2 m_writer;
   Int32 m_version;
   Hasher m_hasher;
+  std::set<String> m_written_hashes;
 
  private:
 
   void _write2(const String& key, Span<const std::byte> values);
+  void _writeChunks(const String& key, Span<const std::byte> values);
 };
 
 /*---------------------------------------------------------------------------*/
@@ -466,7 +590,10 @@ write(const String& key, Span<const std::byte> values)
   Int64 len = values.size();
   if (d && len > d->minCompressSize()) {
     UniqueArray<std::byte> compressed_values;
-    m_data_compressor->compress(values, compressed_values);
+    if (m_compression_chunk_size > 0)
+      _compressChunks(values, compressed_values);
+    else
+      m_data_compressor->compress(values, compressed_values);
     Int64 compressed_size = compressed_values.largeSize();
     m_writer.write(asBytes(Span<const Int64>(&compressed_size, 1)));
     _write2(key, compressed_values);
@@ -486,6 +613,11 @@ _write2(const String& key, Span<const std::byte> values)
     if (!hash_algo)
       ARCANE_FATAL("Can not use hash database without hash algorithm");
 
+    if (m_hash_chunk_size > 0) {
+      _writeChunks(key, values);
+      return;
+    }
+
     SmallArray<Byte, 1024> hash_result;
     m_hasher.computeHash(values, hash_result);
     String hash_value = Convert::toHexaString(hash_result);
@@ -495,6 +627,7 @@ _write2(const String& key, Span<const std::byte> values)
     args.setKey(key);
 
     m_hash_database->writeValues(args, result);
+    m_written_hashes.insert(hash_value);
     info(5) << "WRITE_KW_HASH key=" << key << " hash=" << hash_value << " len=" << values.size();
     m_writer.write(asBytes(hash_result));
   }
@@ -502,6 +635,43 @@ _write2(const String& key, Span<const std::byte> values)
     m_writer.write(values);
 }
 
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+/*!
+ * \brief Ecrit les valeurs découpées en blocs dans la base de données de hash.
+ *
+ * Dans le fichier, on écrit la taille d'un bloc, le nombre de blocs puis
+ * le hash de chaque bloc. Le dernier bloc peut être plus petit que les autres.
+ * Comme la base de données n'écrit pas un bloc déjà présent, seuls les blocs
+ * modifiés depuis la dernière protection sont réellement écrits.
+ */
+void KeyValueTextWriter::Impl::
+_writeChunks(const String& key, Span<const std::byte> values)
+{
+  const Int64 chunk_size = m_hash_chunk_size;
+  const Int64 nb_value = values.size();
+  const Int64 nb_chunk = (nb_value + chunk_size - 1) / chunk_size;
+  const Int64 chunk_header[2] = { chunk_size, nb_chunk };
+  m_writer.write(asBytes(Span<const Int64>(chunk_header, 2)));
+
+  SmallArray<Byte, 1024> hash_result;
+  for (Int64 i = 0; i < nb_chunk; ++i) {
+    Int64 begin = i * chunk_size;
+    Span<const std::byte> chunk = values.subSpan(begin, math::min(chunk_size, nb_value - begin));
+    hash_result.clear();
+    m_hasher.computeHash(chunk, hash_result);
+    String hash_value = Convert::toHexaString(hash_result);
+
+    HashDatabaseWriteResult result;
+    HashDatabaseWriteArgs args(chunk, hash_value);
+    args.setKey(key);
+    m_hash_database->writeValues(args, result);
+    m_written_hashes.insert(hash_value);
+    m_writer.write(asBytes(hash_result));
+  }
+  info(5) << "WRITE_KW_HASH_CHUNKS key=" << key << " nb_chunk=" << nb_chunk << " len=" << nb_value;
+}
+
 /*---------------------------------------------------------------------------*/
 /*---------------------------------------------------------------------------*/
 
@@ -551,6 +721,43 @@ hashAlgorithm() const
 /*---------------------------------------------------------------------------*/
 /*---------------------------------------------------------------------------*/
 
+void KeyValueTextWriter::
+setHashDatabase(Ref<IHashDatabase> v, Int64 chunk_size)
+{
+  m_p->m_hash_database = v;
+  m_p->m_hash_chunk_size = chunk_size;
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+const std::set<String>& KeyValueTextWriter::
+writtenHashes() const
+{
+  return m_p->m_written_hashes;
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+void KeyValueTextWriter::
+setCompressionChunkSize(Int64 chunk_size)
+{
+  m_p->m_compression_chunk_size = chunk_size;
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+Int64 KeyValueTextWriter::
+compressionChunkSize() const
+{
+  return m_p->m_compression_chunk_size;
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
 Int64 KeyValueTextWriter::
 fileOffset()
 {
@@ -637,6 +844,7 @@ class KeyValueTextReader::Impl
   void _readDirect(Int64 offset, Span<std::byte> bytes);
   void _setFileOffset(const String& key_name);
   void _read2(const String& key_name, Span<std::byte> values);
+  void _readChunks(const String& key_name, Span<std::byte> values, Int32 hash_size);
 
  public:
 
@@ -817,7 +1025,10 @@ read(const String& key, Span<std::byte> values)
     m_reader.read(asWritableBytes(Span<Int64>(&compressed_size, 1)));
     compressed_values.resize(compressed_size);
     _read2(key, compressed_values);
-    m_data_compressor->decompress(compressed_values, values);
+    if (m_compression_chunk_size > 0)
+      _decompressChunks(key, compressed_values, values);
+    else
+      m_data_compressor->decompress(compressed_values, values);
   }
   else {
     _read2(key, values);
@@ -835,6 +1046,10 @@ _read2(const String& key, Span<std::byte> values)
     if (!hash_algo)
       ARCANE_FATAL("Can not use hash database without hash algorithm");
     Int32 hash_size = hash_algo->hashSize();
+    if (m_hash_chunk_size > 0) {
+      _readChunks(key, values, hash_size);
+      return;
+    }
     SmallArray<Byte, 1024> hash_as_bytes;
     hash_as_bytes.resize(hash_size);
     m_reader.read(asWritableBytes(hash_as_bytes));
@@ -850,6 +1065,35 @@ _read2(const String& key, Span<std::byte> values)
 /*---------------------------------------------------------------------------*/
 /*---------------------------------------------------------------------------*/
 
+void KeyValueTextReader::Impl::
+_readChunks(const String& key, Span<std::byte> values, Int32 hash_size)
+{
+  // Le format est décrit dans KeyValueTextWriter::Impl::_writeChunks().
+  Int64 chunk_header[2] = { 0, 0 };
+  m_reader.read(asWritableBytes(Span<Int64>(chunk_header, 2)));
+  const Int64 chunk_size = chunk_header[0];
+  const Int64 nb_chunk = chunk_header[1];
+  const Int64 nb_value = values.size();
+  if (chunk_size <= 0 || nb_chunk != ((nb_value + chunk_size - 1) / chunk_size))
+    ARCANE_FATAL("Bad chunk information for key '{0}' chunk_size={1} nb_chunk={2} len={3}",
+                 key, chunk_size, nb_chunk, nb_value);
+
+  SmallArray<Byte, 1024> hash_as_bytes;
+  hash_as_bytes.resize(hash_size);
+  for (Int64 i = 0; i < nb_chunk; ++i) {
+    m_reader.read(asWritableBytes(hash_as_bytes));
+    String hash_value = Convert::toHexaString(hash_as_bytes);
+    Int64 begin = i * chunk_size;
+    Span<std::byte> chunk = values.subSpan(begin, math::min(chunk_size, nb_value - begin));
+    HashDatabaseReadArgs args(hash_value, chunk);
+    m_hash_database->readValues(args);
+  }
+  info(5) << "READ_KW_HASH_CHUNKS key=" << key << " nb_chunk=" << nb_chunk << " expected_len=" << nb_value;
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
 void KeyValueTextReader::Impl::
 _setFileOffset(const String& key_name)
 {
@@ -921,6 +1165,52 @@ hashAlgorithm() const
 /*---------------------------------------------------------------------------*/
 /*---------------------------------------------------------------------------*/
 
+void KeyValueTextReader::
+setHashDatabase(Ref<IHashDatabase> v, Int64 chunk_size)
+{
+  m_p->m_hash_database = v;
+  m_p->m_hash_chunk_size = chunk_size;
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+Ref<IHashDatabase> KeyValueTextReader::
+hashDatabase() const
+{
+  return m_p->m_hash_database;
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+Int64 KeyValueTextReader::
+hashDatabaseChunkSize() const
+{
+  return m_p->m_hash_chunk_size;
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+void KeyValueTextReader::
+setCompressionChunkSize(Int64 chunk_size)
+{
+  m_p->m_compression_chunk_size = chunk_size;
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+Int64 KeyValueTextReader::
+compressionChunkSize() const
+{
+  return m_p->m_compression_chunk_size;
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
 void KeyValueTextReader::
 readIntegers(const String& key, Span<Integer> values)
 {
@@ -21,6 +21,8 @@
 #include "arcane/utils/MemoryView.h"
 #include "arcane/utils/Ref.h"
 #include "arcane/utils/IHashAlgorithm.h"
+#include "arcane/utils/Exception.h"
+#include "arcane/utils/ValueConvert.h"
 
 #include "arcane/core/IParallelMng.h"
 #include "arcane/core/ItemGroup.h"
@@ -30,6 +32,14 @@
 #include "arcane/core/internal/IVariableInternal.h"
 
 #include "arcane/std/internal/ParallelDataWriter.h"
+#include "arcane/std/internal/IHashDatabase.h"
+
+#include <filesystem>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <deque>
+#include <exception>
 
 /*---------------------------------------------------------------------------*/
 /*---------------------------------------------------------------------------*/
@@ -37,6 +47,102 @@
 namespace Arcane::impl
 {
 
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+/*!
+ * \brief File de fonctions d'écriture exécutées par un thread dédié.
+ *
+ * Les fonctions sont exécutées dans l'ordre où elles ont été ajoutées.
+ * Si une fonction lève une exception, les fonctions suivantes ne sont
+ * pas exécutées et l'exception est relancée lors de l'appel à wait().
+ */
+class BasicWriter::AsyncWriteQueue
+{
+ public:
+
+  AsyncWriteQueue()
+  : m_thread([this] { _run(); })
+  {}
+
+  ~AsyncWriteQueue()
+  {
+    {
+      std::unique_lock<std::mutex> lock(m_mutex);
+      m_is_stopping = true;
+    }
+    m_condition.notify_all();
+    m_thread.join();
+  }
+
+ public:
+
+  void add(std::function<void()> func)
+  {
+    {
+      std::unique_lock<std::mutex> lock(m_mutex);
+      m_functions.push_back(std::move(func));
+    }
+    m_condition.notify_all();
+  }
+
+  void wait()
+  {
+    std::exception_ptr error;
+    {
+      std::unique_lock<std::mutex> lock(m_mutex);
+      m_condition.wait(lock, [this] { return m_functions.empty() && !m_is_running; });
+      std::swap(error, m_error);
+    }
+    if (error)
+      std::rethrow_exception(error);
+  }
+
+ private:
+
+  void _run()
+  {
+    std::unique_lock<std::mutex> lock(m_mutex);
+    for (;;) {
+      m_condition.wait(lock, [this] { return m_is_stopping || !m_functions.empty(); });
+      if (m_functions.empty())
+        return;
+      std::function<void()> func = std::move(m_functions.front());
+      m_functions.pop_front();
+      bool has_error = static_cast<bool>(m_error);
+      m_is_running = true;
+      lock.unlock();
+      std::exception_ptr error;
+      if (!has_error) {
+        try {
+          func();
+        }
+        catch (...) {
+          error = std::current_exception();
+        }
+      }
+      // Détruit la fonction (et donc les valeurs recopiées) sans verrou.
+      func = {};
+      lock.lock();
+      if (error && !m_error)
+        m_error = error;
+      m_is_running = false;
+      m_condition.notify_all();
+    }
+  }
+
+ private:
+
+  std::mutex m_mutex;
+  std::condition_variable m_condition;
+  std::deque<std::function<void()>> m_functions;
+  std::exception_ptr m_error;
+  bool m_is_running = false;
+  bool m_is_stopping = false;
+  // Doit être le dernier champ pour que les autres soient initialisés
+  // avant le démarrage du thread.
+  std::thread m_thread;
+};
+
 /*---------------------------------------------------------------------------*/
 /*---------------------------------------------------------------------------*/
 
@@ -52,6 +158,43 @@ BasicWriter(IApplication* app, IParallelMng* pm, const String& path,
 /*---------------------------------------------------------------------------*/
 /*---------------------------------------------------------------------------*/
 
+BasicWriter::
+~BasicWriter()
+{
+  // Les écritures asynchrones doivent être terminées avant de détruire
+  // les écrivains.
+  if (m_async_write_queue.get())
+    arcaneCallFunctionAndTerminateIfThrow([&]() { waitWrite(); });
+  m_async_write_queue = nullptr;
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+void BasicWriter::
+waitWrite()
+{
+  if (m_async_write_queue.get())
+    m_async_write_queue->wait();
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+/*!
+ * \brief Exécute \a func ou l'ajoute à la file des écritures asynchrones.
+ */
+void BasicWriter::
+_addWriteFunction(std::function<void()> func)
+{
+  if (m_async_write_queue.get())
+    m_async_write_queue->add(std::move(func));
+  else
+    func();
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
 void BasicWriter::
 initialize()
 {
@@ -79,6 +222,19 @@ initialize()
     }
   }
 
+  // Permet aussi de surcharger la taille des blocs pour la compression
+  if (auto v = Convert::Type<Int64>::tryParseFromEnvironment("ARCANE_DEFLATER_CHUNK_SIZE", true)) {
+    m_data_compressor_chunk_size = v.value();
+    info() << "Use data_compressor chunk size from environment variable ARCANE_DEFLATER_CHUNK_SIZE size="
+           << m_data_compressor_chunk_size;
+  }
+  if (m_data_compressor.get() && m_data_compressor_chunk_size > 0) {
+    if (m_version < 3)
+      ARCANE_FATAL("Chunked compression is only available with version 3 or greater (version={0})", m_version);
+    info() << "Using chunked compression chunk_size=" << m_data_compressor_chunk_size;
+    m_text_writer->setCompressionChunkSize(m_data_compressor_chunk_size);
+  }
+
   // Idem pour le service de calcul de hash
   if (!m_hash_algorithm.get()) {
     String hash_algorithm_name = platform::getEnvironmentVariable("ARCANE_HASHALGORITHM");
@@ -92,6 +248,17 @@ initialize()
     m_text_writer->setHashAlgorithm(v);
   }
 
+  if (!m_hash_database_directory.empty()) {
+    if (m_version < 3)
+      ARCANE_FATAL("Hash database is only available with version 3 or greater (version={0})", m_version);
+    if (m_hash_database_chunk_size <= 0)
+      ARCANE_FATAL("Invalid chunk size '{0}' for hash database", m_hash_database_chunk_size);
+    info() << "Using hash database at location '" << m_hash_database_directory << "'"
+           << " chunk_size=" << m_hash_database_chunk_size;
+    auto hash_database = createFileHashDatabase(traceMng(), m_hash_database_directory);
+    m_text_writer->setHashDatabase(hash_database, m_hash_database_chunk_size);
+  }
+
   // Pour test, permet de spécifier un service pour le calcul du hash global.
   if (!m_compare_hash_algorithm.get()) {
     String algo_name = platform::getEnvironmentVariable("ARCANE_COMPAREHASHALGORITHM");
@@ -104,6 +271,10 @@ initialize()
   }
 
   m_global_writer = new BasicGenericWriter(m_application, m_version, m_text_writer);
+  if (m_is_asynchronous_write) {
+    info() << "Using asynchronous write";
+    m_async_write_queue = new AsyncWriteQueue();
+  }
   if (m_verbose_level > 0)
     info() << "** OPEN MODE = " << m_open_mode;
 }
@@ -163,18 +334,37 @@ _directWriteVal(IVariable* var, IData* data)
       const String& gname = group.name();
       String group_full_name = item_family->fullName() + "_" + gname;
       _fillUniqueIds(group, wanted_unique_ids);
-      if (m_is_save_values)
-        m_global_writer->writeItemGroup(group_full_name, written_unique_ids, wanted_unique_ids.view());
+      if (m_is_save_values) {
+        if (m_async_write_queue.get()) {
+          // Recopie les uniqueId() car ils sont écrits de manière asynchrone.
+          _addWriteFunction([this, group_full_name, written_uids = UniqueArray<Int64>(written_unique_ids),
+                             wanted_uids = std::move(wanted_unique_ids)]() {
+            m_global_writer->writeItemGroup(group_full_name, written_uids, wanted_uids);
+          });
+        }
+        else
+          m_global_writer->writeItemGroup(group_full_name, written_unique_ids, wanted_unique_ids.view());
+      }
       m_written_groups.insert(group);
     }
   }
 
-  Ref<ISerializedData> sdata(write_data->createSerializedDataRef(false));
   String compare_hash;
   if (is_mesh_variable) {
     compare_hash = _computeCompareHash(var, write_data);
   }
-  m_global_writer->writeData(var->fullName(), sdata.get(), compare_hash, m_is_save_values);
+  // En mode asynchrone, il faut recopier les valeurs car la variable peut
+  // être modifiée avant la fin de l'écriture. Ce n'est pas nécessaire si
+  // les valeurs ont déjà été recopiées pour le tri.
+  if (m_async_write_queue.get() && m_is_save_values && !allocated_write_data.get()) {
+    allocated_write_data = write_data->cloneRef();
+    write_data = allocated_write_data.get();
+  }
+  Ref<ISerializedData> sdata(write_data->createSerializedDataRef(false));
+  _addWriteFunction([this, var_full_name = var->fullName(), sdata, compare_hash,
+                     allocated_write_data, is_save_values = m_is_save_values]() {
+    m_global_writer->writeData(var_full_name, sdata.get(), compare_hash, is_save_values);
+  });
 }
 
 /*---------------------------------------------------------------------------*/
@@ -222,11 +412,13 @@ setMetaData(const String& meta_data)
   // Dans la version 3, les méta-données de la protection sont dans la
   // base de données.
   if (m_version >= 3) {
-    Span<const Byte> bytes = meta_data.utf8();
-    Int64 length = bytes.length();
-    String key_name = "Global:CheckpointMetadata";
-    m_text_writer->setExtents(key_name, Int64ConstArrayView(1, &length));
-    m_text_writer->write(key_name, asBytes(bytes));
+    _addWriteFunction([this, meta_data]() {
+      Span<const Byte> bytes = meta_data.utf8();
+      Int64 length = bytes.length();
+      String key_name = "Global:CheckpointMetadata";
+      m_text_writer->setExtents(key_name, Int64ConstArrayView(1, &length));
+      m_text_writer->write(key_name, asBytes(bytes));
+    });
   }
   else {
     Int32 my_rank = m_parallel_mng->commRank();
@@ -275,6 +467,8 @@ _endWriteV3()
       }
       jsw.write("DataCompressor", data_compressor_name);
       jsw.write("DataCompressorMinSize", String::fromNumber(data_compressor_min_size));
+      if (m_data_compressor.get() && m_data_compressor_chunk_size > 0)
+        jsw.write("DataCompressorChunkSize", m_data_compressor_chunk_size);
 
       // Sauve le nom de l'algorithme de hash
       {
@@ -291,6 +485,12 @@ _endWriteV3()
           name = m_compare_hash_algorithm->name();
         jsw.write("ComparisonHashAlgorithm", name);
       }
+
+      // Sauve les informations sur la base de données de hash
+      if (!m_hash_database_directory.empty()) {
+        jsw.write("HashDatabaseDirectory", m_hash_database_directory);
+        jsw.write("HashDatabaseChunkSize", m_hash_database_chunk_size);
+      }
     }
   }
 
@@ -306,9 +506,19 @@ _endWriteV3()
 
 void BasicWriter::
 endWrite()
+{
+  bool is_master_io = m_parallel_mng->isMasterIO();
+  _addWriteFunction([this, is_master_io]() { _endWrite(is_master_io); });
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+void BasicWriter::
+_endWrite(bool is_master_io)
 {
   const IParallelMng* pm = m_parallel_mng;
-  if (pm->isMasterIO()) {
+  if (is_master_io) {
     if (m_version >= 3) {
       _endWriteV3();
     }
@@ -322,6 +532,51 @@ endWrite()
     }
   }
   m_global_writer->endWrite();
+  if (!m_hash_database_directory.empty())
+    _writeHashManifest();
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+/*!
+ * \brief Ecrit le manifeste contenant les hash utilisés par ce rang.
+ *
+ * Le manifeste est un fichier texte contenant un hash par ligne. Il sert
+ * à déterminer les blocs de la base de données de hash encore utilisés.
+ */
+void BasicWriter::
+_writeHashManifest()
+{
+  Int32 rank = m_parallel_mng->commRank();
+  String filename = _getHashManifestFile(m_path, rank);
+  std::ofstream ofile(filename.localstr());
+  for (const String& hash_value : m_text_writer->writtenHashes())
+    ofile << hash_value << '\n';
+  if (!ofile)
+    ARCANE_FATAL("Can not write hash manifest '{0}'", filename);
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+void BasicWriter::
+readHashManifests(const String& path, std::set<String>& hashes)
+{
+  namespace fs = std::filesystem;
+  std::error_code ec;
+  fs::path dir_path(path.localstr());
+  if (!fs::is_directory(dir_path, ec))
+    return;
+  const std::string prefix = "arcane_hash_manifest_n";
+  for (const fs::directory_entry& entry : fs::directory_iterator(dir_path, ec)) {
+    std::string name = entry.path().filename().string();
+    if (name.rfind(prefix, 0) != 0)
+      continue;
+    std::ifstream ifile(entry.path());
+    std::string hash_value;
+    while (ifile >> hash_value)
+      hashes.insert(String(hash_value));
+  }
 }
 
 /*---------------------------------------------------------------------------*/
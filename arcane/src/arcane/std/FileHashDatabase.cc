@@ -1,11 +1,11 @@
 ﻿// -*- tab-width: 2; indent-tabs-mode: nil; coding: utf-8-with-signature -*-
 //-----------------------------------------------------------------------------
-// Copyright 2000-2023 CEA (www.cea.fr) IFPEN (www.ifpenergiesnouvelles.com)
+// Copyright 2000-2024 CEA (www.cea.fr) IFPEN (www.ifpenergiesnouvelles.com)
 // See the top-level COPYRIGHT file for details.
 // SPDX-License-Identifier: Apache-2.0
 //-----------------------------------------------------------------------------
 /*---------------------------------------------------------------------------*/
-/* FileHashDatabase.cc                                         (C) 2000-2023 */
+/* FileHashDatabase.cc                                         (C) 2000-2024 */
 /*                                                                           */
 /* Base de données de hash gérée par le système de fichier.                  */
 /*---------------------------------------------------------------------------*/
@@ -13,6 +13,7 @@
 
 #include "arcane/std/internal/IHashDatabase.h"
 
+#include "arcane/utils/Array.h"
 #include "arcane/utils/PlatformUtils.h"
 #include "arcane/utils/StringBuilder.h"
 #include "arcane/utils/String.h"
@@ -20,6 +21,7 @@
 #include "arcane/utils/TraceAccessor.h"
 
 #include <fstream>
+#include <filesystem>
 
 /*---------------------------------------------------------------------------*/
 /*---------------------------------------------------------------------------*/
@@ -71,7 +73,8 @@ class FileHashDatabase
   ~FileHashDatabase()
   {
     info() << "FileHashDatabase: nb_write_cache=" << m_nb_write_cache
-           << " nb_write=" << m_nb_write << " nb_read=" << m_nb_read;
+           << " nb_write=" << m_nb_write << " nb_read=" << m_nb_read
+           << " nb_remove=" << m_nb_remove;
   }
 
  public:
@@ -111,6 +114,48 @@ class FileHashDatabase
     }
   }
 
+  /*!
+   * \brief Supprime les fichiers dont le nom n'est pas dans \a referenced_hashes.
+   *
+   * Seuls les fichiers situés à la profondeur des fichiers de hash (voir
+   * _getDirFileInfo()) sont considérés.
+   */
+  Int64 removeUnreferencedValues(const std::set<String>& referenced_hashes) override
+  {
+    namespace fs = std::filesystem;
+    fs::path base_path(m_directory.localstr());
+    std::error_code ec;
+    if (!fs::is_directory(base_path, ec))
+      return 0;
+
+    Int64 nb_removed = 0;
+    Int64 nb_kept = 0;
+    UniqueArray<String> files_to_remove;
+    for (auto iter = fs::recursive_directory_iterator(base_path, ec); iter != fs::recursive_directory_iterator(); iter.increment(ec)) {
+      if (ec)
+        ARCANE_FATAL("Can not read directory '{0}' error='{1}'", m_directory, ec.message());
+      const fs::directory_entry& entry = *iter;
+      if (iter.depth() != 2 || !entry.is_regular_file())
+        continue;
+      String hash_value(entry.path().filename().string());
+      if (referenced_hashes.find(hash_value) != referenced_hashes.end())
+        ++nb_kept;
+      else
+        files_to_remove.add(String(entry.path().string()));
+    }
+    // Supprime les fichiers en dehors de la boucle pour ne pas invalider l'itérateur.
+    for (const String& filename : files_to_remove) {
+      if (fs::remove(fs::path(filename.localstr()), ec))
+        ++nb_removed;
+      else if (ec)
+        ARCANE_FATAL("Can not remove file '{0}' error='{1}'", filename, ec.message());
+    }
+    m_nb_remove += nb_removed;
+    info() << "FileHashDatabase: remove unreferenced values nb_removed=" << nb_removed
+           << " nb_kept=" << nb_kept;
+    return nb_removed;
+  }
+
   void readValues(const HashDatabaseReadArgs& args) override
   {
     const String& hash_value = args.hashValueAsString();
@@ -151,6 +196,7 @@ class FileHashDatabase
   Int64 m_nb_write_cache = 0;
   Int64 m_nb_write = 0;
   Int64 m_nb_read = 0;
+  Int64 m_nb_remove = 0;
 };
 
 /*---------------------------------------------------------------------------*/
@@ -0,0 +1,689 @@
+﻿// -*- tab-width: 2; indent-tabs-mode: nil; coding: utf-8-with-signature -*-
+//-----------------------------------------------------------------------------
+// Copyright 2000-2024 CEA (www.cea.fr) IFPEN (www.ifpenergiesnouvelles.com)
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: Apache-2.0
+//-----------------------------------------------------------------------------
+/*---------------------------------------------------------------------------*/
+/* GeometricMeshPartitioner.cc                                 (C) 2000-2024 */
+/*                                                                           */
+/* Partitionneur de maillage géométrique (Hilbert ou RCB).                   */
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+#include "arcane/utils/ArgumentException.h"
+#include "arcane/utils/FatalErrorException.h"
+#include "arcane/utils/Real3.h"
+
+#include "arcane/core/IParallelMng.h"
+#include "arcane/core/ItemEnumerator.h"
+#include "arcane/core/IMesh.h"
+#include "arcane/core/IMeshSubMeshTransition.h"
+#include "arcane/core/ItemGroup.h"
+#include "arcane/core/FactoryService.h"
+#include "arcane/core/MeshVariable.h"
+#include "arcane/core/ILoadBalanceMng.h"
+
+#include "arcane/mesh/SpaceFillingCurveItemSorter.h"
+
+#include "arcane/std/MeshPartitionerBase.h"
+#include "arcane/std/GeometricMeshPartitioner_axl.h"
+
+#include <algorithm>
+#include <numeric>
+#include <limits>
+#include <utility>
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+namespace Arcane
+{
+
+using GeometricPartitionMethod = TypesGeometricMeshPartitioner::GeometricPartitionMethod;
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+/*!
+ * \brief Partitionneur de maillage géométrique.
+ *
+ * Deux méthodes sont disponibles :
+ * - découpage en parties de même poids de la courbe de Hilbert passant par
+ *   le centre des mailles,
+ * - bissection récursive suivant les coordonnées (RCB) : chaque ensemble de
+ *   mailles est coupé suivant la direction la plus longue de sa boîte
+ *   englobante en deux sous-ensembles dont les poids sont proportionnels
+ *   au nombre de parties qu'ils doivent contenir.
+ *
+ * Le poids d'une maille est la somme des critères de ILoadBalanceMng
+ * (ILoadBalanceMng::addCriterion(), ILoadBalanceMng::addMass(), ...)
+ * normalisés par leur somme globale. S'il n'y a aucun critère, toutes les
+ * mailles ont le même poids.
+ *
+ * Aucune donnée n'est centralisée : les positions de coupure sont
+ * déterminées par une recherche dichotomique sur les clés triées
+ * localement, chaque étape nécessitant une seule réduction globale.
+ * Le coût est donc en O(n log n) pour le tri local plus une réduction par
+ * bit de clé (au plus 64).
+ */
+class GeometricMeshPartitioner
+: public ArcaneGeometricMeshPartitionerObject
+{
+ public:
+
+  explicit GeometricMeshPartitioner(const ServiceBuildInfo& sbi);
+
+ public:
+
+  void build() override {}
+
+ public:
+
+  void partitionMesh(bool initial_partition) override;
+  void partitionMesh(bool initial_partition, Int32 nb_part) override;
+
+ private:
+
+  IParallelMng* m_parallel_mng = nullptr;
+
+ private:
+
+  GeometricPartitionMethod _method() const;
+  void _computeCellsInfos(UniqueArray<Cell>& cells, UniqueArray<Real3>& centers,
+                          UniqueArray<Real>& weights);
+  void _partitionHilbert(Int32 nb_part, ConstArrayView<Cell> cells, ConstArrayView<Real3> centers,
+                         ConstArrayView<Real> weights, ArrayView<Int32> parts);
+  void _partitionRCB(Int32 nb_part, ConstArrayView<Cell> cells, ConstArrayView<Real3> centers,
+                     ConstArrayView<Real> weights, ArrayView<Int32> parts);
+  void _computeBoundingBoxes(Int32 nb_group, ConstArrayView<Int32> item_groups,
+                             ConstArrayView<Real3> centers,
+                             ArrayView<Real3> min_boxes, ArrayView<Real3> max_boxes);
+  void _computeSplitters(Int32 nb_group, ConstArrayView<Int32> item_groups,
+                         ConstArrayView<Int64> keys, ConstArrayView<Real> weights,
+                         ConstArrayView<Int32> query_groups, ConstArrayView<Real> query_targets,
+                         ArrayView<Int64> splitters);
+  void _checkImbalance(Int32 nb_part, ConstArrayView<Real> weights, ConstArrayView<Int32> parts);
+};
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+GeometricMeshPartitioner::
+GeometricMeshPartitioner(const ServiceBuildInfo& sbi)
+: ArcaneGeometricMeshPartitionerObject(sbi)
+{
+  m_parallel_mng = mesh()->parallelMng();
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+GeometricPartitionMethod GeometricMeshPartitioner::
+_method() const
+{
+  // Les options peuvent ne pas exister si le service est créé sans
+  // jeu de données (par exemple par ServiceBuilder).
+  if (options())
+    return options()->method();
+  return GeometricPartitionMethod::Hilbert;
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+void GeometricMeshPartitioner::
+partitionMesh(bool initial_partition)
+{
+  Int32 nb_part = m_parallel_mng->commSize();
+  partitionMesh(initial_partition, nb_part);
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+void GeometricMeshPartitioner::
+partitionMesh([[maybe_unused]] bool initial_partition, Int32 nb_part)
+{
+  IMesh* mesh = this->mesh();
+  Int32 nb_rank = m_parallel_mng->commSize();
+  if (nb_part < nb_rank)
+    ARCANE_THROW(ArgumentException, "partition with nb_part ({0}) < nb_rank ({1})",
+                 nb_part, nb_rank);
+
+  GeometricPartitionMethod method = _method();
+  info() << "Geometric partitioning method="
+         << ((method == GeometricPartitionMethod::Hilbert) ? "Hilbert" : "RCB")
+         << " nb_part=" << nb_part;
+
+  initConstraints(false);
+
+  UniqueArray<Cell> cells;
+  UniqueArray<Real3> centers;
+  UniqueArray<Real> weights;
+  _computeCellsInfos(cells, centers, weights);
+
+  UniqueArray<Int32> parts(cells.size(), 0);
+  if (method == GeometricPartitionMethod::Hilbert)
+    _partitionHilbert(nb_part, cells, centers, weights, parts);
+  else
+    _partitionRCB(nb_part, cells, centers, weights, parts);
+  _checkImbalance(nb_part, weights, parts);
+
+  VariableItemInt32& cells_new_owner = mesh->toPrimaryMesh()->itemsNewOwner(IK_Cell);
+  ENUMERATE_CELL (icell, mesh->ownCells()) {
+    cells_new_owner[icell] = (*icell).owner();
+  }
+  for (Integer i = 0, n = cells.size(); i < n; ++i)
+    changeCellOwner(cells[i], cells_new_owner, parts[i]);
+
+  // libération des tableaux temporaires
+  freeConstraints();
+
+  cells_new_owner.synchronize();
+
+  changeOwnersFromCells();
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+/*!
+ * \brief Calcule le centre et le poids des mailles à partitionner.
+ *
+ * Seules les mailles propres utilisées avec les contraintes sont prises en
+ * compte. Pour un ensemble de mailles contraintes, le poids est celui de
+ * l'ensemble et la position celle de la maille de référence.
+ */
+void GeometricMeshPartitioner::
+_computeCellsInfos(UniqueArray<Cell>& cells, UniqueArray<Real3>& centers,
+                   UniqueArray<Real>& weights)
+{
+  IMesh* mesh = this->mesh();
+  VariableNodeReal3& nodes_coord = mesh->nodesCoordinates();
+
+  Int32 nb_criteria = loadBalanceMng()->nbCriteria();
+  SharedArray<float> cells_weights;
+  if (nb_criteria > 0)
+    cells_weights = cellsWeightsWithConstraints(nb_criteria);
+
+  ENUMERATE_CELL (icell, mesh->ownCells()) {
+    Cell cell = *icell;
+    if (!cellUsedWithConstraints(cell))
+      continue;
+    Real3 center;
+    Int32 nb_node = cell.nbNode();
+    for (Node node : cell.nodes())
+      center += nodes_coord[node];
+    if (nb_node > 0)
+      center /= static_cast<Real>(nb_node);
+    cells.add(cell);
+    centers.add(center);
+  }
+
+  Integer nb_cell = cells.size();
+  weights.resize(nb_cell);
+  if (nb_criteria == 0) {
+    weights.fill(1.0);
+    return;
+  }
+
+  // Normalise chaque critère par sa somme globale pour que les critères
+  // aient la même importance quelle que soit leur unité.
+  UniqueArray<Real> criteria_sum(nb_criteria, 0.0);
+  for (Integer i = 0; i < nb_cell; ++i) {
+    Int32 index = localIdWithConstraints(cells[i]);
+    for (Int32 k = 0; k < nb_criteria; ++k)
+      criteria_sum[k] += cells_weights[index * nb_criteria + k];
+  }
+  m_parallel_mng->reduce(Parallel::ReduceSum, criteria_sum);
+  for (Integer i = 0; i < nb_cell; ++i) {
+    Int32 index = localIdWithConstraints(cells[i]);
+    Real w = 0.0;
+    for (Int32 k = 0; k < nb_criteria; ++k)
+      if (criteria_sum[k] > 0.0)
+        w += cells_weights[index * nb_criteria + k] / criteria_sum[k];
+    weights[i] = w;
+  }
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+/*!
+ * \brief Partitionnement par découpage de la courbe de Hilbert.
+ *
+ * Les mailles sont ordonnées suivant le couple (indice de Hilbert,
+ * uniqueId()). L'indice de Hilbert utilise les 63 bits de la clé et il
+ * n'est donc pas possible d'y ajouter le uniqueId() comme pour la
+ * bissection. Les positions de coupure sont donc calculées en deux
+ * temps : d'abord sur l'indice de Hilbert, puis sur le uniqueId() parmi
+ * les mailles dont l'indice est égal à celui de la coupure. Cela garantit
+ * que des mailles de même indice (par exemple de même centre) peuvent
+ * être réparties entre plusieurs parties.
+ */
+void GeometricMeshPartitioner::
+_partitionHilbert(Int32 nb_part, ConstArrayView<Cell> cells, ConstArrayView<Real3> centers,
+                  ConstArrayView<Real> weights, ArrayView<Int32> parts)
+{
+  if (nb_part <= 1)
+    return;
+
+  Integer nb_item = centers.size();
+  UniqueArray<Int32> item_groups(nb_item, 0);
+  Real3 min_box;
+  Real3 max_box;
+  _computeBoundingBoxes(1, item_groups, centers, ArrayView<Real3>(1, &min_box), ArrayView<Real3>(1, &max_box));
+
+  // Utilise le même facteur d'échelle dans toutes les directions pour
+  // conserver la forme du domaine.
+  const Real max_coord = static_cast<Real>((1 << 21) - 1);
+  Real3 box_size = max_box - min_box;
+  Real max_size = math::max(box_size.x, math::max(box_size.y, box_size.z));
+  Real scale = (max_size > 0.0) ? (max_coord / max_size) : 0.0;
+  auto to_int = [=](Real v) {
+    Real x = math::min(math::max(v * scale, 0.0), max_coord);
+    return static_cast<UInt32>(x);
+  };
+
+  UniqueArray<Int64> keys(nb_item);
+  Real local_weight = 0.0;
+  for (Integer i = 0; i < nb_item; ++i) {
+    Real3 c = centers[i] - min_box;
+    keys[i] = mesh::SpaceFillingCurveItemSorter::hilbertIndex(to_int(c.x), to_int(c.y), to_int(c.z));
+    local_weight += weights[i];
+  }
+  Real total_weight = m_parallel_mng->reduce(Parallel::ReduceSum, local_weight);
+
+  // Il faut (nb_part-1) positions de coupure sur la courbe.
+  Int32 nb_splitter = nb_part - 1;
+  UniqueArray<Int32> query_groups(nb_splitter, 0);
+  UniqueArray<Real> query_targets(nb_splitter);
+  for (Int32 k = 0; k < nb_splitter; ++k)
+    query_targets[k] = total_weight * static_cast<Real>(k + 1) / static_cast<Real>(nb_part);
+  UniqueArray<Int64> splitters(nb_splitter);
+  _computeSplitters(1, item_groups, keys, weights, query_groups, query_targets, splitters);
+
+  // Départage les mailles dont l'indice est égal à celui d'une coupure.
+  // Chaque valeur distincte des coupures forme un ensemble et les autres
+  // mailles sont dans l'ensemble d'indice \a nb_distinct qui n'est pas
+  // interrogé. Le poids cible d'une coupure dans son ensemble est son
+  // poids cible diminué du poids des mailles d'indice strictement
+  // inférieur.
+  UniqueArray<Int64> distinct_keys(splitters);
+  std::sort(distinct_keys.begin(), distinct_keys.end());
+  distinct_keys.resize(static_cast<Int32>(std::unique(distinct_keys.begin(), distinct_keys.end()) - distinct_keys.begin()));
+  Int32 nb_distinct = distinct_keys.size();
+  UniqueArray<Real> below_weights(nb_distinct + 1, 0.0);
+  UniqueArray<Int64> uids(nb_item);
+  for (Integer i = 0; i < nb_item; ++i) {
+    Int64 key = keys[i];
+    auto iter = std::lower_bound(distinct_keys.begin(), distinct_keys.end(), key);
+    Int32 pos = static_cast<Int32>(iter - distinct_keys.begin());
+    item_groups[i] = (pos < nb_distinct && *iter == key) ? pos : nb_distinct;
+    // La maille est strictement inférieure aux coupures d'indice
+    // supérieur ou égal à 'pos' (ou 'pos+1' en cas d'égalité).
+    Int32 first_above = (item_groups[i] == nb_distinct) ? pos : (pos + 1);
+    below_weights[first_above] += weights[i];
+    uids[i] = cells[i].uniqueId().asInt64();
+  }
+  for (Int32 k = 0; k < nb_distinct; ++k)
+    below_weights[k + 1] += below_weights[k];
+  m_parallel_mng->reduce(Parallel::ReduceSum, below_weights);
+  for (Int32 k = 0; k < nb_splitter; ++k) {
+    auto iter = std::lower_bound(distinct_keys.begin(), distinct_keys.end(), splitters[k]);
+    Int32 g = static_cast<Int32>(iter - distinct_keys.begin());
+    query_groups[k] = g;
+    query_targets[k] -= below_weights[g];
+  }
+  UniqueArray<Int64> uid_splitters(nb_splitter);
+  _computeSplitters(nb_distinct + 1, item_groups, uids, weights, query_groups, query_targets, uid_splitters);
+
+  // La partie d'une maille est le nombre de positions de coupure
+  // strictement inférieures à son couple (indice, uniqueId()).
+  // Les coupures sont croissantes suivant ce couple.
+  UniqueArray<std::pair<Int64, Int64>> pair_splitters(nb_splitter);
+  for (Int32 k = 0; k < nb_splitter; ++k)
+    pair_splitters[k] = std::make_pair(splitters[k], uid_splitters[k]);
+  for (Integer i = 0; i < nb_item; ++i) {
+    auto iter = std::lower_bound(pair_splitters.begin(), pair_splitters.end(), std::make_pair(keys[i], uids[i]));
+    parts[i] = static_cast<Int32>(iter - pair_splitters.begin());
+  }
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+/*!
+ * \brief Partitionnement par bissection récursive suivant les coordonnées.
+ *
+ * Tous les ensembles d'un même niveau de la récursion sont traités
+ * simultanément, ce qui fait qu'il y a ceil(log2(nb_part)) niveaux.
+ */
+void GeometricMeshPartitioner::
+_partitionRCB(Int32 nb_part, ConstArrayView<Cell> cells, ConstArrayView<Real3> centers,
+              ConstArrayView<Real> weights, ArrayView<Int32> parts)
+{
+  Integer nb_item = centers.size();
+  // Ensemble courant de chaque maille et, pour chaque ensemble, première
+  // partie et nombre de parties qu'il doit contenir.
+  UniqueArray<Int32> item_groups(nb_item, 0);
+  UniqueArray<Int32> groups_first_part;
+  UniqueArray<Int32> groups_nb_part;
+  groups_first_part.add(0);
+  groups_nb_part.add(nb_part);
+
+  const Real max_coord = static_cast<Real>((1U << 31) - 1);
+  UniqueArray<Real3> min_boxes;
+  UniqueArray<Real3> max_boxes;
+  UniqueArray<Real> groups_weight;
+  UniqueArray<Int32> groups_dim;
+  UniqueArray<Int32> groups_query;
+  UniqueArray<Int32> query_groups;
+  UniqueArray<Real> query_targets;
+  UniqueArray<Int64> splitters;
+  UniqueArray<Int64> keys(nb_item);
+
+  for (;;) {
+    Int32 nb_group = groups_first_part.size();
+    bool has_split = false;
+    for (Int32 g = 0; g < nb_group; ++g)
+      if (groups_nb_part[g] > 1)
+        has_split = true;
+    if (!has_split)
+      break;
+
+    min_boxes.resize(nb_group);
+    max_boxes.resize(nb_group);
+    _computeBoundingBoxes(nb_group, item_groups, centers, min_boxes, max_boxes);
+
+    groups_weight.resize(nb_group);
+    groups_weight.fill(0.0);
+    for (Integer i = 0; i < nb_item; ++i)
+      groups_weight[item_groups[i]] += weights[i];
+    m_parallel_mng->reduce(Parallel::ReduceSum, groups_weight);
+
+    // Détermine la direction de coupe et le poids cible de la partie
+    // gauche de chaque ensemble à couper.
+    groups_dim.resize(nb_group);
+    groups_query.resize(nb_group);
+    query_groups.clear();
+    query_targets.clear();
+    for (Int32 g = 0; g < nb_group; ++g) {
+      groups_query[g] = -1;
+      groups_dim[g] = 0;
+      Int32 nb = groups_nb_part[g];
+      if (nb <= 1)
+        continue;
+      Real3 box_size = max_boxes[g] - min_boxes[g];
+      if (box_size.y > box_size[groups_dim[g]])
+        groups_dim[g] = 1;
+      if (box_size.z > box_size[groups_dim[g]])
+        groups_dim[g] = 2;
+      groups_query[g] = query_groups.size();
+      query_groups.add(g);
+      query_targets.add(groups_weight[g] * static_cast<Real>(nb / 2) / static_cast<Real>(nb));
+    }
+
+    // La clé d'une maille est sa coordonnée quantifiée suivant la direction
+    // de coupe. Les 32 bits de poids faible du uniqueId() permettent de
+    // départager les mailles de même coordonnée.
+    for (Integer i = 0; i < nb_item; ++i) {
+      Int32 g = item_groups[i];
+      if (groups_nb_part[g] <= 1) {
+        keys[i] = 0;
+        continue;
+      }
+      Int32 dim = groups_dim[g];
+      Real size = max_boxes[g][dim] - min_boxes[g][dim];
+      Real x = 0.0;
+      if (size > 0.0)
+        x = math::min(math::max((centers[i][dim] - min_boxes[g][dim]) / size * max_coord, 0.0), max_coord);
+      Int64 uid = cells[i].uniqueId().asInt64();
+      keys[i] = (static_cast<Int64>(x) << 32) | (uid & 0xffffffff);
+    }
+    splitters.resize(query_groups.size());
+    _computeSplitters(nb_group, item_groups, keys, weights, query_groups, query_targets, splitters);
+
+    // Crée les nouveaux ensembles et y range les mailles.
+    UniqueArray<Int32> new_first_part;
+    UniqueArray<Int32> new_nb_part;
+    UniqueArray<Int32> groups_left(nb_group);
+    for (Int32 g = 0; g < nb_group; ++g) {
+      Int32 first = groups_first_part[g];
+      Int32 nb = groups_nb_part[g];
+      groups_left[g] = new_first_part.size();
+      if (nb <= 1) {
+        new_first_part.add(first);
+        new_nb_part.add(nb);
+      }
+      else {
+        new_first_part.add(first);
+        new_nb_part.add(nb / 2);
+        new_first_part.add(first + nb / 2);
+        new_nb_part.add(nb - nb / 2);
+      }
+    }
+    for (Integer i = 0; i < nb_item; ++i) {
+      Int32 g = item_groups[i];
+      Int32 q = groups_query[g];
+      item_groups[i] = groups_left[g];
+      if (q >= 0 && keys[i] > splitters[q])
+        ++item_groups[i];
+    }
+    groups_first_part.swap(new_first_part);
+    groups_nb_part.swap(new_nb_part);
+  }
+
+  for (Integer i = 0; i < nb_item; ++i)
+    parts[i] = groups_first_part[item_groups[i]];
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+/*!
+ * \brief Affiche et vérifie le déséquilibre du partitionnement.
+ *
+ * Le déséquilibre est le rapport entre le poids de la partie la plus
+ * lourde et le poids moyen d'une partie, moins 1. Une partie ne pouvant
+ * être équilibrée à mieux que le poids d'une maille près, la vérification
+ * demandée par l'option 'check-max-imbalance' tolère en plus deux fois le
+ * poids de la maille la plus lourde.
+ */
+void GeometricMeshPartitioner::
+_checkImbalance(Int32 nb_part, ConstArrayView<Real> weights, ConstArrayView<Int32> parts)
+{
+  IParallelMng* pm = m_parallel_mng;
+  UniqueArray<Real> parts_weight(nb_part, 0.0);
+  Real max_item_weight = 0.0;
+  for (Integer i = 0, n = parts.size(); i < n; ++i) {
+    parts_weight[parts[i]] += weights[i];
+    max_item_weight = math::max(max_item_weight, weights[i]);
+  }
+  pm->reduce(Parallel::ReduceSum, parts_weight);
+  max_item_weight = pm->reduce(Parallel::ReduceMax, max_item_weight);
+  Real total_weight = 0.0;
+  Real max_weight = 0.0;
+  for (Real w : parts_weight) {
+    total_weight += w;
+    max_weight = math::max(max_weight, w);
+  }
+  if (total_weight <= 0.0)
+    return;
+  Real average_weight = total_weight / static_cast<Real>(nb_part);
+  Real imbalance = max_weight / average_weight - 1.0;
+  info() << "Geometric partitioning imbalance=" << imbalance
+         << " max_item_weight=" << (max_item_weight / average_weight);
+
+  Real max_imbalance = (options()) ? options()->checkMaxImbalance() : 0.0;
+  if (max_imbalance <= 0.0)
+    return;
+  if (max_weight > average_weight * (1.0 + max_imbalance) + 2.0 * max_item_weight)
+    ARCANE_FATAL("Bad geometric partitioning imbalance={0} max_allowed={1} max_item_weight={2}",
+                 imbalance, max_imbalance, max_item_weight / average_weight);
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+/*!
+ * \brief Calcule la boîte englobante globale de chaque ensemble.
+ *
+ * Pour un ensemble vide, la boîte est réduite à l'origine.
+ */
+void GeometricMeshPartitioner::
+_computeBoundingBoxes(Int32 nb_group, ConstArrayView<Int32> item_groups,
+                      ConstArrayView<Real3> centers,
+                      ArrayView<Real3> min_boxes, ArrayView<Real3> max_boxes)
+{
+  const Real max_value = std::numeric_limits<Real>::max();
+  UniqueArray<Real> min_values(nb_group * 3, max_value);
+  UniqueArray<Real> max_values(nb_group * 3, -max_value);
+  for (Integer i = 0, n = centers.size(); i < n; ++i) {
+    Int32 g = item_groups[i];
+    Real3 c = centers[i];
+    for (Int32 d = 0; d < 3; ++d) {
+      min_values[g * 3 + d] = math::min(min_values[g * 3 + d], c[d]);
+      max_values[g * 3 + d] = math::max(max_values[g * 3 + d], c[d]);
+    }
+  }
+  m_parallel_mng->reduce(Parallel::ReduceMin, min_values);
+  m_parallel_mng->reduce(Parallel::ReduceMax, max_values);
+  for (Int32 g = 0; g < nb_group; ++g) {
+    Real3 min_box;
+    Real3 max_box;
+    if (min_values[g * 3] <= max_values[g * 3]) {
+      for (Int32 d = 0; d < 3; ++d) {
+        min_box[d] = min_values[g * 3 + d];
+        max_box[d] = max_values[g * 3 + d];
+      }
+    }
+    min_boxes[g] = min_box;
+    max_boxes[g] = max_box;
+  }
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+/*!
+ * \brief Calcule des positions de coupure pondérées.
+ *
+ * Pour chaque requête \a q, calcule la plus petite clé \a s telle que
+ * la somme globale des poids des entités de l'ensemble \a query_groups[q]
+ * dont la clé est inférieure ou égale à \a s atteigne \a query_targets[q].
+ *
+ * Les clés doivent être positives ou nulles. Les entités sont triées
+ * localement une seule fois puis toutes les requêtes sont résolues
+ * simultanément par dichotomie sur l'intervalle global des clés de leur
+ * ensemble, avec une réduction par étape.
+ */
+void GeometricMeshPartitioner::
+_computeSplitters(Int32 nb_group, ConstArrayView<Int32> item_groups,
+                  ConstArrayView<Int64> keys, ConstArrayView<Real> weights,
+                  ConstArrayView<Int32> query_groups, ConstArrayView<Real> query_targets,
+                  ArrayView<Int64> splitters)
+{
+  IParallelMng* pm = m_parallel_mng;
+  Integer nb_item = keys.size();
+  Int32 nb_query = query_groups.size();
+
+  // Tri local suivant l'ensemble puis la clé.
+  UniqueArray<Int32> sorted_indexes(nb_item);
+  std::iota(sorted_indexes.begin(), sorted_indexes.end(), 0);
+  std::sort(sorted_indexes.begin(), sorted_indexes.end(), [&](Int32 a, Int32 b) {
+    if (item_groups[a] != item_groups[b])
+      return item_groups[a] < item_groups[b];
+    return keys[a] < keys[b];
+  });
+  UniqueArray<Int64> sorted_keys(nb_item);
+  UniqueArray<Real> prefix_weights(nb_item + 1);
+  prefix_weights[0] = 0.0;
+  for (Integer i = 0; i < nb_item; ++i) {
+    Int32 index = sorted_indexes[i];
+    sorted_keys[i] = keys[index];
+    prefix_weights[i + 1] = prefix_weights[i] + weights[index];
+  }
+  UniqueArray<Int32> groups_begin(nb_group + 1, 0);
+  for (Integer i = 0; i < nb_item; ++i)
+    ++groups_begin[item_groups[i] + 1];
+  for (Int32 g = 0; g < nb_group; ++g)
+    groups_begin[g + 1] += groups_begin[g];
+
+  // Intervalle global des clés de chaque ensemble.
+  UniqueArray<Int64> keys_min(nb_group, std::numeric_limits<Int64>::max());
+  UniqueArray<Int64> keys_max(nb_group, -1);
+  for (Int32 g = 0; g < nb_group; ++g) {
+    Int32 begin = groups_begin[g];
+    Int32 end = groups_begin[g + 1];
+    if (begin < end) {
+      keys_min[g] = sorted_keys[begin];
+      keys_max[g] = sorted_keys[end - 1];
+    }
+  }
+  pm->reduce(Parallel::ReduceMin, keys_min);
+  pm->reduce(Parallel::ReduceMax, keys_max);
+
+  UniqueArray<Int64> lower(nb_query);
+  UniqueArray<Int64> upper(nb_query);
+  for (Int32 q = 0; q < nb_query; ++q) {
+    Int32 g = query_groups[q];
+    // Pour un ensemble vide, n'importe quelle valeur convient.
+    if (keys_max[g] < 0) {
+      lower[q] = upper[q] = 0;
+      continue;
+    }
+    lower[q] = keys_min[g];
+    upper[q] = keys_max[g];
+  }
+
+  // Les bornes sont calculées à partir de valeurs réduites et sont donc
+  // identiques sur tous les rangs, ce qui garantit que tous font le même
+  // nombre d'itérations.
+  UniqueArray<Int64> middles(nb_query);
+  UniqueArray<Real> below_weights(nb_query);
+  for (;;) {
+    bool is_done = true;
+    for (Int32 q = 0; q < nb_query; ++q)
+      if (lower[q] < upper[q])
+        is_done = false;
+    if (is_done)
+      break;
+    for (Int32 q = 0; q < nb_query; ++q) {
+      below_weights[q] = 0.0;
+      if (lower[q] >= upper[q])
+        continue;
+      Int64 middle = lower[q] + (upper[q] - lower[q]) / 2;
+      middles[q] = middle;
+      Int32 g = query_groups[q];
+      auto begin = sorted_keys.begin() + groups_begin[g];
+      auto end = sorted_keys.begin() + groups_begin[g + 1];
+      Int32 pos = static_cast<Int32>(std::upper_bound(begin, end, middle) - sorted_keys.begin());
+      below_weights[q] = prefix_weights[pos] - prefix_weights[groups_begin[g]];
+    }
+    pm->reduce(Parallel::ReduceSum, below_weights);
+    for (Int32 q = 0; q < nb_query; ++q) {
+      if (lower[q] >= upper[q])
+        continue;
+      if (below_weights[q] >= query_targets[q])
+        upper[q] = middles[q];
+      else
+        lower[q] = middles[q] + 1;
+    }
+  }
+
+  for (Int32 q = 0; q < nb_query; ++q)
+    splitters[q] = lower[q];
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+ARCANE_REGISTER_SERVICE(GeometricMeshPartitioner,
+                        ServiceProperty("GeometricMeshPartitioner",ST_SubDomain),
+                        ARCANE_SERVICE_INTERFACE(IMeshPartitioner),
+                        ARCANE_SERVICE_INTERFACE(IMeshPartitionerBase));
+
+ARCANE_REGISTER_SERVICE_GEOMETRICMESHPARTITIONER(GeometricMeshPartitioner,GeometricMeshPartitioner);
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+} // End namespace Arcane
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
@@ -22,6 +22,7 @@
 #include "arcane/utils/FixedArray.h"
 #include "arcane/utils/PlatformUtils.h"
 #include "arcane/utils/CheckedConvert.h"
+#include "arcane/utils/ValueConvert.h"
 
 #include "arcane/core/IMeshReader.h"
 #include "arcane/core/IPrimaryMesh.h"
@@ -30,11 +31,17 @@
 #include "arcane/core/VariableTypes.h"
 #include "arcane/core/IParallelMng.h"
 #include "arcane/core/MeshUtils.h"
+#include "arcane/core/ItemEnumerator.h"
 
 // Element types in .msh file format, found in gmsh-2.0.4/Common/GmshDefines.h
 #include "arcane/std/internal/IosFile.h"
 #include "arcane/std/internal/IosGmsh.h"
 
+#include <fstream>
+#include <cstdlib>
+#include <cctype>
+#include <limits>
+
 /*---------------------------------------------------------------------------*/
 /*---------------------------------------------------------------------------*/
 
@@ -71,6 +78,22 @@ namespace Arcane
  * - seuls les éléments d'ordre 1 sont supportés.
  * - les coordonnées paramétriques ne sont pas supportées
  * - seules les sections `$Nodes` et `$Entities` sont lues
+ *
+ * Par défaut, seul le rang maître lit le fichier et envoie les valeurs
+ * lues aux rangs de \a m_parts_rank. Si la variable d'environnement
+ * `ARCANE_MSH_DISTRIBUTED_READ` vaut `1`, le rang maître ne fait que
+ * repérer la position dans le fichier des blocs de `$Nodes` et `$Elements`
+ * et chaque rang de \a m_parts_rank lit et analyse lui-même sa partie de
+ * chaque bloc. Les noeuds sont ensuite répartis par intervalle de
+ * uniqueId() une seule fois par section `$Nodes` et les mailles et
+ * coordonnées sont échangées via des allToAll() au lieu d'être diffusées
+ * à tous les rangs.
+ *
+ * \todo En mode distribué, le rang maître parcourt encore séquentiellement
+ * tout le fichier pour repérer les blocs (voir _skipLinesAndBroadcast()) et
+ * diffuse l'en-tête et la position de chaque bloc. Pour les gros fichiers,
+ * il faudrait que chaque rang recherche lui-même le début des blocs dans sa
+ * partie du fichier.
  */
 class MshParallelMeshReader
 : public TraceAccessor
@@ -198,6 +221,10 @@ class MshParallelMeshReader
     UniqueArray<Int64> nodes_unique_id;
     //! Tableau associatif (uniqueId(),rang) auquel le noeud appartiendra.
     std::unordered_map<Int64, Int32> nodes_rank_map;
+    //! Plus petit uniqueId() des noeuds
+    Int64 min_node_tag = 0;
+    //! Plus grand uniqueId() des noeuds
+    Int64 max_node_tag = -1;
     Real3 m_node_min_bounding_box;
     Real3 m_node_max_bounding_box;
     MeshPhysicalNameList physical_name_list;
@@ -206,6 +233,23 @@ class MshParallelMeshReader
     UniqueArray<MeshV4ElementsBlock> blocks;
   };
 
+  //! Valeurs d'une section '$Nodes' lues par un rang en mode distribué
+  class DistributedNodesInfo
+  {
+   public:
+
+    //! Nombre de noeuds de chaque bloc
+    UniqueArray<Int64> blocks_nb_node;
+    //! Nombre de uniqueId() lus par ce rang dans chaque bloc
+    UniqueArray<Int64> blocks_nb_uid;
+    //! Nombre de coordonnées (Real3) lues par ce rang dans chaque bloc
+    UniqueArray<Int64> blocks_nb_coord;
+    //! UniqueId() lus par ce rang dans l'ordre du fichier
+    UniqueArray<Int64> uids;
+    //! Coordonnées lues par ce rang dans l'ordre du fichier
+    UniqueArray<Real> coords;
+  };
+
  public:
 
   explicit MshParallelMeshReader(ITraceMng* tm)
@@ -226,11 +270,19 @@ class MshParallelMeshReader
   Int32 m_nb_part = 4;
   //! Liste des rangs qui participent à la conservation des données
   UniqueArray<Int32> m_parts_rank;
+  //! Indice de mon rang dans \a m_parts_rank (-1 si je n'en fais pas partie)
+  Int32 m_my_part_index = -1;
+  //! Indique si chaque rang de \a m_parts_rank lit lui-même sa partie du fichier
+  bool m_is_distributed_read = false;
+  //! Flux du fichier (uniquement pour le rang maître)
+  std::istream* m_master_stream = nullptr;
+  //! Fichier lu par les rangs de \a m_parts_rank en mode distribué
+  std::ifstream m_part_file;
 
  private:
 
   void _readNodesFromFileAscii();
-  void _readNodesOneEntity(Int32 entity_index);
+  void _readNodesOneEntity(Int32 entity_index, DistributedNodesInfo& distributed_nodes);
   Integer _readElementsFromFileAscii();
   void _readMeshFromFile();
   void _setNodesCoordinates();
@@ -254,6 +306,14 @@ class MshParallelMeshReader
   void _computeOwnCells(MeshV4ElementsBlock& block);
   Real3 _getReal3();
   void _goToNextLine();
+  std::pair<Int64, Int64> _skipLinesAndBroadcast(Int64 nb_line);
+  std::string _readMyPartLines(Int64 begin, Int64 end);
+  void _readNodesOneEntityDistributed(Int64 nb_node, DistributedNodesInfo& distributed_nodes);
+  void _readOneElementBlockDistributed(MeshV4ElementsBlock& block);
+  void _distributeNodesByUniqueId(const DistributedNodesInfo& distributed_nodes);
+  void _computeOwnCellsDistributed(MeshV4ElementsBlock& block);
+  void _setNodesCoordinatesDistributed();
+  Int32 _nodeUniqueIdOwnerRank(Int64 uid) const;
 };
 
 /*---------------------------------------------------------------------------*/
@@ -277,6 +337,76 @@ namespace
       isize = size - ibegin;
     return { ibegin, isize };
   }
+
+  //! Ajoute dans \a values les valeurs contenues dans \a buf.
+  void _parseValues(const std::string& buf, Array<Int64>& values)
+  {
+    const char* ptr = buf.c_str();
+    const char* end = ptr + buf.size();
+    for (;;) {
+      while (ptr != end && std::isspace(static_cast<unsigned char>(*ptr)))
+        ++ptr;
+      if (ptr == end)
+        break;
+      char* next = nullptr;
+      Int64 v = std::strtoll(ptr, &next, 10);
+      if (next == ptr)
+        ARCANE_THROW(IOException, "Invalid integer value");
+      values.add(v);
+      ptr = next;
+    }
+  }
+
+  //! Ajoute dans \a values les valeurs contenues dans \a buf.
+  void _parseValues(const std::string& buf, Array<Real>& values)
+  {
+    const char* ptr = buf.c_str();
+    const char* end = ptr + buf.size();
+    for (;;) {
+      while (ptr != end && std::isspace(static_cast<unsigned char>(*ptr)))
+        ++ptr;
+      if (ptr == end)
+        break;
+      char* next = nullptr;
+      Real v = std::strtod(ptr, &next);
+      if (next == ptr)
+        ARCANE_THROW(IOException, "Invalid real value");
+      values.add(v);
+      ptr = next;
+    }
+  }
+
+  /*!
+   * \brief Echange des valeurs entre tous les rangs.
+   *
+   * \a send_values[i] contient les valeurs à envoyer au rang \a i.
+   * En retour, \a recv_values contient les valeurs reçues rangées par
+   * rang d'origine et \a recv_counts le nombre de valeurs reçues de chaque rang.
+   */
+  template <typename DataType> void
+  _allToAllVariable(IParallelMng* pm, const std::vector<UniqueArray<DataType>>& send_values,
+                    UniqueArray<DataType>& recv_values, UniqueArray<Int32>& recv_counts)
+  {
+    const Int32 nb_rank = pm->commSize();
+    UniqueArray<Int32> send_counts(nb_rank);
+    UniqueArray<Int32> send_indexes(nb_rank);
+    UniqueArray<DataType> send_buf;
+    for (Int32 i = 0; i < nb_rank; ++i) {
+      send_indexes[i] = send_buf.size();
+      send_counts[i] = send_values[i].size();
+      send_buf.addRange(send_values[i]);
+    }
+    recv_counts.resize(nb_rank);
+    pm->allToAll(send_counts, recv_counts, 1);
+    UniqueArray<Int32> recv_indexes(nb_rank);
+    Int32 total_recv = 0;
+    for (Int32 i = 0; i < nb_rank; ++i) {
+      recv_indexes[i] = total_recv;
+      total_recv += recv_counts[i];
+    }
+    recv_values.resize(total_recv);
+    pm->allToAllVariable(send_buf, send_counts, send_indexes, recv_values, recv_counts, recv_indexes);
+  }
 } // namespace
 
 /*---------------------------------------------------------------------------*/
@@ -353,6 +483,104 @@ _goToNextLine()
     m_ios_file->getNextLine();
 }
 
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+/*!
+ * \brief Passe les \a nb_line lignes suivantes et broadcast leur position.
+ *
+ * Le rang maître ne fait que rechercher les fins de ligne sans analyser
+ * les valeurs. Retourne la position (en octet) dans le fichier du début
+ * de la première ligne et de la fin de la dernière ligne.
+ *
+ * \todo Ce parcours séquentiel de tout le fichier par le rang maître limite
+ * l'extensibilité de la lecture distribuée.
+ */
+std::pair<Int64, Int64> MshParallelMeshReader::
+_skipLinesAndBroadcast(Int64 nb_line)
+{
+  FixedArray<Int64, 2> range;
+  std::istream* s = m_master_stream;
+  if (s) {
+    range[0] = static_cast<Int64>(s->tellg());
+    for (Int64 i = 0; i < nb_line; ++i)
+      s->ignore(std::numeric_limits<std::streamsize>::max(), '\n');
+    if (!s->good())
+      ARCANE_THROW(IOException, "Unexpected end of file");
+    range[1] = static_cast<Int64>(s->tellg());
+  }
+  if (m_is_parallel)
+    m_parallel_mng->broadcast(range.view(), m_master_io_rank);
+  return { range[0], range[1] };
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+/*!
+ * \brief Lit les lignes de ma partie de l'intervalle [\a begin,\a end[.
+ *
+ * L'intervalle est découpé en \a m_nb_part parties de même taille en octet.
+ * Une ligne appartient à la partie qui contient son premier caractère.
+ * Retourne une chaîne vide si je ne fais pas partie de \a m_parts_rank.
+ */
+std::string MshParallelMeshReader::
+_readMyPartLines(Int64 begin, Int64 end)
+{
+  std::string buf;
+  if (m_my_part_index < 0)
+    return buf;
+  auto [chunk_begin, chunk_size] = _interval(m_my_part_index, m_nb_part, end - begin);
+  if (chunk_size == 0)
+    return buf;
+  chunk_begin += begin;
+  const Int64 chunk_end = chunk_begin + chunk_size;
+
+  // Lit aussi le caractère précédent pour savoir si une ligne
+  // commence au début de ma partie.
+  const bool has_previous = (chunk_begin > begin);
+  const Int64 read_begin = (has_previous) ? (chunk_begin - 1) : chunk_begin;
+  buf.resize(chunk_end - read_begin);
+  m_part_file.clear();
+  m_part_file.seekg(read_begin);
+  m_part_file.read(buf.data(), buf.size());
+  if (!m_part_file)
+    ARCANE_THROW(IOException, "Can not read file part begin={0} size={1}", read_begin, buf.size());
+
+  size_t first = 0;
+  if (has_previous) {
+    size_t pos = buf.find('\n');
+    // Aucune ligne ne commence dans ma partie
+    if (pos == std::string::npos)
+      return {};
+    first = pos + 1;
+  }
+  // Complète la dernière ligne si elle continue dans la partie suivante.
+  if (buf.back() != '\n' && chunk_end < end) {
+    std::string last_line;
+    std::getline(m_part_file, last_line);
+    buf += last_line;
+    buf += '\n';
+  }
+  buf.erase(0, first);
+  return buf;
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+/*!
+ * \brief Rang qui conserve le noeud de uniqueId() \a uid en mode distribué.
+ *
+ * Les noeuds sont répartis sur les rangs de \a m_parts_rank par intervalle
+ * de uniqueId() de même taille.
+ */
+Int32 MshParallelMeshReader::
+_nodeUniqueIdOwnerRank(Int64 uid) const
+{
+  const Int64 nb_tag = m_mesh_info.max_node_tag - m_mesh_info.min_node_tag + 1;
+  Int64 part = ((uid - m_mesh_info.min_node_tag) * m_nb_part) / nb_tag;
+  part = std::clamp(part, static_cast<Int64>(0), static_cast<Int64>(m_nb_part - 1));
+  return m_parts_rank[static_cast<Int32>(part)];
+}
+
 /*---------------------------------------------------------------------------*/
 /*---------------------------------------------------------------------------*/
 
@@ -518,16 +746,25 @@ _readNodesFromFileAscii()
   if (total_nb_node < 0)
     ARCANE_THROW(IOException, "Invalid number of nodes : '{0}'", total_nb_node);
 
+  m_mesh_info.min_node_tag = min_node_tag;
+  m_mesh_info.max_node_tag = max_node_tag;
+  if (m_is_distributed_read && total_nb_node > 0 && max_node_tag < min_node_tag)
+    ARCANE_THROW(IOException, "Invalid node tags min={0} max={1}", min_node_tag, max_node_tag);
+
   info() << "[Nodes] nb_entity=" << nb_entity
          << " total_nb_node=" << total_nb_node
          << " min_tag=" << min_node_tag
          << " max_tag=" << max_node_tag
          << " read_nb_part=" << m_nb_part;
 
+  DistributedNodesInfo distributed_nodes;
   for (Integer i_entity = 0; i_entity < nb_entity; ++i_entity) {
-    _readNodesOneEntity(i_entity);
+    _readNodesOneEntity(i_entity, distributed_nodes);
   }
 
+  if (m_is_distributed_read)
+    _distributeNodesByUniqueId(distributed_nodes);
+
   _computeNodesPartition();
 }
 
@@ -535,7 +772,7 @@ _readNodesFromFileAscii()
 /*---------------------------------------------------------------------------*/
 
 void MshParallelMeshReader::
-_readNodesOneEntity(Int32 entity_index)
+_readNodesOneEntity(Int32 entity_index, DistributedNodesInfo& distributed_nodes)
 {
   IosFile* ios_file = m_ios_file.get();
   IParallelMng* pm = m_parallel_mng;
@@ -568,6 +805,11 @@ _readNodesOneEntity(Int32 entity_index)
   if (nb_node2 == 0)
     return;
 
+  if (m_is_distributed_read) {
+    _readNodesOneEntityDistributed(nb_node2, distributed_nodes);
+    return;
+  }
+
   // Partitionne la lecture en \a m_nb_part
   // Pour chaque i_entity , on a d'abord la liste des identifiants puis la liste des coordonnées
 
@@ -794,11 +1036,17 @@ _readElementsFromFileAscii()
       if (m_is_parallel)
         pm->broadcast(ArrayView<Int64>(1, &item_unique_id), m_master_io_rank);
       block.uids.add(item_unique_id);
+      _goToNextLine();
+    }
+    else if (m_is_distributed_read) {
+      // Passe à la ligne contenant le premier élément.
+      _goToNextLine();
+      _readOneElementBlockDistributed(block);
     }
     else {
       _readOneElementBlock(block);
+      _goToNextLine();
     }
-    _goToNextLine();
   }
 
   // Maintenant qu'on a tout les blocs, la dimension du maillage est
@@ -865,6 +1113,11 @@ _computeOwnCells(MeshV4ElementsBlock& block)
 {
   // On ne conserve que les mailles dont le premier noeud appartient à notre rang.
 
+  if (m_is_distributed_read) {
+    _computeOwnCellsDistributed(block);
+    return;
+  }
+
   IParallelMng* pm = m_parallel_mng;
   const Int32 my_rank = pm->commRank();
 
@@ -934,6 +1187,11 @@ _computeOwnCells(MeshV4ElementsBlock& block)
 void MshParallelMeshReader::
 _setNodesCoordinates()
 {
+  if (m_is_distributed_read) {
+    _setNodesCoordinatesDistributed();
+    return;
+  }
+
   UniqueArray<Int64> uids_storage;
   UniqueArray<Real3> coords_storage;
   UniqueArray<Int32> local_ids;
@@ -962,6 +1220,352 @@ _setNodesCoordinates()
   }
 }
 
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+/*!
+ * \brief Lit les noeuds d'une entité en mode distribué.
+ *
+ * Les uniqueId() puis les coordonnées des \a nb_node noeuds sont chacun
+ * sur une ligne. Chaque rang de \a m_parts_rank lit sa partie des deux
+ * listes et les ajoute à \a distributed_nodes. Comme les parties sont
+ * découpées en octets, un rang n'a en général pas lu les uniqueId() et
+ * les coordonnées des mêmes noeuds. Les échanges sont faits pour toute la
+ * section dans _distributeNodesByUniqueId().
+ */
+void MshParallelMeshReader::
+_readNodesOneEntityDistributed(Int64 nb_node, DistributedNodesInfo& distributed_nodes)
+{
+  auto [uids_begin, uids_end] = _skipLinesAndBroadcast(nb_node);
+  auto [coords_begin, coords_end] = _skipLinesAndBroadcast(nb_node);
+
+  UniqueArray<Int64>& uids = distributed_nodes.uids;
+  const Int64 old_nb_uid = uids.largeSize();
+  _parseValues(_readMyPartLines(uids_begin, uids_end), uids);
+  UniqueArray<Real>& coords = distributed_nodes.coords;
+  const Int64 old_nb_coord = coords.largeSize();
+  _parseValues(_readMyPartLines(coords_begin, coords_end), coords);
+  const Int64 nb_coord = coords.largeSize() - old_nb_coord;
+  if ((nb_coord % 3) != 0)
+    ARCANE_THROW(IOException, "Invalid number of coordinates n={0}", nb_coord);
+
+  distributed_nodes.blocks_nb_node.add(nb_node);
+  distributed_nodes.blocks_nb_uid.add(uids.largeSize() - old_nb_uid);
+  distributed_nodes.blocks_nb_coord.add(nb_coord / 3);
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+/*!
+ * \brief Répartit les noeuds lus en mode distribué par intervalle de uniqueId().
+ *
+ * Les échanges sont faits une seule fois pour toute la section '$Nodes':
+ * - un allGather() donne à tous les rangs le nombre de uniqueId() et de
+ *   coordonnées lus par chaque rang dans chaque bloc,
+ * - chaque rang envoie ses uniqueId() au rang qui a lu les coordonnées
+ *   des mêmes noeuds,
+ * - ce dernier envoie directement chaque noeud (uniqueId() et coordonnées)
+ *   au rang qui conserve l'intervalle de uniqueId() correspondant.
+ *
+ * Les rangs de \a m_parts_rank sont rangés dans l'ordre des parties du
+ * fichier. Les valeurs reçues d'un rang le sont donc dans l'ordre du fichier.
+ *
+ * Après cet appel, un rang peut connaitre le rang qui possède les
+ * informations d'un noeud via _nodeUniqueIdOwnerRank().
+ */
+void MshParallelMeshReader::
+_distributeNodesByUniqueId(const DistributedNodesInfo& distributed_nodes)
+{
+  IParallelMng* pm = m_parallel_mng;
+  const Int32 nb_rank = pm->commSize();
+  const Int32 my_rank = pm->commRank();
+  const Int32 nb_block = distributed_nodes.blocks_nb_node.size();
+
+  // Récupère le nombre de uniqueId() et de coordonnées lus par bloc sur chaque rang.
+  UniqueArray<Int64> my_counts(nb_block * 2);
+  for (Int32 b = 0; b < nb_block; ++b) {
+    my_counts[b] = distributed_nodes.blocks_nb_uid[b];
+    my_counts[nb_block + b] = distributed_nodes.blocks_nb_coord[b];
+  }
+  UniqueArray<Int64> all_counts(nb_rank * nb_block * 2);
+  pm->allGather(my_counts, all_counts);
+  auto nb_uid = [&](Int32 rank, Int32 b) { return all_counts[(rank * nb_block * 2) + b]; };
+  auto nb_coord = [&](Int32 rank, Int32 b) { return all_counts[(rank * nb_block * 2) + nb_block + b]; };
+
+  // Position dans chaque bloc de la première valeur lue par mon rang.
+  UniqueArray<Int64> my_uid_begin(nb_block, 0);
+  UniqueArray<Int64> my_coord_begin(nb_block, 0);
+  for (Int32 b = 0; b < nb_block; ++b) {
+    Int64 total_nb_uid = 0;
+    Int64 total_nb_coord = 0;
+    for (Int32 rank : m_parts_rank) {
+      if (rank == my_rank) {
+        my_uid_begin[b] = total_nb_uid;
+        my_coord_begin[b] = total_nb_coord;
+      }
+      total_nb_uid += nb_uid(rank, b);
+      total_nb_coord += nb_coord(rank, b);
+    }
+    const Int64 nb_node = distributed_nodes.blocks_nb_node[b];
+    if (total_nb_uid != nb_node || total_nb_coord != nb_node)
+      ARCANE_THROW(IOException, "Bad number of read nodes block={0} nb_uid={1} nb_coord={2} expected={3}",
+                   b, total_nb_uid, total_nb_coord, nb_node);
+  }
+
+  // Envoie mes uniqueId() aux rangs qui ont lu les coordonnées associées.
+  UniqueArray<Int32> recv_counts;
+  UniqueArray<Int64> recv_uids;
+  {
+    std::vector<UniqueArray<Int64>> send_uids(nb_rank);
+    Int64 uid_index = 0;
+    for (Int32 b = 0; b < nb_block; ++b) {
+      const Int64 begin = my_uid_begin[b];
+      const Int64 end = begin + distributed_nodes.blocks_nb_uid[b];
+      Int64 coord_begin = 0;
+      for (Int32 rank : m_parts_rank) {
+        const Int64 coord_end = coord_begin + nb_coord(rank, b);
+        const Int64 first = math::max(begin, coord_begin);
+        const Int64 last = math::min(end, coord_end);
+        if (first < last)
+          send_uids[rank].addRange(distributed_nodes.uids.constView().subView(uid_index + first - begin, last - first));
+        coord_begin = coord_end;
+      }
+      uid_index += end - begin;
+    }
+    _allToAllVariable(pm, send_uids, recv_uids, recv_counts);
+  }
+
+  // Associe les uniqueId() reçus à mes coordonnées et envoie chaque noeud
+  // au rang qui conserve son intervalle de uniqueId().
+  std::vector<UniqueArray<Int64>> send_uids(nb_rank);
+  std::vector<UniqueArray<Real>> send_coords(nb_rank);
+  {
+    UniqueArray<Int32> recv_index(nb_rank);
+    Int32 total_nb_recv = 0;
+    for (Int32 i = 0; i < nb_rank; ++i) {
+      recv_index[i] = total_nb_recv;
+      total_nb_recv += recv_counts[i];
+    }
+    UniqueArray<Int32> recv_index_begin(recv_index);
+    ConstArrayView<Real> coords = distributed_nodes.coords;
+    Int64 coord_index = 0;
+    for (Int32 b = 0; b < nb_block; ++b) {
+      const Int64 begin = my_coord_begin[b];
+      const Int64 end = begin + distributed_nodes.blocks_nb_coord[b];
+      Int64 uid_begin = 0;
+      for (Int32 rank : m_parts_rank) {
+        const Int64 uid_end = uid_begin + nb_uid(rank, b);
+        const Int64 first = math::max(begin, uid_begin);
+        const Int64 last = math::min(end, uid_end);
+        for (Int64 i = first; i < last; ++i) {
+          const Int64 uid = recv_uids[recv_index[rank]];
+          ++recv_index[rank];
+          const Int64 pos_index = (coord_index + i - begin) * 3;
+          const Int32 dest_rank = _nodeUniqueIdOwnerRank(uid);
+          send_uids[dest_rank].add(uid);
+          send_coords[dest_rank].addRange(coords.subView(pos_index, 3));
+        }
+        uid_begin = uid_end;
+      }
+      coord_index += end - begin;
+    }
+    for (Int32 i = 0; i < nb_rank; ++i) {
+      Int32 expected_index = (i + 1 < nb_rank) ? recv_index_begin[i + 1] : total_nb_recv;
+      if (recv_index[i] != expected_index)
+        ARCANE_FATAL("Bad number of used uniqueId() rank={0} n={1} expected={2}",
+                     i, recv_index[i] - recv_index_begin[i], expected_index - recv_index_begin[i]);
+    }
+  }
+
+  UniqueArray<Int64> recv_uids2;
+  _allToAllVariable(pm, send_uids, recv_uids2, recv_counts);
+  UniqueArray<Real> recv_coords;
+  _allToAllVariable(pm, send_coords, recv_coords, recv_counts);
+  if (recv_coords.size() != (recv_uids2.size() * 3))
+    ARCANE_FATAL("Incoherent number of nodes uids={0} coords={1}", recv_uids2.size(), recv_coords.size() / 3);
+  const Int32 nb_recv = recv_uids2.size();
+  m_mesh_info.nodes_unique_id = recv_uids2;
+  m_mesh_info.nodes_coordinates.resize(nb_recv);
+  for (Int32 i = 0; i < nb_recv; ++i)
+    m_mesh_info.nodes_coordinates[i] = Real3(recv_coords[i * 3], recv_coords[i * 3 + 1], recv_coords[i * 3 + 2]);
+  info() << "Nodes distributed by uniqueId() nb_local_node=" << nb_recv;
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+/*!
+ * \brief Lit un bloc d'entité de type 'Element' en mode distribué.
+ *
+ * Chaque ligne contient le uniqueId() de l'élément puis ceux de ses noeuds.
+ * Chaque rang de \a m_parts_rank conserve les éléments de sa partie du bloc.
+ */
+void MshParallelMeshReader::
+_readOneElementBlockDistributed(MeshV4ElementsBlock& block)
+{
+  const Int64 nb_entity_in_block = block.nb_entity;
+  const Int32 item_nb_node = block.item_nb_node;
+
+  auto [block_begin, block_end] = _skipLinesAndBroadcast(nb_entity_in_block);
+
+  UniqueArray<Int64> values;
+  _parseValues(_readMyPartLines(block_begin, block_end), values);
+  const Int32 nb_value_per_item = 1 + item_nb_node;
+  if ((values.size() % nb_value_per_item) != 0)
+    ARCANE_THROW(IOException, "Invalid number of values for block index={0}", block.index);
+  const Int32 nb_item = values.size() / nb_value_per_item;
+  block.uids.reserve(nb_item);
+  block.connectivities.reserve(nb_item * item_nb_node);
+  for (Int32 i = 0; i < nb_item; ++i) {
+    block.uids.add(values[i * nb_value_per_item]);
+    block.connectivities.addRange(values.subView(i * nb_value_per_item + 1, item_nb_node));
+  }
+
+  Int64 nb_read_item = m_parallel_mng->reduce(Parallel::ReduceSum, static_cast<Int64>(nb_item));
+  if (nb_read_item != nb_entity_in_block)
+    ARCANE_THROW(IOException, "Bad number of read items for block index={0} n={1} expected={2}",
+                 block.index, nb_read_item, nb_entity_in_block);
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+/*!
+ * \brief Envoie les mailles du bloc \a block aux rangs qui les possèdent.
+ *
+ * Une maille appartient au rang de son premier noeud. Ce rang est demandé
+ * au rang qui conserve ce noeud puis les mailles sont envoyées à leur
+ * propriétaire.
+ */
+void MshParallelMeshReader::
+_computeOwnCellsDistributed(MeshV4ElementsBlock& block)
+{
+  IParallelMng* pm = m_parallel_mng;
+  const Int32 nb_rank = pm->commSize();
+  const Int32 item_type = block.item_type;
+  const Int32 item_nb_node = block.item_nb_node;
+  const Int32 nb_item = block.uids.size();
+
+  // Demande le rang du premier noeud de chaque maille.
+  UniqueArray<Int32> first_node_owners(nb_item);
+  std::vector<UniqueArray<Int64>> send_uids(nb_rank);
+  for (Int32 i = 0; i < nb_item; ++i) {
+    Int64 first_node_uid = block.connectivities[i * item_nb_node];
+    Int32 owner = _nodeUniqueIdOwnerRank(first_node_uid);
+    first_node_owners[i] = owner;
+    send_uids[owner].add(first_node_uid);
+  }
+  UniqueArray<Int32> recv_counts;
+  UniqueArray<Int64> recv_uids;
+  _allToAllVariable(pm, send_uids, recv_uids, recv_counts);
+
+  std::vector<UniqueArray<Int64>> send_ranks(nb_rank);
+  {
+    Int32 index = 0;
+    for (Int32 i_rank = 0; i_rank < nb_rank; ++i_rank) {
+      for (Int32 j = 0, n = recv_counts[i_rank]; j < n; ++j) {
+        Int64 uid = recv_uids[index];
+        ++index;
+        auto x = m_mesh_info.nodes_rank_map.find(uid);
+        if (x == m_mesh_info.nodes_rank_map.end())
+          ARCANE_FATAL("Can not find node uid={0}", uid);
+        send_ranks[i_rank].add(x->second);
+      }
+    }
+  }
+  UniqueArray<Int64> recv_ranks;
+  _allToAllVariable(pm, send_ranks, recv_ranks, recv_counts);
+
+  // Les réponses sont rangées par rang propriétaire puis dans l'ordre des demandes.
+  UniqueArray<Int32> answer_indexes(nb_rank);
+  {
+    Int32 index = 0;
+    for (Int32 i_rank = 0; i_rank < nb_rank; ++i_rank) {
+      answer_indexes[i_rank] = index;
+      index += send_uids[i_rank].size();
+    }
+  }
+
+  // Envoie chaque maille (uniqueId() puis connectivité) à son propriétaire.
+  std::vector<UniqueArray<Int64>> send_cells(nb_rank);
+  for (Int32 i = 0; i < nb_item; ++i) {
+    Int32 owner = first_node_owners[i];
+    Int32 dest_rank = CheckedConvert::toInt32(recv_ranks[answer_indexes[owner]]);
+    ++answer_indexes[owner];
+    send_cells[dest_rank].add(block.uids[i]);
+    send_cells[dest_rank].addRange(block.connectivities.subView(i * item_nb_node, item_nb_node));
+  }
+  UniqueArray<Int64> recv_cells;
+  _allToAllVariable(pm, send_cells, recv_cells, recv_counts);
+
+  const Int32 nb_value_per_item = 1 + item_nb_node;
+  const Int32 nb_recv_item = recv_cells.size() / nb_value_per_item;
+  for (Int32 i = 0; i < nb_recv_item; ++i) {
+    m_mesh_info.cells_type.add(item_type);
+    m_mesh_info.cells_nb_node.add(item_nb_node);
+    m_mesh_info.cells_uid.add(recv_cells[i * nb_value_per_item]);
+    m_mesh_info.cells_connectivity.addRange(recv_cells.subView(i * nb_value_per_item + 1, item_nb_node));
+  }
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+/*!
+ * \brief Positionne les coordonnées des noeuds en mode distribué.
+ *
+ * Chaque rang demande les coordonnées de ses noeuds aux rangs qui
+ * les conservent.
+ */
+void MshParallelMeshReader::
+_setNodesCoordinatesDistributed()
+{
+  IParallelMng* pm = m_parallel_mng;
+  const Int32 nb_rank = pm->commSize();
+  VariableNodeReal3& nodes_coord_var(m_mesh->nodesCoordinates());
+
+  std::vector<UniqueArray<Int64>> send_uids(nb_rank);
+  std::vector<UniqueArray<Int32>> nodes_local_id(nb_rank);
+  ENUMERATE_ (Node, inode, m_mesh->allNodes()) {
+    Node node = *inode;
+    Int32 owner = _nodeUniqueIdOwnerRank(node.uniqueId());
+    send_uids[owner].add(node.uniqueId());
+    nodes_local_id[owner].add(node.localId());
+  }
+  UniqueArray<Int32> recv_counts;
+  UniqueArray<Int64> recv_uids;
+  _allToAllVariable(pm, send_uids, recv_uids, recv_counts);
+
+  std::unordered_map<Int64, Int32> uid_to_index;
+  const Int32 nb_node = m_mesh_info.nodes_unique_id.size();
+  for (Int32 i = 0; i < nb_node; ++i)
+    uid_to_index.insert(std::make_pair(m_mesh_info.nodes_unique_id[i], i));
+
+  std::vector<UniqueArray<Real>> send_coords(nb_rank);
+  {
+    Int32 index = 0;
+    for (Int32 i_rank = 0; i_rank < nb_rank; ++i_rank) {
+      for (Int32 j = 0, n = recv_counts[i_rank]; j < n; ++j) {
+        Int64 uid = recv_uids[index];
+        ++index;
+        auto x = uid_to_index.find(uid);
+        if (x == uid_to_index.end())
+          ARCANE_FATAL("Can not find coordinates for node uid={0}", uid);
+        Real3 pos = m_mesh_info.nodes_coordinates[x->second];
+        send_coords[i_rank].add(pos.x);
+        send_coords[i_rank].add(pos.y);
+        send_coords[i_rank].add(pos.z);
+      }
+    }
+  }
+  UniqueArray<Real> recv_coords;
+  _allToAllVariable(pm, send_coords, recv_coords, recv_counts);
+
+  Int32 index = 0;
+  for (Int32 i_rank = 0; i_rank < nb_rank; ++i_rank) {
+    for (Int32 lid : nodes_local_id[i_rank]) {
+      nodes_coord_var[NodeLocalId(lid)] = Real3(recv_coords[index], recv_coords[index + 1], recv_coords[index + 2]);
+      index += 3;
+    }
+  }
+}
+
 /*---------------------------------------------------------------------------*/
 /*---------------------------------------------------------------------------*/
 
@@ -1191,12 +1795,13 @@ _addCellOrNodeGroupOnePart(ConstArrayView<Int64> uids, const String& group_name,
   ItemGroup group = family->findGroup(group_name, true);
 
   UniqueArray<Int32> items_lid(nb_entity);
+  UniqueArray<Int32> not_found_indexes;
 
-  family->itemsUniqueIdToLocalId(items_lid, uids, false);
+  family->itemsUniqueIdToLocalId(items_lid, uids, not_found_indexes);
 
   // En parallèle, il est possible que certaines entités du groupe ne soient
   // pas dans notre sous-domaine. Il faut les filtrer.
-  if (m_is_parallel) {
+  if (m_is_parallel && !not_found_indexes.empty()) {
     auto items_begin = items_lid.begin();
     Int64 new_size = std::remove(items_begin, items_lid.end(), NULL_ITEM_LOCAL_ID) - items_begin;
     items_lid.resize(new_size);
@@ -1471,14 +2076,20 @@ readMeshFromMshFile(IMesh* mesh, const String& filename)
   if (nb_rank > 2048)
     m_nb_part = nb_rank / 16;
   m_parts_rank.resize(m_nb_part);
+  const Int32 my_rank = pm->commRank();
   for (Int32 i = 0; i < m_nb_part; ++i) {
     m_parts_rank[i] = i % nb_rank;
+    if (m_parts_rank[i] == my_rank)
+      m_my_part_index = i;
   }
 
   bool is_master_io = pm->isMasterIO();
   Int32 master_io_rank = pm->masterIORank();
   m_is_parallel = pm->isParallel();
   m_master_io_rank = master_io_rank;
+  if (auto v = Convert::Type<Int32>::tryParseFromEnvironment("ARCANE_MSH_DISTRIBUTED_READ", true))
+    m_is_distributed_read = (v.value() != 0);
+  info() << "Use distributed read for 'msh' file ?=" << m_is_distributed_read;
   FixedArray<Int32, 1> file_readable;
   // Seul le rang maître va lire le fichier.
   // On vérifie d'abord qu'il est lisible
@@ -1499,8 +2110,15 @@ readMeshFromMshFile(IMesh* mesh, const String& filename)
   if (is_master_io) {
     ifile.open(filename.localstr());
     ios_file = makeRef<IosFile>(new IosFile(&ifile));
+    m_master_stream = &ifile;
   }
   m_ios_file = ios_file;
+  // En mode distribué, chaque rang de \a m_parts_rank ouvre aussi le fichier.
+  if (m_is_distributed_read && m_my_part_index >= 0) {
+    m_part_file.open(filename.localstr(), std::ios::binary);
+    if (!m_part_file)
+      ARCANE_THROW(IOException, "Can not open file '{0}' for distributed read", filename);
+  }
   String mesh_format_str = _getNextLineAndBroadcast();
   if (IosFile::isEqualString(mesh_format_str, "$MeshFormat")) {
     _readMeshFromFile();
@@ -1,11 +1,11 @@
 ﻿// -*- tab-width: 2; indent-tabs-mode: nil; coding: utf-8-with-signature -*-
 //-----------------------------------------------------------------------------
-// Copyright 2000-2023 CEA (www.cea.fr) IFPEN (www.ifpenergiesnouvelles.com)
+// Copyright 2000-2024 CEA (www.cea.fr) IFPEN (www.ifpenergiesnouvelles.com)
 // See the top-level COPYRIGHT file for details.
 // SPDX-License-Identifier: Apache-2.0
 //-----------------------------------------------------------------------------
 /*---------------------------------------------------------------------------*/
-/* RedisHashDatabase.cc                                        (C) 2000-2023 */
+/* RedisHashDatabase.cc                                        (C) 2000-2024 */
 /*                                                                           */
 /* Base de données de hash gérée par le système de fichier.                  */
 /*---------------------------------------------------------------------------*/
@@ -14,6 +14,7 @@
 #include "arcane/utils/TraceAccessor.h"
 #include "arcane/utils/Array.h"
 #include "arcane/utils/FatalErrorException.h"
+#include "arcane/utils/NotSupportedException.h"
 
 #include "arcane/std/internal/IHashDatabase.h"
 #include "arcane/std/internal/IRedisContext.h"
@@ -62,6 +63,13 @@ class RedisHashDatabase
     args.values().copy(bytes);
   }
 
+  Int64 removeUnreferencedValues(const std::set<String>&) override
+  {
+    // Il faudrait parcourir les clés de la base via 'SCAN' mais la base
+    // peut être partagée et contenir des clés qui ne sont pas des hash.
+    ARCANE_THROW(NotSupportedException, "Removing unreferenced values is not supported for 'RedisHashDatabase'");
+  }
+
  private:
 
   Ref<IRedisContext> m_context;
@@ -0,0 +1,50 @@
+﻿// -*- tab-width: 2; indent-tabs-mode: nil; coding: utf-8-with-signature -*-
+//-----------------------------------------------------------------------------
+// Copyright 2000-2024 CEA (www.cea.fr) IFPEN (www.ifpenergiesnouvelles.com)
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: Apache-2.0
+//-----------------------------------------------------------------------------
+/*---------------------------------------------------------------------------*/
+/* TypesGeometricMeshPartitioner.h                             (C) 2000-2024 */
+/*                                                                           */
+/* Types pour le service 'GeometricMeshPartitioner'.                         */
+/*---------------------------------------------------------------------------*/
+#ifndef ARCANE_STD_TYPESGEOMETRICMESHPARTITIONER_H
+#define ARCANE_STD_TYPESGEOMETRICMESHPARTITIONER_H
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+#include "arcane/utils/ArcaneGlobal.h"
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+namespace Arcane
+{
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+class TypesGeometricMeshPartitioner
+{
+ public:
+
+  //! Méthode de partitionnement géométrique
+  enum class GeometricPartitionMethod
+  {
+    //! Découpage de la courbe de Hilbert passant par le centre des mailles
+    Hilbert,
+    //! Bissection récursive suivant les coordonnées (RCB)
+    RecursiveCoordinateBisection
+  };
+};
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+} // End namespace Arcane
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+#endif
@@ -1,11 +1,11 @@
 ﻿// -*- tab-width: 2; indent-tabs-mode: nil; coding: utf-8-with-signature -*-
 //-----------------------------------------------------------------------------
-// Copyright 2000-2023 CEA (www.cea.fr) IFPEN (www.ifpenergiesnouvelles.com)
+// Copyright 2000-2024 CEA (www.cea.fr) IFPEN (www.ifpenergiesnouvelles.com)
 // See the top-level COPYRIGHT file for details.
 // SPDX-License-Identifier: Apache-2.0
 //-----------------------------------------------------------------------------
 /*---------------------------------------------------------------------------*/
-/* VtkMeshIOService.cc                                         (C) 2000-2023 */
+/* VtkMeshIOService.cc                                         (C) 2000-2024 */
 /*                                                                           */
 /* Lecture/Ecriture d'un maillage au format Vtk historique (legacy).         */
 /*---------------------------------------------------------------------------*/
@@ -18,6 +18,7 @@
 #include "arcane/utils/ITraceMng.h"
 #include "arcane/utils/Iostream.h"
 #include "arcane/utils/OStringStream.h"
+#include "arcane/utils/PlatformUtils.h"
 #include "arcane/utils/ScopedPtr.h"
 #include "arcane/utils/StdHeader.h"
 #include "arcane/utils/String.h"
@@ -46,6 +47,9 @@
 #include "arcane/std/internal/VtkCellTypes.h"
 #include "arcane/core/UnstructuredMeshAllocateBuildInfo.h"
 
+#include <charconv>
+#include <cstring>
+
 /*---------------------------------------------------------------------------*/
 /*---------------------------------------------------------------------------*/
 
@@ -104,7 +108,13 @@ class VtkMeshIOService
 
   explicit VtkMeshIOService(ITraceMng* tm)
   : TraceAccessor(tm)
-  {}
+  {
+    // Permet d'utiliser l'ancienne lecture via std::ifstream (pour comparaison)
+    if (auto v = Convert::Type<Int32>::tryParseFromEnvironment("ARCANE_VTK_USE_STREAM_READER", true))
+      m_use_stream_reader = (v.value() != 0);
+    if (auto v = Convert::Type<Int32>::tryParseFromEnvironment("ARCANE_VTK_READ_BENCHMARK", true))
+      m_nb_benchmark_iteration = v.value();
+  }
   ~VtkMeshIOService();
 
  public:
@@ -158,12 +168,19 @@ class VtkMeshIOService
   void _readFacesMesh(IMesh* mesh, const String& file_name,
                       const String& dir_name, bool use_internal_partition);
   bool _readMetadata(IMesh* mesh, VtkFile& vtk_file);
+  void _benchmarkRead(IMesh* mesh, const String& file_name);
 
  private:
 
   //! Table des variables crées localement par lecture du maillage
   UniqueArray<VariableCellReal*> m_variables;
 
+  //! Indique si on lit le fichier via un std::ifstream au lieu de le charger en mémoire
+  bool m_use_stream_reader = false;
+
+  //! Nombre d'itérations pour le test de performance de la lecture (0 si aucun)
+  Int32 m_nb_benchmark_iteration = 0;
+
  private:
 };
 
@@ -187,6 +204,15 @@ class VtkFile
   , m_buf{}
   {}
 
+  //! Créé une instance sans fichier associé. Il faut ensuite appeler openFile().
+  VtkFile()
+  : VtkFile(nullptr)
+  {}
+
+ public:
+
+  bool openFile(const String& file_name, bool use_stream);
+
   const char* getCurrentLine();
   bool isEmptyNextLine();
   const char* getNextLine();
@@ -208,13 +234,37 @@ class VtkFile
   double getDouble();
   int getInt();
 
+  template <typename FileDataType, typename DataType>
+  void getValues(ArrayView<DataType> values);
+
   void setIsBinaryFile(bool new_val) { m_is_binary_file = new_val; }
 
+  //! Taille (en octet) du fichier lu par openFile()
+  Int64 fileLength() const { return m_file_length; }
+
  private:
 
   //! Le stream.
   std::istream* m_stream = nullptr;
 
+  //! Le stream utilisé si le fichier est ouvert par openFile() en mode flux
+  std::ifstream m_file_stream;
+
+  //! Contenu du fichier si ce dernier est lu en mémoire
+  UniqueArray<std::byte> m_file_bytes;
+
+  //! Position courante dans \a m_file_bytes
+  const char* m_data_current = nullptr;
+
+  //! Fin des données dans \a m_file_bytes
+  const char* m_data_end = nullptr;
+
+  //! Taille du fichier
+  Int64 m_file_length = 0;
+
+  //! Indique si on a atteint la fin de \a m_file_bytes lors de la lecture d'une ligne
+  bool m_is_data_eof = false;
+
   //! Y'a-t-il eu au moins une ligne lue.
   bool m_is_init;
 
@@ -229,6 +279,14 @@ class VtkFile
 
   //! Le buffer contenant la ligne lue.
   char m_buf[BUFSIZE];
+
+ private:
+
+  bool _isMemory() const { return !m_stream; }
+  bool _isGood() const;
+  bool _readLine();
+  template <typename T> T _parseValue();
+  void _readBytes(std::byte* bytes, Int64 size);
 };
 
 /*---------------------------------------------------------------------------*/
@@ -275,14 +333,14 @@ isEmptyNextLine()
     throw IOException("VtkFile::isEmptyNextLine()", "Unexpected EndOfFile");
   }
 
-  if (m_stream->good()) {
+  if (_isGood()) {
     // Le getline s'arrete (par défaut) au char '\n' et ne l'inclus pas dans le buf
     // mais le remplace par '\0'.
-    m_stream->getline(m_buf, sizeof(m_buf) - 1);
+    bool is_eof = _readLine();
 
     // Si on arrive au bout du fichier, on return true (pour dire oui, il y a une ligne vide,
     // à l'appelant de gérer ça).
-    if (m_stream->eof()) {
+    if (is_eof) {
       m_is_eof = true;
       return true;
     }
@@ -359,13 +417,13 @@ getNextLine()
     throw IOException("VtkFile::isEmptyNextLine()", "Unexpected EndOfFile");
   }
 
-  while (m_stream->good()) {
+  while (_isGood()) {
     // Le getline s'arrete (par défaut) au char '\n' et ne l'inclus pas dans le buf mais le remplace par '\0'.
-    m_stream->getline(m_buf, sizeof(m_buf) - 1);
+    bool is_eof = _readLine();
 
     // Si on arrive au bout du fichier, on return le buffer avec \0 au début (c'est à l'appelant d'appeler
     // isEof() pour savoir si le fichier est fini ou non).
-    if (m_stream->eof()) {
+    if (is_eof) {
       m_is_eof = true;
       m_buf[0] = '\0';
       return m_buf;
@@ -420,6 +478,8 @@ getFloat()
     getBinary(v);
     return v;
   }
+  if (_isMemory())
+    return _parseValue<float>();
   (*m_stream) >> ws >> v;
 
   if (m_stream->good())
@@ -444,6 +504,8 @@ getDouble()
     getBinary(v);
     return v;
   }
+  if (_isMemory())
+    return _parseValue<double>();
   (*m_stream) >> ws >> v;
 
   if (m_stream->good())
@@ -468,6 +530,8 @@ getInt()
     getBinary(v);
     return v;
   }
+  if (_isMemory())
+    return _parseValue<int>();
   (*m_stream) >> ws >> v;
 
   if (m_stream->good())
@@ -495,7 +559,7 @@ getBinary(T& value)
   Byte little_endian[sizeofT];
 
   // On lit les 'sizeofT' prochains octets que l'on met dans big_endian.
-  m_stream->read((char*)big_endian, sizeofT);
+  _readBytes(reinterpret_cast<std::byte*>(big_endian), sizeofT);
 
   // On transforme le big_endian en little_endian.
   for (size_t i = 0; i < sizeofT; i++) {
@@ -510,6 +574,221 @@ getBinary(T& value)
 /*---------------------------------------------------------------------------*/
 /*---------------------------------------------------------------------------*/
 
+/*!
+ * \brief Lit les \a values.size() prochaines valeurs.
+ *
+ * Les valeurs sont de type \a FileDataType dans le fichier et sont
+ * converties dans le type \a DataType.
+ *
+ * Cette méthode est équivalente à des appels successifs à getInt(),
+ * getFloat() ou getDouble() mais elle est beaucoup plus rapide. En binaire,
+ * le bloc de données est lu en une seule fois puis converti depuis le
+ * format big endian. Si le fichier est en mémoire, les données sont
+ * utilisées directement sans recopie préalable.
+ */
+template <typename FileDataType, typename DataType>
+void VtkFile::
+getValues(ArrayView<DataType> values)
+{
+  const Int32 nb_value = values.size();
+
+  if (m_is_binary_file) {
+    constexpr Int64 sizeofT = sizeof(FileDataType);
+    const Int64 nb_byte = sizeofT * nb_value;
+    const std::byte* big_endian_values = nullptr;
+    UniqueArray<std::byte> buffer;
+    if (_isMemory()) {
+      if ((m_data_end - m_data_current) < nb_byte)
+        throw IOException("VtkFile::getValues()", "Unexpected EndOfFile");
+      big_endian_values = reinterpret_cast<const std::byte*>(m_data_current);
+      m_data_current += nb_byte;
+    }
+    else {
+      buffer.resize(nb_byte);
+      _readBytes(buffer.data(), nb_byte);
+      big_endian_values = buffer.data();
+    }
+    // Le fichier VTK est en big endian et les CPU actuels sont en little endian.
+    for (Int32 i = 0; i < nb_value; ++i) {
+      const std::byte* big_endian = big_endian_values + i * sizeofT;
+      std::byte little_endian[sizeofT];
+      for (Int64 k = 0; k < sizeofT; ++k)
+        little_endian[sizeofT - 1 - k] = big_endian[k];
+      FileDataType v;
+      std::memcpy(&v, little_endian, sizeofT);
+      values[i] = static_cast<DataType>(v);
+    }
+    return;
+  }
+
+  if (_isMemory()) {
+    for (Int32 i = 0; i < nb_value; ++i)
+      values[i] = static_cast<DataType>(_parseValue<FileDataType>());
+    return;
+  }
+
+  for (Int32 i = 0; i < nb_value; ++i) {
+    FileDataType v = {};
+    (*m_stream) >> ws >> v;
+    if (!m_stream->good())
+      throw IOException("VtkFile::getValues()", "Bad value");
+    values[i] = static_cast<DataType>(v);
+  }
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+/*!
+ * \brief Ouvre le fichier \a file_name.
+ *
+ * Si \a use_stream est vrai, le fichier est lu au fur et à mesure via
+ * un std::ifstream. Sinon, il est entièrement chargé en mémoire et les
+ * valeurs sont analysées directement dans ce buffer, ce qui est
+ * nettement plus rapide pour les gros maillages.
+ *
+ * \retval true en cas d'erreur
+ * \retval false sinon.
+ */
+bool VtkFile::
+openFile(const String& file_name, bool use_stream)
+{
+  if (use_stream) {
+    m_file_stream.open(file_name.localstr(), std::ifstream::binary);
+    if (!m_file_stream)
+      return true;
+    m_stream = &m_file_stream;
+    m_file_length = platform::getFileLength(file_name);
+    return false;
+  }
+
+  // Réserve la place pour le '\0' terminal avant la lecture pour éviter
+  // une réallocation (et donc une copie de tout le fichier) lors de son ajout.
+  m_file_bytes.reserve(platform::getFileLength(file_name) + 1);
+  if (platform::readAllFile(file_name, true, m_file_bytes))
+    return true;
+  m_file_length = m_file_bytes.largeSize();
+  // Ajoute un '\0' terminal pour que les fonctions de conversion de la
+  // bibliothèque C ne puissent pas lire au delà de la fin des données.
+  m_file_bytes.add(std::byte{ 0 });
+  m_data_current = reinterpret_cast<const char*>(m_file_bytes.data());
+  m_data_end = m_data_current + m_file_length;
+  m_stream = nullptr;
+  return false;
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+bool VtkFile::
+_isGood() const
+{
+  if (_isMemory())
+    return !m_is_data_eof;
+  return m_stream->good();
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+/*!
+ * \brief Lit la prochaine ligne dans \a m_buf.
+ *
+ * Le comportement est le même que std::istream::getline(): le caractère
+ * '\n' n'est pas conservé.
+ *
+ * \return true si la fin du fichier a été atteinte.
+ */
+bool VtkFile::
+_readLine()
+{
+  if (!_isMemory()) {
+    m_stream->getline(m_buf, sizeof(m_buf) - 1);
+    return m_stream->eof();
+  }
+
+  const char* p = m_data_current;
+  Int32 n = 0;
+  while (p != m_data_end) {
+    char c = *p;
+    ++p;
+    if (c == '\n') {
+      m_buf[n] = '\0';
+      m_data_current = p;
+      return false;
+    }
+    if (n >= (BUFSIZE - 2))
+      throw IOException("VtkFile::_readLine()", "Line too long");
+    m_buf[n] = c;
+    ++n;
+  }
+  m_buf[n] = '\0';
+  m_data_current = p;
+  m_is_data_eof = true;
+  return true;
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+/*!
+ * \brief Analyse la prochaine valeur texte lorsque le fichier est en mémoire.
+ *
+ * Utilise std::from_chars() qui n'effectue pas d'allocation et ne
+ * dépend pas de la locale.
+ */
+template <typename T> T VtkFile::
+_parseValue()
+{
+  const char* p = m_data_current;
+  while (p != m_data_end && std::isspace(static_cast<unsigned char>(*p)))
+    ++p;
+  // std::from_chars() n'accepte pas le signe '+'.
+  if (p != m_data_end && *p == '+')
+    ++p;
+
+  T v = {};
+  const char* end_ptr = p;
+  bool is_bad = false;
+#if !defined(__cpp_lib_to_chars)
+  // Certaines versions de la bibliothèque standard ne supportent pas
+  // std::from_chars() pour les réels. Dans ce cas on utilise strtod().
+  // Cela est possible car les données se terminent par un '\0'.
+  if constexpr (std::is_floating_point_v<T>) {
+    char* strtod_end = nullptr;
+    v = static_cast<T>(std::strtod(p, &strtod_end));
+    end_ptr = strtod_end;
+    is_bad = (end_ptr == p || end_ptr > m_data_end);
+  }
+  else
+#endif
+  {
+    auto [ptr, ec] = std::from_chars(p, m_data_end, v);
+    end_ptr = ptr;
+    is_bad = (ec != std::errc());
+  }
+  if (is_bad)
+    throw IOException("VtkFile::_parseValue()", "Bad value");
+  m_data_current = end_ptr;
+  return v;
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+void VtkFile::
+_readBytes(std::byte* bytes, Int64 size)
+{
+  if (!_isMemory()) {
+    m_stream->read(reinterpret_cast<char*>(bytes), size);
+    return;
+  }
+  if ((m_data_end - m_data_current) < size)
+    throw IOException("VtkFile::_readBytes()", "Unexpected EndOfFile");
+  std::memcpy(bytes, m_data_current, size);
+  m_data_current += size;
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
 /*!
  * \brief Permet de vérifier si expected_value == current_value.
  *
@@ -610,16 +889,19 @@ VtkMeshIOService::
 bool VtkMeshIOService::
 readMesh(IPrimaryMesh* mesh, const String& file_name, const String& dir_name, bool use_internal_partition)
 {
-  std::ifstream ifile(file_name.localstr(), std::ifstream::binary);
+  Real begin_time = platform::getRealTime();
 
-  if (!ifile) {
+  VtkFile vtk_file;
+  if (vtk_file.openFile(file_name, m_use_stream_reader)) {
     error() << "Unable to read file '" << file_name << "'";
     return true;
   }
 
   debug() << "Fichier ouvert : " << file_name.localstr();
 
-  VtkFile vtk_file(&ifile);
+  if (m_nb_benchmark_iteration > 0)
+    _benchmarkRead(mesh, file_name);
+
   const char* buf = 0;
 
   // Lecture de la description
@@ -691,13 +973,93 @@ readMesh(IPrimaryMesh* mesh, const String& file_name, const String& dir_name, bo
     info() << " STR " << buf;
     }*/
 
-  ifile.close();
+  Real read_time = platform::getRealTime() - begin_time;
+  Real file_size_mb = static_cast<Real>(vtk_file.fileLength()) / 1.0e6;
+  info() << "Time to read VTK file '" << file_name << "' = " << read_time << " (s)"
+         << " size=" << file_size_mb << " (MB)"
+         << " throughput=" << ((read_time > 0.0) ? (file_size_mb / read_time) : 0.0) << " (MB/s)"
+         << " use_stream=" << m_use_stream_reader;
   return ret;
 }
 
 /*---------------------------------------------------------------------------*/
 /*---------------------------------------------------------------------------*/
 
+/*!
+ * \brief Mesure les performances de la lecture des noeuds et des mailles.
+ *
+ * Lit \a m_nb_benchmark_iteration fois les noeuds et les mailles du fichier
+ * \a file_name avec la lecture via std::ifstream puis avec la lecture
+ * en mémoire et affiche le temps et le débit obtenus pour chacune d'elles.
+ * Le débit est calculé à partir de la taille totale du fichier.
+ * Seuls les maillages non structurés sont supportés.
+ *
+ * Les valeurs lues à chaque itération sont comparées à celles de la
+ * première lecture et une erreur fatale est levée si elles diffèrent.
+ */
+void VtkMeshIOService::
+_benchmarkRead(IMesh* mesh, const String& file_name)
+{
+  const Int32 nb_iteration = m_nb_benchmark_iteration;
+  bool has_ref_values = false;
+  UniqueArray<Real3> ref_node_coords;
+  UniqueArray<Integer> ref_cells_nb_node;
+  UniqueArray<Int64> ref_cells_connectivity;
+  UniqueArray<ItemTypeId> ref_cells_type;
+  for (bool use_stream : { true, false }) {
+    Real total_time = 0.0;
+    Int64 file_length = 0;
+    for (Int32 i = 0; i < nb_iteration; ++i) {
+      Real begin_time = platform::getRealTime();
+      VtkFile vtk_file;
+      if (vtk_file.openFile(file_name, use_stream))
+        ARCANE_FATAL("Unable to read file '{0}'", file_name);
+      file_length = vtk_file.fileLength();
+
+      // Lecture du titre, du format et du type de maillage.
+      vtk_file.getNextLine();
+      String format = vtk_file.getNextLine();
+      vtk_file.setIsBinaryFile(VtkFile::isEqualString(format, "BINARY"));
+      String mesh_type = vtk_file.getNextLine();
+      if (!mesh_type.lower().contains("unstructured_grid")) {
+        info() << "VTK read benchmark is only available for 'UNSTRUCTURED_GRID'";
+        return;
+      }
+
+      UniqueArray<Real3> node_coords;
+      UniqueArray<Integer> cells_nb_node;
+      UniqueArray<Int64> cells_connectivity;
+      UniqueArray<ItemTypeId> cells_type;
+      _readNodesUnstructuredGrid(mesh, vtk_file, node_coords);
+      _readCellsUnstructuredGrid(mesh, vtk_file, cells_nb_node, cells_type, cells_connectivity);
+      total_time += platform::getRealTime() - begin_time;
+
+      if (!has_ref_values) {
+        ref_node_coords = node_coords;
+        ref_cells_nb_node = cells_nb_node;
+        ref_cells_connectivity = cells_connectivity;
+        ref_cells_type = cells_type;
+        has_ref_values = true;
+        continue;
+      }
+      if (node_coords != ref_node_coords)
+        ARCANE_FATAL("Bad node coordinates for VTK read benchmark use_stream={0} iteration={1}", use_stream, i);
+      if (cells_nb_node != ref_cells_nb_node || cells_type != ref_cells_type)
+        ARCANE_FATAL("Bad cell types for VTK read benchmark use_stream={0} iteration={1}", use_stream, i);
+      if (cells_connectivity != ref_cells_connectivity)
+        ARCANE_FATAL("Bad cell connectivity for VTK read benchmark use_stream={0} iteration={1}", use_stream, i);
+    }
+    Real total_size_mb = static_cast<Real>(file_length) * nb_iteration / 1.0e6;
+    info() << "VTK read benchmark use_stream=" << use_stream
+           << " nb_iteration=" << nb_iteration
+           << " time=" << total_time << " (s)"
+           << " throughput=" << ((total_time > 0.0) ? (total_size_mb / total_time) : 0.0) << " (MB/s)";
+  }
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
 /*!
  * \brief Permet de lire un fichier vtk contenant une STRUCTURED_GRID.
  *
@@ -1010,31 +1372,20 @@ _readNodesUnstructuredGrid(IMesh* mesh, VtkFile& vtk_file, Array<Real3>& node_co
   info() << " Info: " << nb_node;
 
   // Lecture les coordonnées
+  // Les coordonnées sont lues directement dans \a node_coords vu comme
+  // un tableau de 3*nb_node réels.
+  static_assert(sizeof(Real3) == 3 * sizeof(Real), "Bad sizeof(Real3)");
   node_coords.resize(nb_node);
   {
+    ArrayView<Real> coords(nb_node * 3, reinterpret_cast<Real*>(node_coords.data()));
     if (vtk_file.isEqualString(data_type_str, "int")) {
-      for (Integer i = 0; i < nb_node; ++i) {
-        Real nx = vtk_file.getInt();
-        Real ny = vtk_file.getInt();
-        Real nz = vtk_file.getInt();
-        node_coords[i] = Real3(nx, ny, nz);
-      }
+      vtk_file.getValues<int>(coords);
     }
     else if (vtk_file.isEqualString(data_type_str, "float")) {
-      for (Integer i = 0; i < nb_node; ++i) {
-        Real nx = vtk_file.getFloat();
-        Real ny = vtk_file.getFloat();
-        Real nz = vtk_file.getFloat();
-        node_coords[i] = Real3(nx, ny, nz);
-      }
+      vtk_file.getValues<float>(coords);
     }
     else if (vtk_file.isEqualString(data_type_str, "double")) {
-      for (Integer i = 0; i < nb_node; ++i) {
-        Real nx = vtk_file.getDouble();
-        Real ny = vtk_file.getDouble();
-        Real nz = vtk_file.getDouble();
-        node_coords[i] = Real3(nx, ny, nz);
-      }
+      vtk_file.getValues<double>(coords);
     }
     else {
       throw IOException(func_name, "Invalid type name");
@@ -1094,16 +1445,27 @@ _readCellsUnstructuredGrid(IMesh* mesh, VtkFile& vtk_file,
   cells_connectivity.resize(nb_cell_node);
 
   {
+    // Lit en une fois le bloc contenant pour chaque maille son nombre
+    // de noeuds suivi de ses noeuds.
+    UniqueArray<Int32> cells_values(nb_cell_node);
+    vtk_file.getValues<int>(cells_values.view());
     Integer connectivity_index = 0;
+    Integer value_index = 0;
     for (Integer i = 0; i < nb_cell; ++i) {
-      Integer n = vtk_file.getInt();
+      if (value_index >= nb_cell_node)
+        ARCANE_THROW(IOException, "Bad number of values in CELLS (n={0})", nb_cell_node);
+      Integer n = cells_values[value_index];
+      ++value_index;
+      if (n < 0 || (value_index + n) > nb_cell_node)
+        ARCANE_THROW(IOException, "Bad number of nodes '{0}' for cell '{1}'", n, i);
       cells_nb_node[i] = n;
       for (Integer j = 0; j < n; ++j) {
-        Integer id = vtk_file.getInt();
-        cells_connectivity[connectivity_index] = id;
+        cells_connectivity[connectivity_index] = cells_values[value_index];
         ++connectivity_index;
+        ++value_index;
       }
     }
+    cells_connectivity.resize(connectivity_index);
   }
 
   _readMetadata(mesh, vtk_file);
@@ -1127,8 +1489,10 @@ _readCellsUnstructuredGrid(IMesh* mesh, VtkFile& vtk_file,
     }
   }
 
+  UniqueArray<Int32> vtk_cells_type(nb_cell);
+  vtk_file.getValues<int>(vtk_cells_type.view());
   for (Integer i = 0; i < nb_cell; ++i) {
-    Integer vtk_ct = vtk_file.getInt();
+    Integer vtk_ct = vtk_cells_type[i];
     Int16 it = vtkToArcaneCellType(vtk_ct, cells_nb_node[i]);
     cells_type[i] = ItemTypeId{ it };
   }
@@ -1367,13 +1731,12 @@ _readFacesMesh(IMesh* mesh, const String& file_name, const String& dir_name,
 {
   ARCANE_UNUSED(dir_name);
 
-  std::ifstream ifile(file_name.localstr(), std::ifstream::binary);
-  if (!ifile) {
+  VtkFile vtk_file;
+  if (vtk_file.openFile(file_name, m_use_stream_reader)) {
     info() << "No face descriptor file found '" << file_name << "'";
     return;
   }
 
-  VtkFile vtk_file(&ifile);
   const char* buf = 0;
 
   // Lecture de la description
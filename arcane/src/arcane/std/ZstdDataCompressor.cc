@@ -0,0 +1,123 @@
+﻿// -*- tab-width: 2; indent-tabs-mode: nil; coding: utf-8-with-signature -*-
+//-----------------------------------------------------------------------------
+// Copyright 2000-2024 CEA (www.cea.fr) IFPEN (www.ifpenergiesnouvelles.com)
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: Apache-2.0
+//-----------------------------------------------------------------------------
+/*---------------------------------------------------------------------------*/
+/* ZstdDataCompressor.cc                                       (C) 2000-2024 */
+/*                                                                           */
+/* Service de compression utilisant la bibliothèque 'zstd'.                  */
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+#include "arcane/utils/IOException.h"
+#include "arcane/utils/FatalErrorException.h"
+#include "arcane/utils/Array.h"
+#include "arcane/utils/TraceInfo.h"
+#include "arcane/utils/ValueConvert.h"
+#include "arcane/utils/IDataCompressor.h"
+
+#include "arcane/core/FactoryService.h"
+#include "arcane/core/AbstractService.h"
+
+#include <zstd.h>
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+namespace Arcane
+{
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+/*!
+ * \brief Service de compression utilisant la bibliothèque 'zstd'.
+ *
+ * Le niveau de compression peut être spécifié via la variable
+ * d'environnement ARCANE_ZSTD_LEVEL. Il doit être compris entre
+ * ZSTD_minCLevel() et ZSTD_maxCLevel(). Par défaut, on utilise le niveau
+ * par défaut de 'zstd' (ZSTD_CLEVEL_DEFAULT).
+ *
+ * Les méthodes compress() et decompress() n'utilisent pas de contexte
+ * partagé et peuvent donc être appelées simultanément par plusieurs threads.
+ */
+class ZstdDataCompressor
+: public AbstractService
+, public IDataCompressor
+{
+ public:
+
+  explicit ZstdDataCompressor(const ServiceBuildInfo& sbi)
+  : AbstractService(sbi)
+  , m_name(sbi.serviceInfo()->localName())
+  {
+  }
+
+ public:
+
+  void build() override
+  {
+    if (auto v = Convert::Type<Int32>::tryParseFromEnvironment("ARCANE_ZSTD_LEVEL", true)) {
+      int level = v.value();
+      if (level < ZSTD_minCLevel() || level > ZSTD_maxCLevel())
+        ARCANE_FATAL("Invalid value '{0}' for ARCANE_ZSTD_LEVEL (min={1} max={2})",
+                     level, ZSTD_minCLevel(), ZSTD_maxCLevel());
+      m_level = level;
+      info() << "Using compression level '" << m_level << "' for 'zstd'";
+    }
+  }
+  String name() const override { return m_name; }
+  Int64 minCompressSize() const override { return 512; }
+  void compress(Span<const std::byte> values, Array<std::byte>& compressed_values) override
+  {
+    size_t input_size = static_cast<size_t>(values.size());
+    size_t dest_capacity = ZSTD_compressBound(input_size);
+    compressed_values.resize(static_cast<Int64>(dest_capacity));
+
+    size_t r = ZSTD_compress(compressed_values.data(), dest_capacity,
+                             values.data(), input_size, m_level);
+    if (ZSTD_isError(r))
+      ARCANE_THROW(IOException, "IO error during compression msg={0}", String(ZSTD_getErrorName(r)));
+    Int64 dest_len = static_cast<Int64>(r);
+    if (input_size > 0) {
+      Real ratio = (dest_len * 100.0) / static_cast<Real>(input_size);
+      info(5) << "Zstd compress level=" << m_level << " source_len=" << input_size
+              << " dest_len=" << dest_len << " ratio=" << ratio;
+    }
+    compressed_values.resize(dest_len);
+  }
+
+  void decompress(Span<const std::byte> compressed_values, Span<std::byte> values) override
+  {
+    size_t dest_len = static_cast<size_t>(values.size());
+    size_t source_len = static_cast<size_t>(compressed_values.size());
+
+    size_t r = ZSTD_decompress(values.data(), dest_len, compressed_values.data(), source_len);
+    info(5) << "Zstd decompress r=" << r << " source_len=" << source_len << " dest_len=" << dest_len;
+    if (ZSTD_isError(r))
+      ARCANE_THROW(IOException, "IO error during decompression msg={0}", String(ZSTD_getErrorName(r)));
+    if (r != dest_len)
+      ARCANE_THROW(IOException, "Bad size after decompression expected={0} current={1}", values.size(), static_cast<Int64>(r));
+  }
+
+ private:
+
+  String m_name;
+  int m_level = ZSTD_CLEVEL_DEFAULT;
+};
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+ARCANE_REGISTER_SERVICE(ZstdDataCompressor,
+                        ServiceProperty("ZstdDataCompressor", ST_Application | ST_CaseOption),
+                        ARCANE_SERVICE_INTERFACE(IDataCompressor));
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+} // End namespace Arcane
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
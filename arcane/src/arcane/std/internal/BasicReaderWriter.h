@@ -245,6 +245,7 @@ class BasicReaderWriterCommon
   static String _getArcaneDBTag();
   static String _getOwnMetatadaFile(const String& path, Int32 rank);
   static String _getArcaneDBFile(const String& path, Int32 rank);
+  static String _getHashManifestFile(const String& path, Int32 rank);
   static String _getBasicVariableFile(Int32 version, const String& path, Int32 rank);
   static String _getBasicGroupFile(const String& path, const String& name, Int32 rank);
   static Ref<IDataCompressor> _createDeflater(IApplication* app, const String& name);
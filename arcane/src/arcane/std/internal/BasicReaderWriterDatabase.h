@@ -1,11 +1,11 @@
 ﻿// -*- tab-width: 2; indent-tabs-mode: nil; coding: utf-8-with-signature -*-
 //-----------------------------------------------------------------------------
-// Copyright 2000-2023 CEA (www.cea.fr) IFPEN (www.ifpenergiesnouvelles.com)
+// Copyright 2000-2024 CEA (www.cea.fr) IFPEN (www.ifpenergiesnouvelles.com)
 // See the top-level COPYRIGHT file for details.
 // SPDX-License-Identifier: Apache-2.0
 //-----------------------------------------------------------------------------
 /*---------------------------------------------------------------------------*/
-/* BasicReaderWriterDatabase.h                                 (C) 2000-2023 */
+/* BasicReaderWriterDatabase.h                                 (C) 2000-2024 */
 /*                                                                           */
 /* Base de donnée pour le service 'BasicReaderWriter'.                       */
 /*---------------------------------------------------------------------------*/
@@ -18,6 +18,8 @@
 #include "arcane/utils/String.h"
 #include "arcane/utils/TraceAccessor.h"
 
+#include <set>
+
 /*---------------------------------------------------------------------------*/
 /*---------------------------------------------------------------------------*/
 
@@ -28,6 +30,7 @@ namespace Arcane
 {
 class IDataCompressor;
 class IHashAlgorithm;
+class IHashDatabase;
 }
 
 namespace Arcane::impl
@@ -70,6 +73,27 @@ class KeyValueTextWriter
   Ref<IDataCompressor> dataCompressor() const;
   void setHashAlgorithm(Ref<IHashAlgorithm> v);
   Ref<IHashAlgorithm> hashAlgorithm() const;
+  /*!
+   * \brief Positionne la base de données de hash.
+   *
+   * Si \a chunk_size est strictement positif, les valeurs sont découpées
+   * en blocs de \a chunk_size octets et seul le hash de chaque bloc est
+   * écrit dans le fichier. Sinon, le hash est calculé sur l'ensemble de
+   * chaque valeur.
+   */
+  void setHashDatabase(Ref<IHashDatabase> v, Int64 chunk_size);
+  //! Liste des hash des valeurs écrites dans la base de données de hash
+  const std::set<String>& writtenHashes() const;
+  /*!
+   * \brief Positionne la taille des blocs pour la compression.
+   *
+   * Si \a chunk_size est strictement positif, les valeurs à compresser sont
+   * découpées en blocs de \a chunk_size octets compressés indépendamment
+   * et en parallèle. Un index des blocs est conservé avec les valeurs
+   * compressées pour permettre de décompresser aussi en parallèle.
+   */
+  void setCompressionChunkSize(Int64 chunk_size);
+  Int64 compressionChunkSize() const;
 
  private:
 
@@ -108,6 +132,13 @@ class KeyValueTextReader
   Ref<IDataCompressor> dataCompressor() const;
   void setHashAlgorithm(Ref<IHashAlgorithm> v);
   Ref<IHashAlgorithm> hashAlgorithm() const;
+  //! Positionne la base de données de hash (voir KeyValueTextWriter::setHashDatabase())
+  void setHashDatabase(Ref<IHashDatabase> v, Int64 chunk_size);
+  Ref<IHashDatabase> hashDatabase() const;
+  Int64 hashDatabaseChunkSize() const;
+  //! Positionne la taille des blocs pour la compression (voir KeyValueTextWriter::setCompressionChunkSize())
+  void setCompressionChunkSize(Int64 chunk_size);
+  Int64 compressionChunkSize() const;
 
  private:
 
@@ -18,6 +18,7 @@
 #include "arcane/std/internal/BasicReaderWriter.h"
 #include "arcane/std/internal/ParallelDataWriter.h"
 
+#include <functional>
 #include <map>
 #include <set>
 
@@ -36,10 +37,13 @@ class BasicWriter
 : public BasicReaderWriterCommon
 , public IDataWriter
 {
+  class AsyncWriteQueue;
+
  public:
 
   BasicWriter(IApplication* app, IParallelMng* pm, const String& path,
               eOpenMode open_mode, Integer version, bool want_parallel);
+  ~BasicWriter() override;
 
  public:
 
@@ -58,6 +62,21 @@ class BasicWriter
     _checkNoInit();
     m_data_compressor = data_compressor;
   }
+  /*!
+   * \brief Positionne la taille des blocs pour la compression.
+   *
+   * Si \a chunk_size est strictement positif, les valeurs sont découpées en
+   * blocs de \a chunk_size octets compressés en parallèle
+   * (voir KeyValueTextWriter::setCompressionChunkSize()).
+   *
+   * Cela n'est possible qu'à partir de la version 3 du format.
+   * Doit être appelé avant initialize().
+   */
+  void setDataCompressorChunkSize(Int64 chunk_size)
+  {
+    _checkNoInit();
+    m_data_compressor_chunk_size = chunk_size;
+  }
   //! Positionne le service de calcul de hash pour la comparaison. Doit être appelé avant initialize()
   void setCompareHashAlgorithm(Ref<IHashAlgorithm> hash_algo)
   {
@@ -70,8 +89,53 @@ class BasicWriter
     _checkNoInit();
     m_is_save_values = v;
   }
+  /*!
+   * \brief Utilise une base de données de hash dans le répertoire \a directory.
+   *
+   * Les valeurs sont découpées en blocs de \a chunk_size octets et seuls
+   * les blocs qui ne sont pas déjà dans la base sont écrits. Chaque rang
+   * écrit aussi un manifeste contenant la liste des hash utilisés par la
+   * protection (voir readHashManifests()).
+   *
+   * Cela n'est possible qu'à partir de la version 3 du format.
+   * Doit être appelé avant initialize().
+   */
+  void setHashDatabase(const String& directory, Int64 chunk_size)
+  {
+    _checkNoInit();
+    m_hash_database_directory = directory;
+    m_hash_database_chunk_size = chunk_size;
+  }
+  /*!
+   * \brief Indique si l'écriture est asynchrone.
+   *
+   * En mode asynchrone, les valeurs des variables sont recopiées lors de
+   * l'appel à write() et la compression, le calcul des hash et l'écriture
+   * dans les fichiers sont effectués par un thread dédié. Il faut appeler
+   * waitWrite() pour attendre la fin des écritures.
+   *
+   * Doit être appelé avant initialize().
+   */
+  void setAsynchronousWrite(bool v)
+  {
+    _checkNoInit();
+    m_is_asynchronous_write = v;
+  }
   void initialize();
 
+  /*!
+   * \brief Attend la fin des écritures asynchrones.
+   *
+   * Si une erreur s'est produite lors d'une écriture asynchrone,
+   * l'exception correspondante est relancée.
+   */
+  void waitWrite();
+
+ public:
+
+  //! Ajoute à \a hashes les hash contenus dans les manifestes de la protection du répertoire \a path
+  static void readHashManifests(const String& path, std::set<String>& hashes);
+
  private:
 
   bool m_want_parallel = false;
@@ -79,7 +143,12 @@ class BasicWriter
   bool m_is_init = false;
   //! Indique si on sauve les valeurs
   bool m_is_save_values = true;
+  //! Indique si l'écriture est asynchrone
+  bool m_is_asynchronous_write = false;
   Int32 m_version = -1;
+  String m_hash_database_directory;
+  Int64 m_hash_database_chunk_size = 0;
+  Int64 m_data_compressor_chunk_size = 0;
 
   Ref<IDataCompressor> m_data_compressor;
   Ref<IHashAlgorithm> m_compare_hash_algorithm;
@@ -90,6 +159,7 @@ class BasicWriter
   std::set<ItemGroup> m_written_groups;
 
   ScopedPtrT<IGenericWriter> m_global_writer;
+  ScopedPtrT<AsyncWriteQueue> m_async_write_queue;
 
  private:
 
@@ -97,6 +167,9 @@ class BasicWriter
   String _computeCompareHash(IVariable* var, IData* write_data);
   Ref<ParallelDataWriter> _getWriter(IVariable* var);
   void _endWriteV3();
+  void _endWrite(bool is_master_io);
+  void _writeHashManifest();
+  void _addWriteFunction(std::function<void()> func);
   void _checkNoInit();
 };
 
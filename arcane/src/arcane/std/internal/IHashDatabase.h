@@ -1,11 +1,11 @@
 ﻿// -*- tab-width: 2; indent-tabs-mode: nil; coding: utf-8-with-signature -*-
 //-----------------------------------------------------------------------------
-// Copyright 2000-2023 CEA (www.cea.fr) IFPEN (www.ifpenergiesnouvelles.com)
+// Copyright 2000-2024 CEA (www.cea.fr) IFPEN (www.ifpenergiesnouvelles.com)
 // See the top-level COPYRIGHT file for details.
 // SPDX-License-Identifier: Apache-2.0
 //-----------------------------------------------------------------------------
 /*---------------------------------------------------------------------------*/
-/* IHashDatabase.h                                             (C) 2000-2023 */
+/* IHashDatabase.h                                             (C) 2000-2024 */
 /*                                                                           */
 /* Interface d'une base de données de hash.                                  */
 /*---------------------------------------------------------------------------*/
@@ -19,6 +19,8 @@
 
 #include "arcane/utils/String.h"
 
+#include <set>
+
 /*---------------------------------------------------------------------------*/
 /*---------------------------------------------------------------------------*/
 
@@ -116,6 +118,13 @@ class IHashDatabase
 
   virtual void writeValues(const HashDatabaseWriteArgs& args, HashDatabaseWriteResult& result) = 0;
   virtual void readValues(const HashDatabaseReadArgs& args) = 0;
+
+  /*!
+   * \brief Supprime de la base les valeurs dont le hash n'est pas dans \a referenced_hashes.
+   *
+   * \return le nombre de valeurs supprimées.
+   */
+  virtual Int64 removeUnreferencedValues(const std::set<String>& referenced_hashes) = 0;
 };
 
 /*---------------------------------------------------------------------------*/
@@ -51,6 +51,8 @@ set(ARCANE_SOURCES
   VoronoiMeshIOService.cc
   MeshPartitionerBase.cc
   MeshPartitionerBase.h
+  GeometricMeshPartitioner.cc
+  TypesGeometricMeshPartitioner.h
   PapiPerformanceService.h
   ProfilingInfo.cc
   ProfilingInfo.h
@@ -141,6 +143,7 @@ set(AXL_FILES
   MetisMeshPartitioner
   ZoltanMeshPartitioner
   PTScotchMeshPartitioner
+  GeometricMeshPartitioner
   Master
   UnitTest
   Cartesian2DMeshGenerator
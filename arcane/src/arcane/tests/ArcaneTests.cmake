@@ -130,6 +130,22 @@ macro(arcane_add_test_sequential_task test_name case_file nb_task)
   endif()
 endmacro()
 
+# Ajoute un test utilisant l'implémentation des tâches 'StdTaskImplementation'.
+# Contrairement à arcane_add_test_sequential_task(), ce test ne nécessite pas les TBB.
+macro(arcane_add_test_sequential_std_task test_name case_file nb_task)
+  if(ARCANE_HAS_STD_TASKS)
+    if(VERBOSE)
+      message(STATUS "    Add Test StdTask OPT=${test_name} ${case_file}")
+    endif()
+    set(_TEST_NAME ${test_name}_task${nb_task})
+    arcane_get_case_path(${case_file})
+    arcane_add_test_direct(NAME ${_TEST_NAME}
+      COMMAND ${ARCANE_TEST_LAUNCH_COMMAND} -K ${nb_task} -A,TaskService=Std ${ARGN} ${full_case_file}
+      WORKING_DIRECTORY ${ARCANE_TEST_WORKDIR})
+    set_tests_properties(${_TEST_NAME} PROPERTIES PROCESSORS ${nb_task})
+  endif()
+endmacro()
+
 # Ajoute un test parallele en mode mémoire partagée
 macro(arcane_add_test_parallel_thread test_name case_file nb_proc)
   if(NOT ARCANE_USE_MPC)
@@ -1,11 +1,11 @@
 ﻿// -*- tab-width: 2; indent-tabs-mode: nil; coding: utf-8-with-signature -*-
 //-----------------------------------------------------------------------------
-// Copyright 2000-2022 CEA (www.cea.fr) IFPEN (www.ifpenergiesnouvelles.com)
+// Copyright 2000-2024 CEA (www.cea.fr) IFPEN (www.ifpenergiesnouvelles.com)
 // See the top-level COPYRIGHT file for details.
 // SPDX-License-Identifier: Apache-2.0
 //-----------------------------------------------------------------------------
 /*---------------------------------------------------------------------------*/
-/* CheckpointTesterService.cc                                  (C) 2000-2022 */
+/* CheckpointTesterService.cc                                  (C) 2000-2024 */
 /*                                                                           */
 /* Service de test des protections/reprises.                                 */
 /*---------------------------------------------------------------------------*/
@@ -13,6 +13,8 @@
 
 #include "arcane/utils/OStringStream.h"
 #include "arcane/utils/ArrayShape.h"
+#include "arcane/utils/PlatformUtils.h"
+#include "arcane/utils/ValueConvert.h"
 
 #include "arcane/BasicTimeLoopService.h"
 #include "arcane/tests/StdArrayMeshVariables.h"
@@ -35,6 +37,14 @@
 #include "arcane/IPrimaryMesh.h"
 #include "arcane/IMainFactory.h"
 #include "arcane/IParallelMng.h"
+#include "arcane/IParallelReplication.h"
+#include "arcane/ICheckpointMng.h"
+#include "arcane/CheckpointInfo.h"
+#include "arcane/Directory.h"
+
+#include <set>
+#include <filesystem>
+#include <fstream>
 
 /*---------------------------------------------------------------------------*/
 /*---------------------------------------------------------------------------*/
@@ -95,6 +105,18 @@ class CheckpointTesterService
   VariableCellArrayReal m_variable_with_shape;
   IItemFamily* m_particle_family;
   ObserverPool m_observer_pool;
+  //! Indique si on vérifie la publication des protections asynchrones
+  bool m_is_check_async_write = false;
+  //! Indique si \a m_checkpoint_info_before_write est valide
+  bool m_has_checkpoint_info_before_write = false;
+  //! Contenu de 'checkpoint_info.xml' avant la dernière protection
+  ByteUniqueArray m_checkpoint_info_before_write;
+  //! Indique si une protection a été écrite depuis le début de l'itération
+  bool m_has_new_checkpoint = false;
+  //! Nombre de vérifications de la base de données de hash effectuées
+  Int32 m_nb_check_hash_database = 0;
+  //! Hash présents dans la base lors de la dernière vérification
+  std::set<String> m_checked_hashes;
 
  private:
 
@@ -106,6 +128,10 @@ class CheckpointTesterService
   String _getProperties();
   void _checkConnectivity();
   void _checkConnectivity(IItemFamily* family);
+  void _checkAsyncCheckpointInfo(Integer current_iteration);
+  void _checkHashDatabase();
+  void _notifyCheckpointWrite() { m_has_new_checkpoint = true; }
+  void _readHashManifests(const String& path, std::set<String>& hashes);
 };
 
 /*---------------------------------------------------------------------------*/
@@ -143,6 +169,13 @@ CheckpointTesterService(const ServiceBuildInfo& sbi)
   m_observer_pool.addObserver(this,
                               &CheckpointTesterService::_savePropertiesInVariable,
                               subDomain()->variableMng()->writeObservable());
+  if (auto v = Convert::Type<Int32>::tryParseFromEnvironment("ARCANE_TEST_CHECK_ASYNC_WRITE", true))
+    m_is_check_async_write = (v.value() != 0);
+  // Note qu'une protection est écrite pour vérifier la base de hash
+  // à l'itération suivante.
+  m_observer_pool.addObserver(this,
+                              &CheckpointTesterService::_notifyCheckpointWrite,
+                              subDomain()->checkpointMng()->writeObservable());
 }
 
 /*---------------------------------------------------------------------------*/
@@ -328,11 +361,203 @@ onTimeLoopBeginLoop()
     tm->stopComputeLoop(false);
   }
 
+  if (m_is_check_async_write)
+    _checkAsyncCheckpointInfo(current_iteration);
+
+  if (m_has_new_checkpoint){
+    m_has_new_checkpoint = false;
+    if (!options()->hashDatabaseDirectory().empty())
+      _checkHashDatabase();
+  }
+
   if ((current_iteration%CHECKPOINT_PERIOD)==0){
     _writeCheckpoint();
   }
 }
 
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+/*!
+ * \brief Vérifie qu'une protection asynchrone n'est pas publiée avant
+ * la fin de son écriture.
+ *
+ * La protection est écrite à la fin des itérations multiples de
+ * CHECKPOINT_PERIOD et son écriture n'est attendue qu'à la protection
+ * suivante ou en fin de calcul. Au début de l'itération suivante, le calcul
+ * se poursuit donc alors que l'écriture est en cours et le fichier
+ * 'checkpoint_info.xml' ne doit pas avoir été modifié. Les reprises
+ * effectuées par le test vérifient ensuite que la protection a bien été
+ * publiée en fin de calcul.
+ */
+void CheckpointTesterService::
+_checkAsyncCheckpointInfo(Integer current_iteration)
+{
+  ISubDomain* sd = subDomain();
+  if (!sd->allReplicaParallelMng()->isMasterIO())
+    return;
+
+  String info_file = Directory(sd->exportDirectory()).file("checkpoint_info.xml");
+  ByteUniqueArray infos;
+  // Le fichier n'existe pas si aucune protection n'a encore été publiée.
+  if (platform::readAllFile(info_file, false, infos))
+    infos.clear();
+
+  if ((current_iteration%CHECKPOINT_PERIOD)==1 && m_has_checkpoint_info_before_write){
+    if (infos!=m_checkpoint_info_before_write)
+      ARCANE_FATAL("File '{0}' has been updated before the end of the asynchronous write"
+                   " iteration={1}", info_file, current_iteration);
+    info() << "Asynchronous checkpoint is not yet published iteration=" << current_iteration;
+  }
+
+  m_has_checkpoint_info_before_write = ((current_iteration%CHECKPOINT_PERIOD)==0);
+  if (m_has_checkpoint_info_before_write)
+    m_checkpoint_info_before_write = infos;
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+/*!
+ * \brief Ajoute à \a hashes les hash des manifestes de la protection
+ * du répertoire \a path.
+ *
+ * Chaque rang écrit dans ce répertoire un manifeste de nom
+ * 'arcane_hash_manifest_n*' qui contient un hash par ligne.
+ */
+void CheckpointTesterService::
+_readHashManifests(const String& path, std::set<String>& hashes)
+{
+  namespace fs = std::filesystem;
+  std::error_code ec;
+  fs::path dir_path(path.localstr());
+  if (!fs::is_directory(dir_path, ec))
+    return;
+  const std::string prefix = "arcane_hash_manifest_n";
+  for (const fs::directory_entry& entry : fs::directory_iterator(dir_path, ec)) {
+    std::string name = entry.path().filename().string();
+    if (name.rfind(prefix, 0) != 0)
+      continue;
+    std::ifstream ifile(entry.path());
+    std::string hash_value;
+    while (ifile >> hash_value)
+      hashes.insert(String(hash_value));
+  }
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+/*!
+ * \brief Vérifie la base de données de hash après une protection.
+ *
+ * Vérifie que:
+ * - tous les blocs de la dernière protection sont dans la base,
+ * - les fichiers ajoutés depuis la vérification précédente sont des blocs
+ *   de cette protection et que les blocs qui n'ont pas changé depuis la
+ *   protection précédente ne sont pas écrits à nouveau,
+ * - si le service de protection supprime les blocs non utilisés, la base
+ *   ne contient que des blocs référencés par les protections existantes.
+ *   Pour le vérifier, un fichier qui n'est utilisé par aucune protection
+ *   est ajouté à la base et doit avoir été supprimé lors de la
+ *   vérification suivante.
+ *
+ * La protection doit être écrite de manière synchrone pour que la
+ * vérification soit faite au début de l'itération qui suit.
+ */
+void CheckpointTesterService::
+_checkHashDatabase()
+{
+  namespace fs = std::filesystem;
+  ISubDomain* sd = subDomain();
+  IParallelMng* pm = sd->parallelMng();
+  // Les réplicats écrivent les mêmes blocs dans la base.
+  if (pm->replication()->hasReplication())
+    return;
+
+  // Lit les informations de la dernière protection. Cette opération est
+  // collective.
+  CheckpointInfo ci = sd->checkpointMng()->readDefaultCheckpointInfo();
+  Int32 checkpoint_index = ci.checkpointIndex();
+  String base_path = Directory(ci.directory()).file("arcanedump");
+  String write_path = base_path + "_n" + checkpoint_index;
+
+  // Il faut que tous les rangs aient écrit leur manifeste.
+  pm->barrier();
+  if (!pm->isMasterIO())
+    return;
+
+  String hash_database_directory = options()->hashDatabaseDirectory();
+  const bool is_garbage_collect = options()->hashDatabaseGarbageCollect();
+  String unreferenced_hash_dir = hash_database_directory + "/f/ff";
+  String unreferenced_hash_file = unreferenced_hash_dir + "/ffffffffTestUnreferencedHash";
+
+  std::set<String> hashes;
+  std::error_code ec;
+  fs::path db_path(hash_database_directory.localstr());
+  for (auto iter = fs::recursive_directory_iterator(db_path, ec); iter != fs::recursive_directory_iterator(); iter.increment(ec)) {
+    if (ec)
+      ARCANE_FATAL("Can not read directory '{0}' error='{1}'", hash_database_directory, ec.message());
+    if (iter.depth() == 2 && iter->is_regular_file())
+      hashes.insert(String(iter->path().filename().string()));
+  }
+
+  std::set<String> current_hashes;
+  _readHashManifests(write_path, current_hashes);
+  if (current_hashes.empty())
+    ARCANE_FATAL("No hash in manifests of checkpoint '{0}'", write_path);
+  Int64 nb_reused = 0;
+  for (const String& hash : current_hashes) {
+    if (hashes.find(hash) == hashes.end())
+      ARCANE_FATAL("Hash '{0}' of checkpoint '{1}' is missing in hash database", hash, write_path);
+    if (m_checked_hashes.find(hash) != m_checked_hashes.end())
+      ++nb_reused;
+  }
+
+  // Les fichiers présents avant la première vérification peuvent provenir
+  // d'une exécution précédente.
+  Int64 nb_new = 0;
+  if (m_nb_check_hash_database > 0) {
+    for (const String& hash : hashes) {
+      if (m_checked_hashes.find(hash) != m_checked_hashes.end())
+        continue;
+      ++nb_new;
+      if (current_hashes.find(hash) == current_hashes.end())
+        ARCANE_FATAL("New hash '{0}' is not used by checkpoint '{1}'", hash, write_path);
+    }
+    // Une partie des variables (par exemple celles du maillage) ne change
+    // pas entre deux protections et leurs blocs doivent être réutilisés.
+    if (nb_reused == 0)
+      ARCANE_FATAL("No hash reused from previous checkpoint for checkpoint '{0}'", write_path);
+    const Int64 nb_expected_new = static_cast<Int64>(current_hashes.size()) - nb_reused;
+    if (nb_new != nb_expected_new)
+      ARCANE_FATAL("Bad number of new hashes n={0} expected={1}", nb_new, nb_expected_new);
+  }
+
+  if (is_garbage_collect) {
+    if (platform::isFileReadable(unreferenced_hash_file))
+      ARCANE_FATAL("Unreferenced file '{0}' has not been removed", unreferenced_hash_file);
+    std::set<String> referenced_hashes;
+    for (Int32 i = 0; i <= checkpoint_index; ++i)
+      _readHashManifests(base_path + "_n" + i, referenced_hashes);
+    for (const String& hash : hashes) {
+      if (referenced_hashes.find(hash) == referenced_hashes.end())
+        ARCANE_FATAL("Unreferenced hash '{0}' has not been removed", hash);
+    }
+  }
+
+  info() << "Check hash database nb_hash=" << hashes.size()
+         << " nb_checkpoint_hash=" << current_hashes.size()
+         << " nb_reused=" << nb_reused << " nb_new=" << nb_new;
+  m_checked_hashes = hashes;
+  ++m_nb_check_hash_database;
+
+  // Ajoute un fichier qui n'est utilisé par aucune protection et qui doit
+  // donc être supprimé lors de la prochaine protection.
+  if (is_garbage_collect) {
+    platform::recursiveCreateDirectory(unreferenced_hash_dir);
+    std::ofstream ofile(unreferenced_hash_file.localstr());
+    ofile << "unused";
+  }
+}
+
 /*---------------------------------------------------------------------------*/
 /*---------------------------------------------------------------------------*/
 
@@ -1,6 +1,6 @@
 ﻿// -*- tab-width: 2; indent-tabs-mode: nil; coding: utf-8-with-signature -*-
 //-----------------------------------------------------------------------------
-// Copyright 2000-2023 CEA (www.cea.fr) IFPEN (www.ifpenergiesnouvelles.com)
+// Copyright 2000-2024 CEA (www.cea.fr) IFPEN (www.ifpenergiesnouvelles.com)
 // See the top-level COPYRIGHT file for details.
 // SPDX-License-Identifier: Apache-2.0
 //-----------------------------------------------------------------------------
@@ -1660,6 +1660,46 @@ _testFindOneItem()
     if (cell1!=cell2)
       ARCANE_FATAL("Unexpected different cell cell1={0} cell2={1}",ItemPrinter(cell1),ItemPrinter(cell2));
   }
+
+  // Teste la conversion par paquets avec des entités non trouvées.
+  // Répète les noeuds pour dépasser la taille à partir de laquelle
+  // la conversion est faite en concurrence.
+  {
+    IItemFamily* node_family = mesh()->nodeFamily();
+    NodeGroup all_nodes = allNodes();
+    Int64 max_uid = 0;
+    ENUMERATE_(Node,inode,all_nodes){
+      max_uid = math::max(max_uid,inode->uniqueId().asInt64());
+    }
+    UniqueArray<Int64> node_uids;
+    UniqueArray<Int32> expected_lids;
+    UniqueArray<Int32> expected_not_found;
+    while (node_uids.size()<120000){
+      ENUMERATE_(Node,inode,all_nodes){
+        Int32 index = node_uids.size();
+        if ((index % 1000)==3){
+          expected_not_found.add(index);
+          node_uids.add(max_uid + 1 + index);
+          expected_lids.add(NULL_ITEM_LOCAL_ID);
+        }
+        else if ((index % 1000)==7){
+          node_uids.add(NULL_ITEM_UNIQUE_ID);
+          expected_lids.add(NULL_ITEM_LOCAL_ID);
+        }
+        else{
+          node_uids.add(inode->uniqueId().asInt64());
+          expected_lids.add(inode.itemLocalId());
+        }
+      }
+    }
+    UniqueArray<Int32> node_lids(node_uids.size());
+    UniqueArray<Int32> not_found_indexes;
+    node_family->itemsUniqueIdToLocalId(node_lids,node_uids,not_found_indexes);
+    if (node_lids!=expected_lids)
+      ARCANE_FATAL("Bad localIds in batched conversion");
+    if (not_found_indexes!=expected_not_found)
+      ARCANE_FATAL("Bad not found indexes n={0} expected={1}",not_found_indexes.size(),expected_not_found.size());
+  }
 }
 
 /*---------------------------------------------------------------------------*/
@@ -48,6 +48,7 @@
 #include "arcane/core/ParallelMngUtils.h"
 #include "arcane/core/IVariableMng.h"
 #include "arcane/core/IVariableSynchronizerMng.h"
+#include "arcane/core/ItemPrinter.h"
 
 #include "arcane/SerializeBuffer.h"
 
@@ -64,6 +65,7 @@
 #include "arcane/IApplication.h"
 #include "arcane/IMainFactory.h"
 
+#include <limits>
 #include <map>
 #include <set>
 
@@ -317,6 +319,10 @@ class ParallelTesterModule
 
   void _testSynchronize();
   void _testMultiSynchronize();
+  void _testSplitSynchronize();
+  void _testDeltaSynchronize();
+  void _testCompressSynchronize();
+  void _testInnerBoundaryOwnGroups();
   void _testSameValuesOnAllReplica();
   void _testDifferentValuesOnAllReplica();
   void _testAccumulate();
@@ -573,6 +579,10 @@ testLoop()
   if (m_nb_test_synchronize>=1){
     _testSynchronize();
     _testMultiSynchronize();
+    _testSplitSynchronize();
+    _testDeltaSynchronize();
+    _testCompressSynchronize();
+    _testInnerBoundaryOwnGroups();
     _testSameValuesOnAllReplica();
     _testDifferentValuesOnAllReplica();
   }
@@ -924,6 +934,287 @@ _testMultiSynchronize()
 /*---------------------------------------------------------------------------*/
 /*---------------------------------------------------------------------------*/
 
+/*!
+ * \brief Teste la synchronisation non bloquante (beginSynchronize()/endSynchronize()).
+ */
+void ParallelTesterModule::
+_testSplitSynchronize()
+{
+  info() << "Test split synchronize";
+
+  IMesh* mesh = defaultMesh();
+
+  Integer wanted_value = m_global_iteration() + 3;
+  {
+    m_nodes.setValues(wanted_value,mesh->ownNodes());
+    m_faces.setValues(wanted_value,mesh->ownFaces());
+    m_cells.setValues(wanted_value,mesh->ownCells());
+    m_array_nodes.setValues(wanted_value,mesh->ownNodes());
+    m_array_cells.setValues(wanted_value,mesh->ownCells());
+  }
+
+  IVariableSynchronizer* node_sync = mesh->nodeFamily()->allItemsSynchronizer();
+  IVariableSynchronizer* face_sync = mesh->faceFamily()->allItemsSynchronizer();
+  IVariableSynchronizer* cell_sync = mesh->cellFamily()->allItemsSynchronizer();
+
+  for( Integer i=0; i<m_nb_test_synchronize; ++i ){
+    // Plusieurs synchronisations non bloquantes simultanées sur des familles différentes
+    VariableList node_vars;
+    m_nodes.addToCollection(node_vars);
+    m_array_nodes.addToCollection(node_vars);
+    node_sync->beginSynchronize(node_vars);
+
+    VariableList face_vars;
+    m_faces.addToCollection(face_vars);
+    face_sync->beginSynchronize(face_vars);
+
+    // Synchronisation non bloquante variable par variable. Une synchronisation
+    // bloquante est possible pendant une synchronisation non bloquante.
+    VariableList cell_vars;
+    m_cells.addToCollection(cell_vars);
+    for( VariableCollection::Enumerator ivar(cell_vars); ++ivar; ){
+      cell_sync->beginSynchronize(*ivar);
+      if (!cell_sync->hasPendingSynchronize())
+        ARCANE_FATAL("Split synchronization should be pending");
+      m_array_cells.synchronize();
+      cell_sync->endSynchronize();
+    }
+
+    face_sync->endSynchronize();
+    node_sync->endSynchronize();
+    if (node_sync->hasPendingSynchronize())
+      ARCANE_FATAL("Split synchronization should be done");
+  }
+
+  {
+    Integer nb_error = 0;
+    nb_error += m_nodes.checkValues(wanted_value,mesh->allNodes());
+    nb_error += m_faces.checkValues(wanted_value,mesh->allFaces());
+    nb_error += m_cells.checkValues(wanted_value,mesh->allCells());
+    nb_error += m_array_nodes.checkValues(wanted_value,mesh->allNodes());
+    nb_error += m_array_cells.checkValues(wanted_value,mesh->allCells());
+    info() << "NB ERROR SPLIT=" << nb_error;
+    if (nb_error!=0)
+      ARCANE_FATAL("Error in split synchronize test: n={0}",nb_error);
+  }
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+/*!
+ * \brief Teste la synchronisation différentielle (IVariable::PDeltaSync).
+ *
+ * Seule une partie des valeurs est modifiée entre deux synchronisations
+ * et les valeurs des entités fantômes sont modifiées localement pour
+ * vérifier qu'elles sont bien reconstruites.
+ */
+void ParallelTesterModule::
+_testDeltaSynchronize()
+{
+  info() << "Test delta synchronize";
+
+  IMesh* mesh = defaultMesh();
+  VariableCellReal var_delta(VariableBuildInfo(mesh, "TestDeltaSyncScalar", IVariable::PDeltaSync));
+  VariableCellArrayReal var_array_delta(VariableBuildInfo(mesh, "TestDeltaSyncArray", IVariable::PDeltaSync));
+
+  auto compute_value = [](Cell cell, Integer step, Integer k) -> Real {
+    Int64 uid = cell.uniqueId().asInt64();
+    // Seule une entité sur 5 change de valeur à chaque étape
+    Integer modified_step = ((uid % 5) == 0) ? step : 0;
+    return static_cast<Real>(uid * 10 + k + modified_step * 1000);
+  };
+
+  Integer nb_error = 0;
+  Integer nb_step = 4;
+  for (Integer step = 0; step < nb_step; ++step) {
+    // Change la taille des tableaux pour vérifier la gestion d'un
+    // changement de taille du buffer.
+    Integer dim2_size = (step < 2) ? 2 : 3;
+    var_array_delta.resize(dim2_size);
+    ENUMERATE_CELL(icell, mesh->allCells()) {
+      Cell cell = *icell;
+      bool is_own = cell.isOwn();
+      var_delta[icell] = (is_own) ? compute_value(cell, step, 0) : -1.0;
+      for (Integer k = 0; k < dim2_size; ++k)
+        var_array_delta[icell][k] = (is_own) ? compute_value(cell, step, k) : -1.0;
+    }
+    var_delta.synchronize();
+    var_array_delta.synchronize();
+    ENUMERATE_CELL(icell, mesh->allCells()) {
+      Cell cell = *icell;
+      if (var_delta[icell] != compute_value(cell, step, 0)) {
+        if (nb_error < 10)
+          info() << "Bad delta sync value cell=" << ItemPrinter(cell) << " step=" << step
+                 << " v=" << var_delta[icell] << " expected=" << compute_value(cell, step, 0);
+        ++nb_error;
+      }
+      for (Integer k = 0; k < dim2_size; ++k)
+        if (var_array_delta[icell][k] != compute_value(cell, step, k))
+          ++nb_error;
+    }
+  }
+  info() << "NB ERROR DELTA=" << nb_error;
+  if (nb_error != 0)
+    ARCANE_FATAL("Error in delta synchronize test: n={0}", nb_error);
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+/*!
+ * \brief Teste les seuils de compression spécifiques aux variables.
+ *
+ * Une variable a tous ses messages compressés, une autre aucun et la
+ * troisième utilise le seuil par défaut. Les variables sont synchronisées
+ * séparément puis via une synchronisation multiple.
+ *
+ * Les seuils ne sont utilisés que si la compression des synchronisations
+ * est active (ARCANE_SYNCHRONIZE_COMPRESSOR).
+ */
+void ParallelTesterModule::
+_testCompressSynchronize()
+{
+  info() << "Test compress synchronize";
+
+  IMesh* mesh = defaultMesh();
+  IVariableSynchronizerMng* sync_mng = mesh->variableMng()->synchronizerMng();
+  VariableCellReal var_always(VariableBuildInfo(mesh, "TestCompressSyncAlways"));
+  VariableCellArrayReal var_never(VariableBuildInfo(mesh, "TestCompressSyncNever"));
+  VariableCellReal var_default(VariableBuildInfo(mesh, "TestCompressSyncDefault"));
+  sync_mng->setSynchronizeCompressMinSize(var_always.variable(), 1);
+  sync_mng->setSynchronizeCompressMinSize(var_never.variable(), std::numeric_limits<Int64>::max());
+  const Integer dim2_size = 3;
+  var_never.resize(dim2_size);
+
+  auto compute_value = [](Cell cell, Integer k) -> Real {
+    return static_cast<Real>(cell.uniqueId().asInt64() * 10 + k);
+  };
+
+  Integer nb_error = 0;
+  for (Integer step = 0; step < 2; ++step) {
+    ENUMERATE_CELL (icell, mesh->allCells()) {
+      Cell cell = *icell;
+      bool is_own = cell.isOwn();
+      var_always[icell] = (is_own) ? compute_value(cell, step) : -1.0;
+      var_default[icell] = (is_own) ? compute_value(cell, step + 1) : -1.0;
+      for (Integer k = 0; k < dim2_size; ++k)
+        var_never[icell][k] = (is_own) ? compute_value(cell, step + k) : -1.0;
+    }
+    if (step == 0) {
+      var_always.synchronize();
+      var_never.synchronize();
+      var_default.synchronize();
+    }
+    else {
+      VariableList vars;
+      vars.add(var_always.variable());
+      vars.add(var_never.variable());
+      vars.add(var_default.variable());
+      mesh->cellFamily()->synchronize(vars);
+    }
+    ENUMERATE_CELL (icell, mesh->allCells()) {
+      Cell cell = *icell;
+      if (var_always[icell] != compute_value(cell, step))
+        ++nb_error;
+      if (var_default[icell] != compute_value(cell, step + 1))
+        ++nb_error;
+      for (Integer k = 0; k < dim2_size; ++k)
+        if (var_never[icell][k] != compute_value(cell, step + k))
+          ++nb_error;
+    }
+  }
+  sync_mng->setSynchronizeCompressMinSize(var_always.variable(), -1);
+  sync_mng->setSynchronizeCompressMinSize(var_never.variable(), -1);
+  info() << "NB ERROR COMPRESS=" << nb_error;
+  if (nb_error != 0)
+    ARCANE_FATAL("Error in compress synchronize test: n={0}", nb_error);
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+/*!
+ * \brief Teste les groupes des entités propres internes et au bord.
+ */
+void ParallelTesterModule::
+_testInnerBoundaryOwnGroups()
+{
+  info() << "Test inner/boundary own groups";
+
+  IMesh* mesh = defaultMesh();
+  IItemFamily* node_family = mesh->nodeFamily();
+
+  for( IItemFamily* family : { mesh->nodeFamily(), mesh->faceFamily(), mesh->cellFamily() } ){
+    ItemGroup all_items = family->allItems();
+    ItemGroup inner_items = all_items.innerOwn();
+    ItemGroup boundary_items = all_items.boundaryOwn();
+    info() << "Family=" << family->name() << " nb_own=" << all_items.own().size()
+           << " nb_inner=" << inner_items.size() << " nb_boundary=" << boundary_items.size();
+
+    // Vérifie que les deux groupes forment une partition des entités propres.
+    if (inner_items.size()+boundary_items.size()!=all_items.own().size())
+      ARCANE_FATAL("Bad number of inner and boundary items family={0}",family->name());
+    UniqueArray<Int32> markers(family->maxLocalId());
+    markers.fill(0);
+    ENUMERATE_ITEM(iitem,inner_items){
+      if (!(*iitem).isOwn())
+        ARCANE_FATAL("Ghost item in inner group");
+      ++markers[iitem.itemLocalId()];
+    }
+    ENUMERATE_ITEM(iitem,boundary_items){
+      if (!(*iitem).isOwn())
+        ARCANE_FATAL("Ghost item in boundary group");
+      ++markers[iitem.itemLocalId()];
+    }
+    ENUMERATE_ITEM(iitem,all_items.own()){
+      if (markers[iitem.itemLocalId()]!=1)
+        ARCANE_FATAL("Item '{0}' is not in exactly one group",ItemPrinter(*iitem));
+    }
+  }
+
+  // Vérifie qu'aucune maille interne n'a de noeud commun avec une maille fantôme.
+  {
+    UniqueArray<Int32> ghost_nodes(node_family->maxLocalId());
+    ghost_nodes.fill(0);
+    ENUMERATE_CELL(icell,allCells().ghost()){
+      for( NodeLocalId node : (*icell).nodeIds() )
+        ghost_nodes[node] = 1;
+    }
+    ENUMERATE_CELL(icell,allCells().innerOwn()){
+      for( NodeLocalId node : (*icell).nodeIds() )
+        if (ghost_nodes[node]!=0)
+          ARCANE_FATAL("Inner cell '{0}' is connected to a ghost cell",ItemPrinter(*icell));
+    }
+  }
+
+  // Utilise les groupes pendant une synchronisation non bloquante
+  {
+    Integer wanted_value = m_global_iteration() + 5;
+    m_cells.setValues(wanted_value,mesh->ownCells());
+    VariableList cell_vars;
+    m_cells.addToCollection(cell_vars);
+    IVariableSynchronizer* cell_sync = mesh->cellFamily()->allItemsSynchronizer();
+    cell_sync->beginSynchronize(cell_vars);
+    Int64 nb_inner = 0;
+    ENUMERATE_CELL(icell,allCells().innerOwn()){
+      ++nb_inner;
+    }
+    cell_sync->endSynchronize();
+    Int64 nb_boundary = 0;
+    ENUMERATE_CELL(icell,allCells().boundaryOwn()){
+      ++nb_boundary;
+    }
+    info() << "Overlap nb_inner=" << nb_inner << " nb_boundary=" << nb_boundary;
+    Integer nb_error = m_cells.checkValues(wanted_value,mesh->allCells());
+    if (nb_error!=0)
+      ARCANE_FATAL("Error in inner/boundary synchronize test: n={0}",nb_error);
+  }
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
 void ParallelTesterModule::
 _writeAccumulateInfos(std::ostream& ofile,eItemKind ik,const String& msg)
 {
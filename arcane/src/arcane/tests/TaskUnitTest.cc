@@ -1,11 +1,11 @@
 ﻿// -*- tab-width: 2; indent-tabs-mode: nil; coding: utf-8-with-signature -*-
 //-----------------------------------------------------------------------------
-// Copyright 2000-2023 CEA (www.cea.fr) IFPEN (www.ifpenergiesnouvelles.com)
+// Copyright 2000-2024 CEA (www.cea.fr) IFPEN (www.ifpenergiesnouvelles.com)
 // See the top-level COPYRIGHT file for details.
 // SPDX-License-Identifier: Apache-2.0
 //-----------------------------------------------------------------------------
 /*---------------------------------------------------------------------------*/
-/* TaskUnitTest.cc                                             (C) 2000-2023 */
+/* TaskUnitTest.cc                                             (C) 2000-2024 */
 /*                                                                           */
 /* Service de test des tâches.                                               */
 /*---------------------------------------------------------------------------*/
@@ -17,6 +17,10 @@
 #include "arcane/utils/Mutex.h"
 #include "arcane/utils/ValueChecker.h"
 #include "arcane/utils/TestLogger.h"
+#include "arcane/utils/OStringStream.h"
+#include "arcane/utils/Math.h"
+#include "arcane/utils/ForLoopRanges.h"
+#include "arcane/utils/ValueConvert.h"
 
 #include "arcane/BasicUnitTest.h"
 #include "arcane/IMesh.h"
@@ -670,6 +674,124 @@ class Test6
   SpinLock m_lock;
 };
 
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+/*
+ * \brief Mesure les performances de boucles similaires à celles
+ * de ModuleSimpleHydro.
+ *
+ * Permet de comparer les différentes implémentations des tâches
+ * (par exemple TBB et Std). Les valeurs calculées sont comparées
+ * avec celles d'une exécution séquentielle.
+ */
+class Test7
+: public TraceAccessor
+{
+ public:
+
+  Test7(ITraceMng* tm,Int32 nb_cell,Int32 nb_iteration)
+  : TraceAccessor(tm), m_nb_cell(nb_cell), m_nb_iteration(nb_iteration)
+  {
+  }
+
+  void exec()
+  {
+    m_density.resize(m_nb_cell);
+    m_internal_energy.resize(m_nb_cell);
+    m_volume.resize(m_nb_cell);
+    m_old_volume.resize(m_nb_cell);
+    m_pressure.resize(m_nb_cell);
+    m_sound_speed.resize(m_nb_cell);
+    for( Int32 i=0; i<m_nb_cell; ++i ){
+      m_density[i] = 1.0 + (i % 17) * 0.01;
+      m_internal_energy[i] = 2.5 + (i % 23) * 0.02;
+      m_volume[i] = 1.0e-3 * (1.0 + (i % 7) * 0.001);
+      m_old_volume[i] = m_volume[i] * 0.999;
+    }
+
+    // Calcul de référence en séquentiel
+    _computeEOS(0,m_nb_cell);
+    _computeInternalEnergy(0,m_nb_cell);
+    UniqueArray<Real> ref_pressure(m_pressure);
+    UniqueArray<Real> ref_energy(m_internal_energy);
+    UniqueArray<Real> ref_sound_speed(m_sound_speed);
+    // Remet l'énergie interne à sa valeur initiale
+    m_internal_energy.copy(ref_energy);
+
+    ParallelLoopOptions loop_options;
+    Real t0 = platform::getRealTime();
+    for( Int32 iter=0; iter<m_nb_iteration; ++iter ){
+      m_internal_energy.copy(ref_energy);
+      arcaneParallelFor(0,m_nb_cell,loop_options,[&](Int32 begin,Int32 size){ _computeEOS(begin,size); });
+      arcaneParallelFor(0,m_nb_cell,loop_options,[&](Int32 begin,Int32 size){ _computeInternalEnergy(begin,size); });
+    }
+    Real t1 = platform::getRealTime();
+
+    for( Int32 i=0; i<m_nb_cell; ++i ){
+      if (m_pressure[i]!=ref_pressure[i] || m_sound_speed[i]!=ref_sound_speed[i])
+        ARCANE_FATAL("Bad value for index '{0}' pressure={1} expected={2}",i,m_pressure[i],ref_pressure[i]);
+    }
+
+    // Boucle multi-dimensionnelle (maille x composante) dont on vérifie
+    // que chaque indice est traité une seule fois.
+    const Int32 nb_component = 3;
+    UniqueArray<Int32> nb_access(m_nb_cell*nb_component,0);
+    ParallelLoopOptions md_options;
+    md_options.setPartitioner(ParallelLoopOptions::Partitioner::Auto);
+    Real t2 = platform::getRealTime();
+    arcaneParallelFor(makeLoopRanges(m_nb_cell,nb_component),md_options,[&](ArrayIndex<2> idx){
+      ++nb_access[idx[0]*nb_component+idx[1]];
+    });
+    Real t3 = platform::getRealTime();
+    for( Int32 i=0, n=nb_access.size(); i<n; ++i )
+      if (nb_access[i]!=1)
+        ARCANE_FATAL("Bad number of access for index '{0}' n={1}",i,nb_access[i]);
+
+    OStringStream ostr;
+    TaskFactory::printInfos(ostr());
+    info() << "TEST7 impl='" << ostr.str() << "' nb_cell=" << m_nb_cell
+           << " nb_iteration=" << m_nb_iteration
+           << " hydro_loop_time=" << (t1-t0) << " md_loop_time=" << (t3-t2);
+  }
+
+ private:
+
+  Int32 m_nb_cell;
+  Int32 m_nb_iteration;
+  UniqueArray<Real> m_density;
+  UniqueArray<Real> m_internal_energy;
+  UniqueArray<Real> m_volume;
+  UniqueArray<Real> m_old_volume;
+  UniqueArray<Real> m_pressure;
+  UniqueArray<Real> m_sound_speed;
+
+ private:
+
+  // Equation d'état des gaz parfaits (comme dans ModuleSimpleHydro)
+  void _computeEOS(Int32 begin,Int32 size)
+  {
+    const Real adiabatic_cst = 1.4;
+    for( Int32 i=begin; i<(begin+size); ++i ){
+      Real pressure = (adiabatic_cst-1.0) * m_density[i] * m_internal_energy[i];
+      m_pressure[i] = pressure;
+      m_sound_speed[i] = math::sqrt(adiabatic_cst*pressure/m_density[i]);
+    }
+  }
+
+  // Mise à jour de l'énergie interne (comme dans ModuleSimpleHydro)
+  void _computeInternalEnergy(Int32 begin,Int32 size)
+  {
+    const Real adiabatic_cst = 1.4;
+    for( Int32 i=begin; i<(begin+size); ++i ){
+      Real x = 0.5*(adiabatic_cst-1.0);
+      Real density_ratio_maxi = m_density[i] * (m_volume[i]-m_old_volume[i]);
+      Real numer_accrois_nrj = 1.0 + x*density_ratio_maxi/m_volume[i];
+      Real denom_accrois_nrj = 1.0 - x*density_ratio_maxi/m_volume[i];
+      m_internal_energy[i] *= numer_accrois_nrj/denom_accrois_nrj;
+    }
+  }
+};
+
 } // namespace TaskTest
 
 /*---------------------------------------------------------------------------*/
@@ -775,6 +897,15 @@ executeTest()
   { TaskTest::Test6 t6(traceMng(),1023,4097,50); t6.exec(); }
   { TaskTest::Test6 t6(traceMng(),0,4000,100); t6.exec(); }
   { TaskTest::Test6 t6(traceMng(),0,200000,2000); t6.exec(); }
+  // Test7 est exécuté avec une petite taille pour vérifier les résultats.
+  // Pour mesurer les performances, il faut spécifier le nombre de mailles
+  // via la variable d'environnement ARCANE_TEST_TASK_BENCHMARK_SIZE
+  // (par exemple 1000000).
+  { TaskTest::Test7 t7(traceMng(),10000,2); t7.exec(); }
+  if (auto v = Convert::Type<Int32>::tryParseFromEnvironment("ARCANE_TEST_TASK_BENCHMARK_SIZE",true)){
+    TaskTest::Test7 t7(traceMng(),v.value(),10);
+    t7.exec();
+  }
 }
 
 /*---------------------------------------------------------------------------*/
@@ -15,9 +15,11 @@
 
 #include "arcane/utils/ValueChecker.h"
 #include "arcane/utils/MemoryView.h"
+#include "arcane/utils/PlatformUtils.h"
 
 #include "arcane/BasicUnitTest.h"
 #include "arcane/ServiceFactory.h"
+#include "arcane/Concurrency.h"
 
 #include "arcane/accelerator/core/RunQueueBuildInfo.h"
 #include "arcane/accelerator/core/Runner.h"
@@ -71,6 +73,7 @@ class AcceleratorFilterUnitTest
  private:
 
   void executeTest2(Int32 size, Int32 test_id);
+  void _executeBenchmark(Int32 size);
 };
 
 /*---------------------------------------------------------------------------*/
@@ -117,6 +120,65 @@ executeTest()
     executeTest2(400, i);
     executeTest2(1000000, i);
   }
+  Int32 benchmark_size = options()->benchmarkSize();
+  if (benchmark_size > 0)
+    _executeBenchmark(benchmark_size);
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+/*!
+ * \brief Mesure le temps du filtrage en fonction du nombre de threads.
+ *
+ * N'a d'intérêt que pour la politique d'exécution eExecutionPolicy::Thread.
+ */
+void AcceleratorFilterUnitTest::
+_executeBenchmark(Int32 size)
+{
+  ValueChecker vc(A_FUNCINFO);
+
+  RunQueue queue(makeQueue(subDomain()->acceleratorMng()->defaultRunner()));
+  if (queue.executionPolicy() != ax::eExecutionPolicy::Thread) {
+    info() << "Filter benchmark is only available with 'Thread' execution policy";
+    return;
+  }
+
+  NumArray<Int64, MDDim1> t1(size);
+  NumArray<Int64, MDDim1> t2(size);
+  NumArray<Int16, MDDim1> filter_flags(size);
+  Int32 nb_expected = 0;
+  for (Int32 i = 0; i < size; ++i) {
+    t1[i] = i;
+    bool is_filter = ((i % 3) != 0);
+    filter_flags[i] = (is_filter) ? 1 : 0;
+    if (is_filter)
+      ++nb_expected;
+  }
+
+  const Int32 nb_loop = 10;
+  const ParallelLoopOptions saved_options(TaskFactory::defaultParallelLoopOptions());
+  const Int32 max_thread = TaskFactory::nbAllowedThread();
+  Real reference_time = 0.0;
+  for (Int32 nb_thread = 1; nb_thread <= max_thread; nb_thread *= 2) {
+    ParallelLoopOptions loop_options(saved_options);
+    loop_options.setMaxThread(nb_thread);
+    TaskFactory::setDefaultParallelLoopOptions(loop_options);
+    Int32 nb_out = 0;
+    Real time_begin = platform::getRealTime();
+    for (Int32 k = 0; k < nb_loop; ++k) {
+      ax::GenericFilterer filterer(&queue);
+      filterer.apply(t1.to1DConstSmallSpan(), t2.to1DSmallSpan(), filter_flags.to1DConstSmallSpan());
+      nb_out = filterer.nbOutputElement();
+    }
+    Real elapsed = (platform::getRealTime() - time_begin) / nb_loop;
+    if (nb_thread == 1)
+      reference_time = elapsed;
+    Real speedup = (elapsed > 0.0) ? (reference_time / elapsed) : 0.0;
+    info() << "FilterBenchmark size=" << size << " nb_thread=" << nb_thread
+           << " time=" << elapsed << " speedup=" << speedup;
+    vc.areEqual(nb_out, nb_expected, "BenchmarkNbOut");
+  }
+  TaskFactory::setDefaultParallelLoopOptions(saved_options);
 }
 
 /*---------------------------------------------------------------------------*/
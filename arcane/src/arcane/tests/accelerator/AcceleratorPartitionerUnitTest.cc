@@ -108,7 +108,7 @@ initializeTest()
 void AcceleratorPartitionerUnitTest::
 executeTest()
 {
-  for (Int32 i = 0; i < 1; ++i) {
+  for (Int32 i = 0; i < 2; ++i) {
     executeTest2(400, i);
     executeTest2(1000000, i);
   }
@@ -148,6 +148,10 @@ _executeTestDataType(Int32 size, Int32 test_id)
 
   UniqueArray<DataType> result_part1;
   UniqueArray<DataType> result_part2;
+  // Valeurs attendues pour le partitionnement en trois parties
+  UniqueArray<DataType> expected_part1;
+  UniqueArray<DataType> expected_part2;
+  UniqueArray<DataType> expected_part3;
 
   std::seed_seq rng_seed{ 37, 49, 23 };
   std::mt19937 randomizer(rng_seed);
@@ -169,6 +173,12 @@ _executeTestDataType(Int32 size, Int32 test_id)
       --list2_index;
       expected_t2[list2_index] = v;
     }
+    if (v > static_cast<DataType>(569))
+      expected_part1.add(v);
+    else if (v < static_cast<DataType>(300))
+      expected_part2.add(v);
+    else
+      expected_part3.add(v);
   }
   Int32 expected_nb_list1 = list1_index;
   if (n1 < min_size_display) {
@@ -193,6 +203,34 @@ _executeTestDataType(Int32 size, Int32 test_id)
       info() << "Out T2=" << t2.to1DSpan();
     vc.areEqualArray(t2.to1DSpan(), expected_t2.to1DSpan(), "OutputList");
   } break;
+  case 1: // Partitionnement en trois parties
+  {
+    auto select1_lambda = [] ARCCORE_HOST_DEVICE(const DataType& x) -> bool {
+      return (x > static_cast<DataType>(569));
+    };
+    auto select2_lambda = [] ARCCORE_HOST_DEVICE(const DataType& x) -> bool {
+      return (x < static_cast<DataType>(300));
+    };
+    NumArray<DataType, MDDim1> out_part1(n1);
+    NumArray<DataType, MDDim1> out_part2(n1);
+    NumArray<DataType, MDDim1> out_part3(n1);
+    Arcane::Accelerator::GenericPartitioner generic_partitioner(m_queue);
+    generic_partitioner.applyIf(n1, t1.to1DSpan().begin(), out_part1.to1DSpan().begin(),
+                                out_part2.to1DSpan().begin(), out_part3.to1DSpan().begin(),
+                                select1_lambda, select2_lambda);
+    SmallSpan<const Int32> nb_parts = generic_partitioner.nbParts();
+    const Int32 nb_part1 = nb_parts[0];
+    const Int32 nb_part2 = nb_parts[1];
+    info() << "NB_Part1_accelerator=" << nb_part1 << " NB_Part2_accelerator=" << nb_part2;
+    vc.areEqual(nb_part1, expected_part1.size(), "NbPart1");
+    vc.areEqual(nb_part2, expected_part2.size(), "NbPart2");
+    out_part1.resize(nb_part1);
+    out_part2.resize(nb_part2);
+    out_part3.resize(n1 - nb_part1 - nb_part2);
+    vc.areEqualArray(out_part1.to1DSpan(), expected_part1.span(), "OutputPart1");
+    vc.areEqualArray(out_part2.to1DSpan(), expected_part2.span(), "OutputPart2");
+    vc.areEqualArray(out_part3.to1DSpan(), expected_part3.span(), "OutputPart3");
+  } break;
   }
 }
 
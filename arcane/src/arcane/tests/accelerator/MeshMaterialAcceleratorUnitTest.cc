@@ -19,6 +19,7 @@
 #include "arcane/utils/ArithmeticException.h"
 #include "arcane/utils/ValueChecker.h"
 #include "arcane/utils/IMemoryAllocator.h"
+#include "arcane/utils/SimdOperation.h"
 
 #include "arcane/core/BasicUnitTest.h"
 #include "arcane/core/ServiceBuilder.h"
@@ -129,6 +130,7 @@ class MeshMaterialAcceleratorUnitTest
   void _executeTest4(Integer nb_z);
   void _executeTest5(Integer nb_z, MatCellVectorView mat);
   void _executeTest6();
+  void _executeTest7(Integer nb_z, IMeshMaterial* mat);
   void _checkEnvValues1();
   void _checkMatValues1();
   void _checkEnvironmentValues();
@@ -347,6 +349,11 @@ executeTest()
   {
     _executeTest6();
   }
+  // L'énumération vectorielle n'est disponible que sur l'hôte.
+  if (!ax::isAcceleratorPolicy(m_runner->executionPolicy())) {
+    IMeshEnvironment* env2 = m_mm_mng->environments()[1];
+    _executeTest7(nb_z, env2->materials()[1]);
+  }
 }
 
 /*---------------------------------------------------------------------------*/
@@ -857,6 +864,78 @@ _executeTest6()
   }
 }
 
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+/*!
+ * \brief Test du RUNCOMMAND_MAT_ENUMERATE(SimdEnvCell, ...
+ * et RUNCOMMAND_MAT_ENUMERATE(SimdMatCell, ... avec accès vectoriel
+ * aux variables multimat sur les parties pures et impures du milieu
+ * \a m_env1 puis du matériau \a mat.
+ */
+void MeshMaterialAcceleratorUnitTest::
+_executeTest7(Integer nb_z, IMeshMaterial* mat)
+{
+  info() << "Execute Test 7";
+  _initializeVariables(m_env1->envView());
+
+  // Ref CPU
+  for (Integer z = 0, iz = nb_z; z < iz; ++z) {
+    ENUMERATE_ENVCELL (i, m_env1) {
+      m_mat_a_ref[i] = m_mat_b_ref[i] + m_mat_c_ref[i] * m_mat_d_ref[i] + m_mat_e_ref[i];
+    }
+  }
+
+#if !defined(ARCANE_COMPILING_CUDA) && !defined(ARCANE_COMPILING_HIP) && !defined(ARCANE_COMPILING_SYCL)
+  // SIMD
+  {
+    auto queue = makeQueue(m_runner);
+    auto cmd = makeCommand(queue);
+
+    auto out_a = ax::viewOut(cmd, m_mat_a);
+    auto in_b = ax::viewIn(cmd, m_mat_b);
+    auto in_c = ax::viewIn(cmd, m_mat_c);
+    auto in_d = ax::viewIn(cmd, m_mat_d);
+    auto in_e = ax::viewIn(cmd, m_mat_e);
+
+    for (Integer z = 0, iz = nb_z; z < iz; ++z) {
+      cmd << RUNCOMMAND_MAT_ENUMERATE(SimdEnvCell, mvi, m_env1)
+      {
+        out_a[mvi] = in_b[mvi] + in_c[mvi] * in_d[mvi] + in_e[mvi];
+      };
+    }
+  }
+
+  _checkEnvValues1();
+
+  // Même calcul sur un matériau
+  _initializeVariables(mat->matView());
+  for (Integer z = 0, iz = nb_z; z < iz; ++z) {
+    ENUMERATE_MATCELL (i, mat) {
+      m_mat_a_ref[i] = m_mat_b_ref[i] + m_mat_c_ref[i] * m_mat_d_ref[i] + m_mat_e_ref[i];
+    }
+  }
+  {
+    auto queue = makeQueue(m_runner);
+    auto cmd = makeCommand(queue);
+
+    auto out_a = ax::viewOut(cmd, m_mat_a);
+    auto in_b = ax::viewIn(cmd, m_mat_b);
+    auto in_c = ax::viewIn(cmd, m_mat_c);
+    auto in_d = ax::viewIn(cmd, m_mat_d);
+    auto in_e = ax::viewIn(cmd, m_mat_e);
+
+    for (Integer z = 0, iz = nb_z; z < iz; ++z) {
+      cmd << RUNCOMMAND_MAT_ENUMERATE(SimdMatCell, mvi, mat)
+      {
+        out_a[mvi] = in_b[mvi] + in_c[mvi] * in_d[mvi] + in_e[mvi];
+      };
+    }
+  }
+
+  _checkMatValues1();
+#endif
+}
+
 /*---------------------------------------------------------------------------*/
 /*---------------------------------------------------------------------------*/
 
@@ -0,0 +1,452 @@
+﻿// -*- tab-width: 2; indent-tabs-mode: nil; coding: utf-8-with-signature -*-
+//-----------------------------------------------------------------------------
+// Copyright 2000-2024 CEA (www.cea.fr) IFPEN (www.ifpenergiesnouvelles.com)
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: Apache-2.0
+//-----------------------------------------------------------------------------
+/*---------------------------------------------------------------------------*/
+/* MeshMaterialCellCentricUnitTest.cc                          (C) 2000-2024 */
+/*                                                                           */
+/* Test et comparaison des rangements classique et 'centré maille'.          */
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+#include "arcane/utils/PlatformUtils.h"
+#include "arcane/utils/FatalErrorException.h"
+
+#include "arcane/core/BasicUnitTest.h"
+#include "arcane/core/FactoryService.h"
+#include "arcane/core/ItemGroup.h"
+#include "arcane/core/MathUtils.h"
+#include "arcane/core/ItemPrinter.h"
+
+#include "arcane/materials/IMeshMaterialMng.h"
+#include "arcane/materials/IMeshMaterial.h"
+#include "arcane/materials/IMeshEnvironment.h"
+#include "arcane/materials/MeshEnvironmentBuildInfo.h"
+#include "arcane/materials/MeshMaterialModifier.h"
+#include "arcane/materials/MatItemEnumerator.h"
+#include "arcane/materials/CellToAllEnvCellConverter.h"
+#include "arcane/materials/MeshMaterialVariableRef.h"
+#include "arcane/materials/CellCentricMaterialIndex.h"
+#include "arcane/materials/CellCentricMaterialVariable.h"
+
+#include "arcane/accelerator/core/Runner.h"
+#include "arcane/accelerator/core/RunQueue.h"
+#include "arcane/accelerator/core/IAcceleratorMng.h"
+
+#include "arcane/accelerator/VariableViews.h"
+#include "arcane/accelerator/MaterialVariableViews.h"
+#include "arcane/accelerator/RunCommandEnumerate.h"
+
+#include "arcane/tests/ArcaneTestGlobal.h"
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+namespace ArcaneTest
+{
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+using namespace Arcane;
+using namespace Arcane::Materials;
+namespace ax = Arcane::Accelerator;
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+/*!
+ * \brief Test du rangement 'centré maille' des variables matériaux.
+ *
+ * Le test utilise un grand nombre de matériaux et compare les résultats et
+ * les temps d'exécution d'un noyau de type loi d'état suivi d'une somme par
+ * maille entre le rangement classique (parcours des mailles puis des
+ * milieux et des matériaux de chaque maille) et le rangement 'centré maille'
+ * avec et sans tampon compagnon.
+ */
+class MeshMaterialCellCentricUnitTest
+: public BasicUnitTest
+{
+ public:
+
+  explicit MeshMaterialCellCentricUnitTest(const ServiceBuildInfo& sb);
+
+ public:
+
+  void initializeTest() override;
+  void executeTest() override;
+
+ public:
+
+  // Les méthodes suivantes doivent être publiques pour
+  // sur accélérateur
+
+  void _computeCellCentric(Int32 nb_iteration, bool use_companion,
+                           MaterialVariableCellReal& pressure_var,
+                           VariableCellReal& sum_pressure_var);
+
+ private:
+
+  ax::Runner* m_runner = nullptr;
+  IMeshMaterialMng* m_mm_mng = nullptr;
+
+  MaterialVariableCellReal m_density;
+  MaterialVariableCellReal m_energy;
+  MaterialVariableCellReal m_pressure;
+  MaterialVariableCellReal m_pressure_ref;
+  MaterialVariableCellReal m_pressure_direct;
+  VariableCellReal m_sum_pressure;
+  VariableCellReal m_sum_pressure_ref;
+  VariableCellReal m_sum_pressure_direct;
+
+ private:
+
+  void _initializeMaterials();
+  void _initializeValues();
+  void _computeClassic(Int32 nb_iteration);
+  void _checkValues(const String& name, MaterialVariableCellReal& pressure_var,
+                    VariableCellReal& sum_pressure_var);
+  void _checkUpdateAfterModification();
+};
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+ARCANE_REGISTER_CASE_OPTIONS_NOAXL_FACTORY(MeshMaterialCellCentricUnitTest,
+                                           IUnitTest, MeshMaterialCellCentricUnitTest);
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+MeshMaterialCellCentricUnitTest::
+MeshMaterialCellCentricUnitTest(const ServiceBuildInfo& sb)
+: BasicUnitTest(sb)
+, m_density(VariableBuildInfo(mesh(), "Density"))
+, m_energy(VariableBuildInfo(mesh(), "Energy"))
+, m_pressure(VariableBuildInfo(mesh(), "Pressure"))
+, m_pressure_ref(VariableBuildInfo(mesh(), "PressureRef"))
+, m_pressure_direct(VariableBuildInfo(mesh(), "PressureDirect"))
+, m_sum_pressure(VariableBuildInfo(mesh(), "SumPressure"))
+, m_sum_pressure_ref(VariableBuildInfo(mesh(), "SumPressureRef"))
+, m_sum_pressure_direct(VariableBuildInfo(mesh(), "SumPressureDirect"))
+{
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+void MeshMaterialCellCentricUnitTest::
+initializeTest()
+{
+  m_runner = subDomain()->acceleratorMng()->defaultRunner();
+  m_mm_mng = IMeshMaterialMng::getReference(mesh());
+  _initializeMaterials();
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+void MeshMaterialCellCentricUnitTest::
+_initializeMaterials()
+{
+  // Créé 4 milieux de 4 matériaux chacun.
+  const Int32 nb_env = 4;
+  const Int32 nb_mat_per_env = 4;
+  for (Int32 i = 0; i < nb_env; ++i) {
+    Materials::MeshEnvironmentBuildInfo env_build(String("ENV") + String::fromNumber(i));
+    for (Int32 j = 0; j < nb_mat_per_env; ++j) {
+      String mat_name = String("MAT") + String::fromNumber(i * nb_mat_per_env + j);
+      m_mm_mng->registerMaterialInfo(mat_name);
+      env_build.addMaterial(mat_name);
+    }
+    m_mm_mng->createEnvironment(env_build);
+  }
+  m_mm_mng->endCreate(false);
+
+  // Chaque maille contient entre 1 et 4 matériaux répartis dans
+  // un ou plusieurs milieux.
+  ConstArrayView<IMeshMaterial*> materials = m_mm_mng->materials();
+  const Int32 nb_mat = materials.size();
+  UniqueArray<UniqueArray<Int32>> mat_cells(nb_mat);
+  ENUMERATE_ (Cell, icell, allCells()) {
+    Int64 uid = icell->uniqueId();
+    Int32 nb_cell_mat = 1 + static_cast<Int32>((uid * 7) % 4);
+    for (Int32 k = 0; k < nb_cell_mat; ++k) {
+      Int32 mat_index = static_cast<Int32>((uid * 3 + k * 5) % nb_mat);
+      mat_cells[mat_index].add(icell.itemLocalId());
+    }
+  }
+  {
+    MeshMaterialModifier modifier(m_mm_mng);
+    for (Int32 i = 0; i < nb_mat; ++i)
+      modifier.addCells(materials[i], mat_cells[i]);
+  }
+
+  Int64 nb_mat_value = 0;
+  ENUMERATE_MAT (imat, m_mm_mng) {
+    nb_mat_value += (*imat)->cells().size();
+  }
+  info() << "NbCell=" << allCells().size() << " NbMaterial=" << nb_mat
+         << " NbMaterialValue=" << nb_mat_value;
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+void MeshMaterialCellCentricUnitTest::
+_initializeValues()
+{
+  ENUMERATE_MAT (imat, m_mm_mng) {
+    IMeshMaterial* mat = *imat;
+    Real mat_id = static_cast<Real>(mat->id());
+    ENUMERATE_MATCELL (imatcell, mat) {
+      MatCell mc = *imatcell;
+      Real z = static_cast<Real>(mc.globalCell().localId() % 17);
+      m_density[mc] = 1.0 + z * 0.3 + mat_id;
+      m_energy[mc] = 2.0 + z * 0.1 + mat_id * 0.5;
+      m_pressure[mc] = 0.0;
+      m_pressure_ref[mc] = 0.0;
+      m_pressure_direct[mc] = 0.0;
+    }
+  }
+  m_sum_pressure.fill(0.0);
+  m_sum_pressure_ref.fill(0.0);
+  m_sum_pressure_direct.fill(0.0);
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+void MeshMaterialCellCentricUnitTest::
+executeTest()
+{
+  Int32 nb_iteration = 20;
+  if (arcaneIsDebug())
+    nb_iteration = 2;
+
+  _initializeValues();
+
+  _computeClassic(nb_iteration);
+  _computeCellCentric(nb_iteration, true, m_pressure, m_sum_pressure);
+  _checkValues("Companion", m_pressure, m_sum_pressure);
+  _computeCellCentric(nb_iteration, false, m_pressure_direct, m_sum_pressure_direct);
+  _checkValues("Direct", m_pressure_direct, m_sum_pressure_direct);
+
+  // Doit être fait en dernier car modifie les matériaux.
+  _checkUpdateAfterModification();
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+/*!
+ * \brief Calcul de référence avec le rangement classique.
+ */
+void MeshMaterialCellCentricUnitTest::
+_computeClassic(Int32 nb_iteration)
+{
+  const Real gamma = 1.4;
+  Real time0 = platform::getRealTime();
+  for (Int32 iter = 0; iter < nb_iteration; ++iter) {
+    ENUMERATE_ALLENVCELL (iallenvcell, m_mm_mng, allCells()) {
+      AllEnvCell all_env_cell = *iallenvcell;
+      Real sum = 0.0;
+      ENUMERATE_CELL_ENVCELL (ienvcell, all_env_cell) {
+        ENUMERATE_CELL_MATCELL (imatcell, (*ienvcell)) {
+          MatCell mc = *imatcell;
+          Real p = (gamma - 1.0) * m_density[mc] * m_energy[mc];
+          m_pressure_ref[mc] = p;
+          sum += p;
+        }
+      }
+      m_sum_pressure_ref[all_env_cell.globalCell()] = sum;
+    }
+  }
+  Real time1 = platform::getRealTime();
+  info() << "CellCentricBenchmark classic layout time=" << (time1 - time0)
+         << " nb_iteration=" << nb_iteration;
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+/*!
+ * \brief Calcul avec le rangement 'centré maille'.
+ *
+ * Si \a use_companion est vrai, les variables utilisent un tampon compagnon.
+ * Sinon, les vues accèdent directement aux valeurs des variables.
+ */
+void MeshMaterialCellCentricUnitTest::
+_computeCellCentric(Int32 nb_iteration, bool use_companion,
+                    MaterialVariableCellReal& pressure_var,
+                    VariableCellReal& sum_pressure_var)
+{
+  const Real gamma = 1.4;
+  auto queue = makeQueue(m_runner);
+
+  Real time0 = platform::getRealTime();
+  CellCentricMaterialIndex index(m_mm_mng);
+  index.update();
+  CellCentricMaterialVariableScalar<Real> density(&index, m_density);
+  CellCentricMaterialVariableScalar<Real> energy(&index, m_energy);
+  CellCentricMaterialVariableScalar<Real> pressure(&index, pressure_var);
+  density.setUseCompanionBuffer(use_companion);
+  energy.setUseCompanionBuffer(use_companion);
+  pressure.setUseCompanionBuffer(use_companion);
+  density.gather(queue);
+  energy.gather(queue);
+  pressure.gather(queue);
+  Real time1 = platform::getRealTime();
+
+  {
+    auto command = makeCommand(queue);
+    auto in_density = ax::viewIn(command, density);
+    auto in_energy = ax::viewIn(command, energy);
+    auto out_pressure = ax::viewOut(command, pressure);
+    auto out_sum_pressure = ax::viewOut(command, sum_pressure_var);
+    for (Int32 iter = 0; iter < nb_iteration; ++iter) {
+      command << RUNCOMMAND_ENUMERATE (Cell, cid, allCells())
+      {
+        Real sum = 0.0;
+        for (Int32 i = 0, n = in_density.nbMaterial(cid); i < n; ++i) {
+          Real p = (gamma - 1.0) * in_density(cid, i) * in_energy(cid, i);
+          out_pressure(cid, i) = p;
+          sum += p;
+        }
+        out_sum_pressure[cid] = sum;
+      };
+    }
+  }
+  Real time2 = platform::getRealTime();
+
+  pressure.scatter(queue);
+  Real time3 = platform::getRealTime();
+
+  info() << "CellCentricBenchmark cell-centric layout companion=" << use_companion
+         << " time=" << (time2 - time1)
+         << " nb_iteration=" << nb_iteration
+         << " (build+gather=" << (time1 - time0) << " scatter=" << (time3 - time2) << ")";
+
+  // Vérifie que l'index n'est pas recalculé si les matériaux n'ont pas changé.
+  if (index.update())
+    ARCANE_FATAL("Index should not have been updated");
+  // Vérifie que le tampon compagnon n'est alloué que s'il est demandé.
+  Int32 expected_size = (use_companion) ? index.nbValue() : 0;
+  if (pressure.values().size() != expected_size)
+    ARCANE_FATAL("Bad companion buffer size v={0} expected={1}", pressure.values().size(), expected_size);
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+void MeshMaterialCellCentricUnitTest::
+_checkValues(const String& name, MaterialVariableCellReal& pressure_var,
+             VariableCellReal& sum_pressure_var)
+{
+  // Les sommes sont faites dans le même ordre dans les deux cas mais
+  // le compilateur peut utiliser des FMA sur accélérateur.
+  const Real epsilon = 1.0e-14;
+  Int32 nb_error = 0;
+  ENUMERATE_MAT (imat, m_mm_mng) {
+    ENUMERATE_MATCELL (imatcell, (*imat)) {
+      MatCell mc = *imatcell;
+      if (!math::isNearlyEqualWithEpsilon(pressure_var[mc], m_pressure_ref[mc], epsilon)) {
+        if (nb_error < 10)
+          info() << "Bad pressure (" << name << ") cell=" << ItemPrinter(mc.globalCell())
+                 << " mat=" << (*imat)->name()
+                 << " v=" << pressure_var[mc] << " expected=" << m_pressure_ref[mc];
+        ++nb_error;
+      }
+    }
+  }
+  ENUMERATE_ (Cell, icell, allCells()) {
+    if (!math::isNearlyEqualWithEpsilon(sum_pressure_var[icell], m_sum_pressure_ref[icell], epsilon)) {
+      if (nb_error < 10)
+        info() << "Bad sum (" << name << ") cell=" << ItemPrinter(*icell)
+               << " v=" << sum_pressure_var[icell] << " expected=" << m_sum_pressure_ref[icell];
+      ++nb_error;
+    }
+  }
+  if (nb_error != 0)
+    ARCANE_FATAL("Bad values for '{0}' nb_error={1}", name, nb_error);
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+/*!
+ * \brief Vérifie que l'index et le tampon compagnon sont mis à jour
+ * après une modification des matériaux.
+ */
+void MeshMaterialCellCentricUnitTest::
+_checkUpdateAfterModification()
+{
+  auto queue = makeQueue(m_runner);
+
+  CellCentricMaterialIndex index(m_mm_mng);
+  CellCentricMaterialVariableScalar<Real> density(&index, m_density);
+  if (!density.isUseCompanionBuffer())
+    ARCANE_FATAL("Companion buffer should be used by default");
+  density.gather(queue);
+  Int64 old_timestamp = index.timestamp();
+
+  // Supprime une maille sur deux du premier matériau.
+  {
+    IMeshMaterial* mat0 = m_mm_mng->materials()[0];
+    UniqueArray<Int32> removed_cells;
+    Int32 z = 0;
+    ENUMERATE_MATCELL (imatcell, mat0) {
+      if ((z % 2) == 0)
+        removed_cells.add((*imatcell).globalCell().localId());
+      ++z;
+    }
+    info() << "Remove " << removed_cells.size() << " cells from material " << mat0->name();
+    MeshMaterialModifier modifier(m_mm_mng);
+    modifier.removeCells(mat0, removed_cells);
+  }
+
+  // Le tampon compagnon n'est plus valide tant que gather() n'a pas été appelé.
+  bool has_exception = false;
+  try {
+    density.scatter(queue);
+  }
+  catch (const FatalErrorException&) {
+    has_exception = true;
+  }
+  if (!has_exception)
+    ARCANE_FATAL("scatter() should fail when the companion buffer is not up to date");
+
+  density.gather(queue);
+  if (index.timestamp() == old_timestamp || index.timestamp() != m_mm_mng->timestamp())
+    ARCANE_FATAL("Index has not been updated old_timestamp={0} timestamp={1}",
+                 old_timestamp, index.timestamp());
+
+  // Vérifie que les valeurs du tampon correspondent à celles de la variable
+  // dans l'ordre de ENUMERATE_CELL_ENVCELL puis ENUMERATE_CELL_MATCELL.
+  CellToAllEnvCellConverter all_env_cell_converter(m_mm_mng);
+  SmallSpan<const Int32> cells_offset = index.cellsOffset();
+  SmallSpan<const Real> values = density.values();
+  Int32 nb_error = 0;
+  ENUMERATE_ (Cell, icell, allCells()) {
+    Int32 lid = icell.itemLocalId();
+    Int32 k = cells_offset[lid];
+    AllEnvCell all_env_cell = all_env_cell_converter[icell];
+    ENUMERATE_CELL_ENVCELL (ienvcell, all_env_cell) {
+      ENUMERATE_CELL_MATCELL (imatcell, (*ienvcell)) {
+        if (k >= cells_offset[lid + 1] || values[k] != m_density[imatcell])
+          ++nb_error;
+        ++k;
+      }
+    }
+    if (k != cells_offset[lid + 1])
+      ++nb_error;
+  }
+  if (nb_error != 0)
+    ARCANE_FATAL("Bad companion values after material modification nb_error={0}", nb_error);
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+} // End namespace ArcaneTest
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
@@ -1,11 +1,11 @@
 ﻿// -*- tab-width: 2; indent-tabs-mode: nil; coding: utf-8-with-signature -*-
 //-----------------------------------------------------------------------------
-// Copyright 2000-2022 CEA (www.cea.fr) IFPEN (www.ifpenergiesnouvelles.com)
+// Copyright 2000-2024 CEA (www.cea.fr) IFPEN (www.ifpenergiesnouvelles.com)
 // See the top-level COPYRIGHT file for details.
 // SPDX-License-Identifier: Apache-2.0
 //-----------------------------------------------------------------------------
 /*---------------------------------------------------------------------------*/
-/* tv_display_arcane_types.cc                                  (C) 2000-2018 */
+/* tv_display_arcane_types.cc                                  (C) 2000-2024 */
 /*                                                                           */
 /* Informations pour le debugging avec totalview                             */
 /*---------------------------------------------------------------------------*/
@@ -460,6 +460,7 @@ _displayVariable(const Arcane::IVariable* var)
   show_ttf_internal_flag(properties, Arcane::IVariable::PNoRestore, "NoRestore");
   show_ttf_internal_flag(properties, Arcane::IVariable::PNoExchange, "NoExchange");
   show_ttf_internal_flag(properties, Arcane::IVariable::PTemporary, "Temporary");
+  show_ttf_internal_flag(properties, Arcane::IVariable::PDeltaSync, "DeltaSync");
 }
 
 ATTR_USED int
@@ -108,8 +108,6 @@ class HashTableMapT
   HashTableMapT(Integer table_size, bool use_prime)
   : HashTableBase(table_size, use_prime)
   , m_first_free(0)
-  , m_nb_collision(0)
-  , m_nb_direct(0)
   , m_max_count(0)
   {
     m_buffer = new MultiBufferT<Data>(m_nb_bucket);
@@ -126,8 +124,6 @@ class HashTableMapT
   HashTableMapT(Integer table_size, bool use_prime, Integer buffer_size)
   : HashTableBase(table_size, use_prime)
   , m_first_free(0)
-  , m_nb_collision(0)
-  , m_nb_direct(0)
   {
     m_buffer = new MultiBufferT<Data>(buffer_size);
     m_buckets.resize(m_nb_bucket);
@@ -440,12 +436,6 @@ class HashTableMapT
   MultiBufferT<Data>* m_buffer; //!< Tampon d'allocation des valeurs
   Data* m_first_free = nullptr; //!< Pointeur vers le premier Data utilisable
 
- public:
-
-  mutable Int64 m_nb_collision = 0;
-  mutable Int64 m_nb_direct = 0;
-
- private:
 
   Data* _add(Integer bucket, KeyTypeConstRef key, const ValueType& value)
   {
@@ -479,13 +469,11 @@ class HashTableMapT
 
   Data* _baseLookupBucket(Integer bucket, KeyTypeConstRef id) const
   {
+    // Ne modifie pas d'état pour que les recherches concurrentes
+    // soient possibles.
     for (Data* i = m_buckets[bucket]; i; i = i->next()) {
-      if (!(i->key() == id)) {
-        ++m_nb_collision;
-        continue;
-      }
-      ++m_nb_direct;
-      return i;
+      if (i->key() == id)
+        return i;
     }
     return 0;
   }
@@ -1,11 +1,11 @@
 ﻿// -*- tab-width: 2; indent-tabs-mode: nil; coding: utf-8-with-signature -*-
 //-----------------------------------------------------------------------------
-// Copyright 2000-2022 CEA (www.cea.fr) IFPEN (www.ifpenergiesnouvelles.com)
+// Copyright 2000-2024 CEA (www.cea.fr) IFPEN (www.ifpenergiesnouvelles.com)
 // See the top-level COPYRIGHT file for details.
 // SPDX-License-Identifier: Apache-2.0
 //-----------------------------------------------------------------------------
 /*---------------------------------------------------------------------------*/
-/* IDataCompressor.h                                           (C) 2000-2021 */
+/* IDataCompressor.h                                           (C) 2000-2024 */
 /*                                                                           */
 /* Interface permettant de compresser/décompresser des données.              */
 /*---------------------------------------------------------------------------*/
@@ -26,6 +26,11 @@ namespace Arcane
 /*---------------------------------------------------------------------------*/
 /*!
  * \brief Interface d'un service permettant de compresser/décompresser des données.
+ *
+ * Les méthodes compress() et decompress() peuvent être appelées simultanément
+ * par plusieurs threads, par exemple lors d'une compression par blocs.
+ * Les implémentations ne doivent donc pas modifier d'état interne lors de
+ * ces appels.
  */
 class ARCANE_UTILS_EXPORT IDataCompressor
 {
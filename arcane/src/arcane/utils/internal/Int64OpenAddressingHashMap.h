@@ -0,0 +1,332 @@
+﻿// -*- tab-width: 2; indent-tabs-mode: nil; coding: utf-8-with-signature -*-
+//-----------------------------------------------------------------------------
+// Copyright 2000-2024 CEA (www.cea.fr) IFPEN (www.ifpenergiesnouvelles.com)
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: Apache-2.0
+//-----------------------------------------------------------------------------
+/*---------------------------------------------------------------------------*/
+/* Int64OpenAddressingHashMap.h                                (C) 2000-2024 */
+/*                                                                           */
+/* Table de hachage à adressage ouvert dont la clé est un Int64.             */
+/*---------------------------------------------------------------------------*/
+#ifndef ARCANE_UTILS_INTERNAL_INT64OPENADDRESSINGHASHMAP_H
+#define ARCANE_UTILS_INTERNAL_INT64OPENADDRESSINGHASHMAP_H
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+#include "arcane/utils/Array.h"
+#include "arcane/utils/FatalErrorException.h"
+
+#include <algorithm>
+#include <bit>
+#include <limits>
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+namespace Arcane::impl
+{
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+/*!
+ * \internal
+ * \brief Table de hachage à adressage ouvert dont la clé est un Int64.
+ *
+ * Contrairement à HashTableMapT qui utilise un chaînage des éléments,
+ * les clés et les valeurs sont conservées dans un tableau contigu de
+ * groupes dont le nombre est une puissance de 2. Chaque groupe contient
+ * \a GROUP_SIZE clés (soit une ligne de cache) suivies des valeurs
+ * associées. Le sondage est linéaire par groupe : la comparaison des clés
+ * d'un groupe n'a pas de dépendance entre les éléments et peut donc être
+ * vectorisée par le compilateur.
+ *
+ * Les valeurs \a EMPTY_KEY et \a DELETED_KEY sont réservées et ne peuvent
+ * pas être utilisées comme clé. La suppression d'un élément laisse une
+ * marque (\a DELETED_KEY) qui est éliminée lors du prochain redimensionnement.
+ *
+ * Les pointeurs sur les valeurs retournés par lookup() sont invalidés
+ * par toute opération d'ajout.
+ */
+template <typename ValueType>
+class Int64OpenAddressingHashMapT
+{
+ public:
+
+  static constexpr Int64 EMPTY_KEY = std::numeric_limits<Int64>::min();
+  static constexpr Int64 DELETED_KEY = EMPTY_KEY + 1;
+  static constexpr Int32 GROUP_SIZE = 8;
+
+ private:
+
+  //! Groupe de clés et des valeurs associées
+  struct Group
+  {
+    Int64 keys[GROUP_SIZE];
+    ValueType values[GROUP_SIZE];
+  };
+
+ public:
+
+  Int64OpenAddressingHashMapT()
+  {
+    _allocate(2);
+  }
+
+ public:
+
+  //! Nombre d'éléments
+  Int64 count() const { return m_nb_used; }
+
+  //! Nombre d'emplacements alloués
+  Int64 capacity() const { return m_groups.largeSize() * GROUP_SIZE; }
+
+  //! Supprime tous les éléments sans changer la capacité
+  void clear()
+  {
+    for (Group& g : m_groups)
+      std::fill_n(g.keys, GROUP_SIZE, EMPTY_KEY);
+    m_nb_used = 0;
+    m_nb_deleted = 0;
+  }
+
+  //! Dimensionne la table pour contenir au moins \a nb_element éléments sans redimensionnement
+  void reserve(Int64 nb_element)
+  {
+    Int64 wanted = _nbGroupForCount(nb_element);
+    if (wanted > m_groups.largeSize())
+      _rehash(wanted);
+  }
+
+  /*!
+   * \brief Ajoute la valeur \a value correspondant à la clé \a key.
+   *
+   * Si la clé existe déjà, sa valeur est remplacée.
+   *
+   * \retval true si la clé est ajoutée
+   * \retval false si la clé existe déjà et est remplacée
+   */
+  bool add(Int64 key, const ValueType& value)
+  {
+    _checkKey(key);
+    if ((m_nb_used + m_nb_deleted + 1) > m_max_fill)
+      _rehash(_nbGroupForCount(m_nb_used + 1));
+    ValueType* v = _find(key, _groupIndex(key));
+    if (v) {
+      *v = value;
+      return false;
+    }
+    _insertNew(key, value);
+    return true;
+  }
+
+  //! Supprime la valeur associée à \a key. Retourne \a false si la clé n'existe pas.
+  bool remove(Int64 key)
+  {
+    if (_isReservedKey(key))
+      return false;
+    ValueType* v = _find(key, _groupIndex(key));
+    if (!v)
+      return false;
+    // Retrouve la clé associée à la valeur
+    Group& g = m_groups[_groupOf(v)];
+    g.keys[v - g.values] = DELETED_KEY;
+    --m_nb_used;
+    ++m_nb_deleted;
+    return true;
+  }
+
+  /*!
+   * \brief Pointeur sur la valeur associée à \a key ou \a nullptr si aucune.
+   *
+   * Les clés réservées (EMPTY_KEY et DELETED_KEY) ne peuvent pas être
+   * présentes dans la table et retournent toujours \a nullptr.
+   */
+  ValueType* lookup(Int64 key)
+  {
+    if (_isReservedKey(key))
+      return nullptr;
+    return _find(key, _groupIndex(key));
+  }
+
+  //! Pointeur sur la valeur associée à \a key ou \a nullptr si aucune
+  const ValueType* lookup(Int64 key) const
+  {
+    if (_isReservedKey(key))
+      return nullptr;
+    return _find(key, _groupIndex(key));
+  }
+
+  /*!
+   * \brief Recherche un ensemble de clés.
+   *
+   * Pour chaque indice \a i de \a keys, appelle \a func(i,v) où \a v est
+   * un pointeur sur la valeur associée à keys[i] ou \a nullptr si la clé
+   * n'est pas présente.
+   *
+   * Les recherches sont effectuées par paquets : les groupes de toutes les
+   * clés d'un paquet sont calculés et préchargés avant le sondage ce qui
+   * permet de recouvrir les latences des accès mémoire.
+   */
+  template <typename Lambda> void
+  lookupMany(Span<const Int64> keys, const Lambda& func) const
+  {
+    constexpr Int32 BATCH_SIZE = 16;
+    Int64 groups[BATCH_SIZE];
+    const Int64 nb_key = keys.size();
+    for (Int64 begin = 0; begin < nb_key; begin += BATCH_SIZE) {
+      const Int32 n = static_cast<Int32>(std::min(nb_key - begin, static_cast<Int64>(BATCH_SIZE)));
+      for (Int32 j = 0; j < n; ++j) {
+        groups[j] = _groupIndex(keys[begin + j]);
+        _prefetch(m_groups.data() + groups[j]);
+      }
+      for (Int32 j = 0; j < n; ++j) {
+        Int64 key = keys[begin + j];
+        func(begin + j, (_isReservedKey(key)) ? nullptr : _find(key, groups[j]));
+      }
+    }
+  }
+
+  //! Applique \a func(key,value) à chaque élément de la table
+  template <typename Lambda> void
+  each(const Lambda& func) const
+  {
+    for (const Group& g : m_groups) {
+      for (Int32 j = 0; j < GROUP_SIZE; ++j) {
+        Int64 key = g.keys[j];
+        if (key != EMPTY_KEY && key != DELETED_KEY)
+          func(key, g.values[j]);
+      }
+    }
+  }
+
+ private:
+
+  UniqueArray<Group> m_groups;
+  Int64 m_nb_used = 0;
+  Int64 m_nb_deleted = 0;
+  //! Nombre maximum d'emplacements utilisés (y compris supprimés) avant redimensionnement
+  Int64 m_max_fill = 0;
+  //! Décalage pour calculer le groupe à partir du hachage
+  Int32 m_hash_shift = 0;
+
+ private:
+
+  static constexpr bool _isReservedKey(Int64 key)
+  {
+    return key == EMPTY_KEY || key == DELETED_KEY;
+  }
+
+  static void _checkKey(Int64 key)
+  {
+    if (_isReservedKey(key))
+      ARCANE_FATAL("Invalid key '{0}' for Int64OpenAddressingHashMap", key);
+  }
+
+  static void _prefetch([[maybe_unused]] const Group* g)
+  {
+#if defined(__GNUC__)
+    __builtin_prefetch(g);
+#endif
+  }
+
+  //! Nombre de groupes (puissance de 2) pour un taux de remplissage maximal de 7/8
+  static Int64 _nbGroupForCount(Int64 nb_element)
+  {
+    Int64 wanted = ((nb_element * 8) / 7) / GROUP_SIZE + 1;
+    Int64 nb_group = 2;
+    while (nb_group < wanted)
+      nb_group *= 2;
+    return nb_group;
+  }
+
+  void _allocate(Int64 nb_group)
+  {
+    m_groups.resize(nb_group);
+    m_nb_used = 0;
+    m_nb_deleted = 0;
+    clear();
+    m_max_fill = (capacity() / 8) * 7;
+    m_hash_shift = 64 - std::countr_zero(static_cast<UInt64>(nb_group));
+  }
+
+  //! Indice du groupe initial associé à \a key (hachage de Fibonacci)
+  Int64 _groupIndex(Int64 key) const
+  {
+    UInt64 h = static_cast<UInt64>(key) * 0x9E3779B97F4A7C15ULL;
+    return static_cast<Int64>(h >> m_hash_shift);
+  }
+
+  Int64 _groupOf(const ValueType* v) const
+  {
+    const char* base = reinterpret_cast<const char*>(m_groups.data());
+    return (reinterpret_cast<const char*>(v) - base) / static_cast<Int64>(sizeof(Group));
+  }
+
+  //! Valeur associée à \a key en partant du groupe \a group ou \a nullptr si non trouvée
+  ValueType* _find(Int64 key, Int64 group) const
+  {
+    const Int64 mask = m_groups.largeSize() - 1;
+    Group* groups = const_cast<Group*>(m_groups.data());
+    for (;;) {
+      Group& g = groups[group];
+      UInt32 match_mask = 0;
+      UInt32 empty_mask = 0;
+      for (Int32 j = 0; j < GROUP_SIZE; ++j) {
+        match_mask |= static_cast<UInt32>(g.keys[j] == key) << j;
+        empty_mask |= static_cast<UInt32>(g.keys[j] == EMPTY_KEY) << j;
+      }
+      if (match_mask != 0)
+        return g.values + std::countr_zero(match_mask);
+      // Un emplacement vide termine toujours la séquence de sondage.
+      if (empty_mask != 0)
+        return nullptr;
+      group = (group + 1) & mask;
+    }
+  }
+
+  //! Insère une clé qui n'est pas présente dans la table
+  void _insertNew(Int64 key, const ValueType& value)
+  {
+    const Int64 mask = m_groups.largeSize() - 1;
+    Int64 group = _groupIndex(key);
+    for (;;) {
+      Group& g = m_groups[group];
+      for (Int32 j = 0; j < GROUP_SIZE; ++j) {
+        Int64 current = g.keys[j];
+        if (current == EMPTY_KEY || current == DELETED_KEY) {
+          if (current == DELETED_KEY)
+            --m_nb_deleted;
+          g.keys[j] = key;
+          g.values[j] = value;
+          ++m_nb_used;
+          return;
+        }
+      }
+      group = (group + 1) & mask;
+    }
+  }
+
+  void _rehash(Int64 new_nb_group)
+  {
+    UniqueArray<Group> old_groups(std::move(m_groups));
+    _allocate(new_nb_group);
+    for (const Group& g : old_groups) {
+      for (Int32 j = 0; j < GROUP_SIZE; ++j) {
+        Int64 key = g.keys[j];
+        if (key != EMPTY_KEY && key != DELETED_KEY)
+          _insertNew(key, g.values[j]);
+      }
+    }
+  }
+};
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+} // namespace Arcane::impl
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+#endif
@@ -335,6 +335,7 @@ set(ARCANE_SOURCES
   internal/ValueConvertInternal.h
   internal/SpecificMemoryCopyList.h
   internal/MemoryBuffer.h
+  internal/Int64OpenAddressingHashMap.h
   )
 
 if (ARCANE_HAS_CXX20)
@@ -1,6 +1,6 @@
 ﻿// -*- tab-width: 2; indent-tabs-mode: nil; coding: utf-8-with-signature -*-
 //-----------------------------------------------------------------------------
-// Copyright 2000-2023 CEA (www.cea.fr) IFPEN (www.ifpenergiesnouvelles.com)
+// Copyright 2000-2024 CEA (www.cea.fr) IFPEN (www.ifpenergiesnouvelles.com)
 // See the top-level COPYRIGHT file for details.
 // SPDX-License-Identifier: Apache-2.0
 //-----------------------------------------------------------------------------
@@ -9,6 +9,12 @@
 
 #include "arcane/utils/HashTableMap.h"
 #include "arcane/utils/String.h"
+#include "arcane/utils/PlatformUtils.h"
+#include "arcane/utils/ValueConvert.h"
+#include "arcane/utils/FatalErrorException.h"
+#include "arcane/utils/internal/Int64OpenAddressingHashMap.h"
+
+#include <random>
 
 /*---------------------------------------------------------------------------*/
 /*---------------------------------------------------------------------------*/
@@ -91,3 +97,142 @@ TEST(TestHashTable, Misc)
 
 /*---------------------------------------------------------------------------*/
 /*---------------------------------------------------------------------------*/
+
+TEST(TestHashTable, OpenAddressing)
+{
+  impl::Int64OpenAddressingHashMapT<Int32> hash1;
+  ASSERT_EQ(hash1.count(), 0);
+  ASSERT_TRUE(hash1.add(25, 1));
+  ASSERT_TRUE(hash1.add(-3, 2));
+  ASSERT_FALSE(hash1.add(25, 3));
+  ASSERT_EQ(hash1.count(), 2);
+  ASSERT_EQ(*hash1.lookup(25), 3);
+  ASSERT_EQ(*hash1.lookup(-3), 2);
+  ASSERT_EQ(hash1.lookup(47), nullptr);
+  ASSERT_TRUE(hash1.remove(25));
+  ASSERT_FALSE(hash1.remove(25));
+  ASSERT_EQ(hash1.lookup(25), nullptr);
+  ASSERT_EQ(hash1.count(), 1);
+  hash1.clear();
+  ASSERT_EQ(hash1.count(), 0);
+
+  // Ajoute et supprime beaucoup de valeurs pour tester les redimensionnements
+  // et les emplacements supprimés.
+  const Int32 n = 100000;
+  for (Int32 i = 0; i < n; ++i)
+    hash1.add(i * 7, i);
+  for (Int32 i = 0; i < n; i += 2)
+    hash1.remove(i * 7);
+  for (Int32 i = 0; i < n; i += 4)
+    hash1.add(i * 7, -i);
+  for (Int32 i = 0; i < n; ++i) {
+    const Int32* v = hash1.lookup(i * 7);
+    if ((i % 4) == 0)
+      ASSERT_EQ(*v, -i);
+    else if ((i % 2) == 0)
+      ASSERT_EQ(v, nullptr);
+    else
+      ASSERT_EQ(*v, i);
+  }
+  UniqueArray<Int64> keys(n);
+  for (Int32 i = 0; i < n; ++i)
+    keys[i] = i * 7;
+  Int64 nb_found = 0;
+  hash1.lookupMany(keys, [&](Int64 i, const Int32* v) {
+    if (v) {
+      ++nb_found;
+      ASSERT_EQ(*v, ((i % 4) == 0) ? -i : i);
+    }
+  });
+  ASSERT_EQ(nb_found, hash1.count());
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+
+TEST(TestHashTable, OpenAddressingReservedKeys)
+{
+  using HashType = impl::Int64OpenAddressingHashMapT<Int32>;
+  const Int64 empty_key = HashType::EMPTY_KEY;
+  const Int64 deleted_key = HashType::DELETED_KEY;
+
+  HashType hash1;
+  // Table vide : les groupes ne contiennent que des clés EMPTY_KEY.
+  ASSERT_EQ(hash1.lookup(empty_key), nullptr);
+  ASSERT_EQ(hash1.lookup(deleted_key), nullptr);
+
+  for (Int32 i = 0; i < 50; ++i)
+    hash1.add(i, i);
+  // Crée des emplacements supprimés (DELETED_KEY).
+  for (Int32 i = 0; i < 50; i += 3)
+    hash1.remove(i);
+  ASSERT_EQ(hash1.lookup(empty_key), nullptr);
+  ASSERT_EQ(hash1.lookup(deleted_key), nullptr);
+  const HashType& const_hash1 = hash1;
+  ASSERT_EQ(const_hash1.lookup(empty_key), nullptr);
+  ASSERT_EQ(const_hash1.lookup(deleted_key), nullptr);
+  ASSERT_FALSE(hash1.remove(empty_key));
+  ASSERT_FALSE(hash1.remove(deleted_key));
+  ASSERT_EQ(hash1.count(), 33);
+
+  UniqueArray<Int64> keys = { empty_key, 1, deleted_key, 3 };
+  hash1.lookupMany(keys, [&](Int64 i, const Int32* v) {
+    if (i == 1)
+      ASSERT_EQ(*v, 1);
+    else
+      ASSERT_EQ(v, nullptr);
+  });
+  ASSERT_THROW(hash1.add(empty_key, 1), FatalErrorException);
+  ASSERT_THROW(hash1.add(deleted_key, 1), FatalErrorException);
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/
+/*!
+ * \brief Compare les temps de recherche de HashTableMapT et de
+ * impl::Int64OpenAddressingHashMapT.
+ *
+ * Le nombre d'éléments peut être spécifié par la variable d'environnement
+ * ARCANE_TEST_HASHTABLE_BENCHMARK_SIZE (par exemple 100000000 pour
+ * reproduire une famille de 100 millions d'entités).
+ */
+TEST(TestHashTable, OpenAddressingBenchmark)
+{
+  Int32 n = 1000000;
+  if (auto v = Convert::Type<Int32>::tryParseFromEnvironment("ARCANE_TEST_HASHTABLE_BENCHMARK_SIZE", true))
+    n = v.value();
+
+  // Les uniqueId sont tirés aléatoirement comme après un partitionnement.
+  UniqueArray<Int64> uids(n);
+  std::mt19937_64 rng(1234);
+  for (Int32 i = 0; i < n; ++i)
+    uids[i] = static_cast<Int64>(rng() >> 4);
+  UniqueArray<Int64> search_uids(uids);
+  std::shuffle(search_uids.begin(), search_uids.end(), rng);
+
+  Int64 sum1 = 0;
+  Int64 sum2 = 0;
+  Real t0 = platform::getRealTime();
+  HashTableMapT<Int64, Int32> hash1(5000, false);
+  for (Int32 i = 0; i < n; ++i)
+    hash1.add(uids[i], i);
+  Real t1 = platform::getRealTime();
+  for (Int32 i = 0; i < n; ++i)
+    sum1 += hash1.lookupValue(search_uids[i]);
+  Real t2 = platform::getRealTime();
+
+  impl::Int64OpenAddressingHashMapT<Int32> hash2;
+  for (Int32 i = 0; i < n; ++i)
+    hash2.add(uids[i], i);
+  Real t3 = platform::getRealTime();
+  hash2.lookupMany(search_uids, [&](Int64, const Int32* v) { sum2 += *v; });
+  Real t4 = platform::getRealTime();
+
+  std::cout << "HashTableBenchmark n=" << n
+            << " chained: add=" << (t1 - t0) << " lookup=" << (t2 - t1)
+            << " open_addressing: add=" << (t3 - t2) << " lookup=" << (t4 - t3) << "\n";
+  ASSERT_EQ(sum1, sum2);
+}
+
+/*---------------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------*/